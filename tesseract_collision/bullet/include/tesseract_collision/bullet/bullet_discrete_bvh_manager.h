@@ -144,6 +144,8 @@ private:
   std::unique_ptr<btBroadphaseInterface> broadphase_;
   /** @brief A map of all (static and active) collision objects being managed */
   Link2Cow link2cow_;
+  /** @brief Separation bounds for pairs of collision objects, algorithms are kept persistent by the broadphase pairs */
+  CollisionPairCache pair_cache_;
 
   /**
    * @brief This is used when contactTest is called. It is also added as a user point to the collsion objects
@@ -58,7 +58,7 @@ public:
 
   BulletDiscreteSimpleManager(std::string name = "BulletDiscreteSimpleManager",
                               TesseractCollisionConfigurationInfo config_info = TesseractCollisionConfigurationInfo());
-  ~BulletDiscreteSimpleManager() override = default;
+  ~BulletDiscreteSimpleManager() override;
   BulletDiscreteSimpleManager(const BulletDiscreteSimpleManager&) = delete;
   BulletDiscreteSimpleManager& operator=(const BulletDiscreteSimpleManager&) = delete;
   BulletDiscreteSimpleManager(BulletDiscreteSimpleManager&&) = delete;
@@ -144,6 +144,8 @@ private:
   Link2Cow link2cow_;
   /** @brief A vector of collision objects (active followed by static) */
   std::vector<COW::Ptr> cows_;
+  /** @brief Persistent collision algorithms and separation bounds for pairs of collision objects */
+  CollisionPairCache pair_cache_;
 
   /**
    * @brief This is used when contactTest is called. It is also added as a user point to the collsion objects
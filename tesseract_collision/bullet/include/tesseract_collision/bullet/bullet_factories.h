@@ -39,6 +39,10 @@ namespace tesseract_collision::tesseract_collision_bullet
  * The current defaults will result in 7MB being allocated for every contact manager created.
  * If share_pool_allocators is set to true then this 7MB is shared between it and any clones created.
  *
+ * If mesh_bvh is set to true then meshes are represented by a BulletMeshShape, a static triangle bounding volume
+ * hierarchy shared between clones, instead of a compound shape with a child for every triangle. If mesh_bvh_directory
+ * is set the hierarchies are serialized to this directory and loaded instead of being rebuilt.
+ *
  * Example Yaml Config:
  *
  *    plugins:
@@ -48,6 +52,8 @@ namespace tesseract_collision::tesseract_collision_bullet
  *          share_pool_allocators: false
  *          max_persistent_manifold_pool_size: 4096
  *          max_collision_algorithm_pool_size: 4096
+ *          mesh_bvh: false
+ *          mesh_bvh_directory: ""
  */
 class BulletDiscreteBVHManagerFactory : public DiscreteContactManagerFactory
 {
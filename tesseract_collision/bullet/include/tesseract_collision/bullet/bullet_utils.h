@@ -49,10 +49,16 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <BulletCollision/CollisionDispatch/btManifoldResult.h>
 #include <btBulletCollisionCommon.h>
 #include <console_bridge/console.h>
+#include <functional>
+#include <future>
+#include <map>
+#include <mutex>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_collision/core/types.h>
 #include <tesseract_collision/core/common.h>
+#include <tesseract_geometry/impl/compact_mesh.h>
+#include <tesseract_geometry/impl/octree.h>
 
 namespace tesseract_collision::tesseract_collision_bullet
 {
@@ -64,6 +70,7 @@ const btScalar BULLET_LENGTH_TOLERANCE = btScalar(0.001) METERS;
 const btScalar BULLET_EPSILON = btScalar(1e-3);
 const btScalar BULLET_DEFAULT_CONTACT_DISTANCE = btScalar(0.05);
 const bool BULLET_COMPOUND_USE_DYNAMIC_AABB = true;
+const btScalar BULLET_PAIR_CACHE_DISTANCE_PADDING = btScalar(0.1) METERS;
 
 btVector3 convertEigenToBt(const Eigen::Vector3d& v);
 
@@ -79,6 +86,43 @@ btTransform convertEigenToBt(const Eigen::Isometry3d& t);
 
 Eigen::Isometry3d convertBtToEigen(const btTransform& t);
 
+/**
+ * @brief The transform from the start to the end pose of a cast collision object
+ * @details This is shared by all of the cast shapes of a collision object. Each shape computes its own cast transform
+ * from this and its location in the collision object when it is needed, so updating the cast transform of a collision
+ * object does not depend on the number of shapes it contains.
+ */
+class CastTransform
+{
+public:
+  using Ptr = std::shared_ptr<CastTransform>;
+  using ConstPtr = std::shared_ptr<const CastTransform>;
+
+  /**
+   * @brief Set the transform from the start to the end pose of the collision object
+   * @param t01 The end pose relative to the start pose
+   */
+  void setTransform(const btTransform& t01);
+
+  /** @brief Get the transform from the start to the end pose of the collision object */
+  const btTransform& getTransform() const;
+
+  /**
+   * @brief Get the transform from the start to the end pose of a shape in the collision object
+   * @param local_tf The transform of the shape relative to the collision object
+   */
+  btTransform getTransform(const btTransform& local_tf) const;
+
+  /** @brief Get the revision which is incremented every time the transform is set */
+  std::size_t getRevision() const;
+
+private:
+  btTransform t01_{ btTransform::getIdentity() };
+  std::size_t revision_{ 0 };
+};
+
+class BulletMeshBVHCache;
+
 /**
  * @brief This is a tesseract bullet collsion object.
  *
@@ -96,15 +140,28 @@ public:
   using ConstPtr = std::shared_ptr<const CollisionObjectWrapper>;
 
   CollisionObjectWrapper() = default;
+  /**
+   * @brief Create the collision object
+   * @param name The name of the collision object
+   * @param type_id The type id of the collision object
+   * @param shapes The collision shapes
+   * @param shape_poses The poses of the collision shapes
+   * @param mesh_bvh_cache If provided meshes use a BulletMeshShape instead of a compound of triangles, and meshes and
+   * compact meshes sharing their buffers share the hierarchy
+   */
   CollisionObjectWrapper(std::string name,
                          const int& type_id,
                          CollisionShapesConst shapes,
-                         tesseract_common::VectorIsometry3d shape_poses);
+                         tesseract_common::VectorIsometry3d shape_poses,
+                         const std::shared_ptr<BulletMeshBVHCache>& mesh_bvh_cache = nullptr);
 
   short int m_collisionFilterGroup{ btBroadphaseProxy::KinematicFilter };
   short int m_collisionFilterMask{ btBroadphaseProxy::StaticFilter | btBroadphaseProxy::KinematicFilter };
   bool m_enabled{ true };
 
+  /** @brief The cast transform shared by the shapes of a cast collision object, otherwise nullptr */
+  CastTransform::Ptr m_cast_transform{ nullptr };
+
   /** @brief Get the collision object name */
   const std::string& getName() const;
   /** @brief Get a user defined type */
@@ -150,16 +207,145 @@ using COW = CollisionObjectWrapper;
 using Link2Cow = std::map<std::string, COW::Ptr>;
 using Link2ConstCow = std::map<std::string, COW::ConstPtr>;
 
+/**
+ * @brief Stores narrowphase information for pairs of collision objects between contact tests
+ * @details The narrowphase is queried with the contact distance expanded by a padding and the smallest distance
+ * reported is stored along with the world transforms of both objects. On the next contact test a conservative lower
+ * bound on the current distance is computed by subtracting how far any point on either object could have moved since
+ * then. If this bound is beyond the contact distance the narrowphase is skipped for the pair.
+ *
+ * It can also hold a persistent collision algorithm for each pair so it does not need to be created and freed for
+ * every contact test.
+ */
+class CollisionPairCache
+{
+public:
+  struct Entry
+  {
+    /** @brief The collision object which the transform tf0 belongs to */
+    const CollisionObjectWrapper* cow0{ nullptr };
+    /** @brief The collision object which the transform tf1 belongs to */
+    const CollisionObjectWrapper* cow1{ nullptr };
+    /** @brief The world transform of cow0 when the separation was computed */
+    btTransform tf0;
+    /** @brief The world transform of cow1 when the separation was computed */
+    btTransform tf1;
+    /** @brief A lower bound on the distance between cow0 at tf0 and cow1 at tf1, negative if unknown */
+    btScalar separation{ -BT_LARGE_FLOAT };
+    /** @brief A persistent collision algorithm, owned by the cache */
+    btCollisionAlgorithm* algorithm{ nullptr };
+    /** @brief The collision object passed as body0 when the algorithm was created */
+    const CollisionObjectWrapper* algorithm_body0{ nullptr };
+  };
+
+  /**
+   * @brief Constructor
+   * @param distance_padding The distance added to the contact distance when querying the narrowphase. Larger values
+   * allow pairs to be skipped after more motion but require the narrowphase to compute distances for more pairs.
+   */
+  explicit CollisionPairCache(btScalar distance_padding = BULLET_PAIR_CACHE_DISTANCE_PADDING);
+  ~CollisionPairCache();
+  CollisionPairCache(const CollisionPairCache&) = delete;
+  CollisionPairCache& operator=(const CollisionPairCache&) = delete;
+  CollisionPairCache(CollisionPairCache&&) = delete;
+  CollisionPairCache& operator=(CollisionPairCache&&) = delete;
+
+  /** @brief Get the distance added to the contact distance when querying the narrowphase */
+  btScalar getDistancePadding() const;
+
+  /**
+   * @brief Get the entry for a pair of collision objects, which is created if it does not exist
+   * @details The order of the collision objects does not matter
+   */
+  Entry& getEntry(const CollisionObjectWrapper& cow0, const CollisionObjectWrapper& cow1);
+
+  /**
+   * @brief Check if the narrowphase can be skipped because the pair is guaranteed to be beyond the contact distance
+   * @param entry The entry for the pair
+   * @param contact_distance The contact distance for the current contact test
+   * @return True if the pair is guaranteed to be separated by more than contact_distance
+   */
+  bool canSkip(const Entry& entry, btScalar contact_distance);
+
+  /**
+   * @brief Update the separation stored for a pair after the narrowphase was queried
+   * @param entry The entry for the pair
+   * @param contact_distance The contact distance the narrowphase was queried with excluding the padding
+   * @param min_distance The smallest distance reported by the narrowphase, BT_LARGE_FLOAT if none were reported
+   */
+  void update(Entry& entry, btScalar contact_distance, btScalar min_distance) const;
+
+  /** @brief Mark the separation stored for a pair as unknown */
+  static void invalidate(Entry& entry);
+
+  /**
+   * @brief Get the persistent collision algorithm for the pair, which is created if it does not exist
+   * @param entry The entry for the pair
+   * @param obj0_wrap The first collision object wrapper
+   * @param obj1_wrap The second collision object wrapper
+   * @param dispatcher The dispatcher used to create the algorithm, it must be the same for all calls
+   * @return The collision algorithm, nullptr if none exist for the shape types
+   */
+  static btCollisionAlgorithm* getAlgorithm(Entry& entry,
+                                            const btCollisionObjectWrapper* obj0_wrap,
+                                            const btCollisionObjectWrapper* obj1_wrap,
+                                            btCollisionDispatcher* dispatcher);
+
+  /**
+   * @brief Remove all entries which include the provided collision object
+   * @param cow The collision object
+   * @param dispatcher The dispatcher used to create the algorithms
+   */
+  void remove(const CollisionObjectWrapper* cow, btCollisionDispatcher* dispatcher);
+
+  /**
+   * @brief Remove all entries
+   * @param dispatcher The dispatcher used to create the algorithms
+   */
+  void clear(btCollisionDispatcher* dispatcher);
+
+private:
+  btScalar distance_padding_;
+  std::map<std::pair<const CollisionObjectWrapper*, const CollisionObjectWrapper*>, Entry> entries_;
+  /** @brief The radius of a sphere centered at the objects origin enclosing its collision shape */
+  std::map<const CollisionObjectWrapper*, btScalar> radius_;
+
+  /** @brief Get the radius of a sphere centered at the objects origin enclosing its collision shape */
+  btScalar getOriginRadius(const CollisionObjectWrapper* cow);
+
+  /** @brief Get the maximum distance any point on the collision object moved between the two transforms */
+  btScalar getMaxMotion(const CollisionObjectWrapper* cow, const btTransform& tf_from);
+};
+
 /** @brief This is a casted collision shape used for checking if an object is collision free between two transforms */
 struct CastHullShape : public btConvexShape
 {
 public:
   btConvexShape* m_shape;
-  btTransform m_t01;
+
+  /** @brief The cast transform, this is mutable because it is updated lazily from the collision object cast transform */
+  mutable btTransform m_t01;
 
   CastHullShape(btConvexShape* shape, const btTransform& t01);
 
+  /**
+   * @brief Create a cast shape which reads its cast transform from the cast transform of its collision object
+   * @param shape The shape being cast
+   * @param cast_transform The cast transform of the collision object
+   * @param local_tf The transform of the shape relative to the collision object
+   */
+  CastHullShape(btConvexShape* shape, CastTransform::ConstPtr cast_transform, const btTransform& local_tf);
+
+  /**
+   * @brief Set the cast transform
+   * @details If the shape reads its cast transform from a collision object this is overwritten the next time the cast
+   * transform of the collision object is set.
+   */
   void updateCastTransform(const btTransform& t01);
+
+  /** @brief Get the transform from the start to the end pose of the shape */
+  const btTransform& getCastTransform() const;
+
   btVector3 localGetSupportingVertex(const btVector3& vec) const override;
 
   /// getAabb's default implementation is brute force, expected derived classes to implement a fast dedicated version
@@ -190,6 +376,294 @@ public:
 
   void calculateLocalInertia(btScalar, btVector3&) const override;
   // LCOV_EXCL_STOP
+
+private:
+  CastTransform::ConstPtr m_cast_transform;
+  btTransform m_local_tf;
+  mutable std::size_t m_cast_revision{ 0 };
+};
+
+/**
+ * @brief A compound shape containing the cast shapes of a collision object
+ * @details The bounds of the cast shapes depend on the cast transform which is read lazily, so this does not use a
+ * dynamic AABB tree which would have to be rebuilt every time the cast transform changes. The local AABB of the compound
+ * is the AABB of the shapes at the start pose and the AABB of the compound is the union of it at the start and end pose.
+ */
+class CastCompoundShape : public btCompoundShape
+{
+public:
+  /**
+   * @brief Constructor
+   * @param cast_transform The cast transform of the collision object
+   * @param local_tf The transform of the compound relative to the collision object
+   * @param initial_child_capacity The number of children to reserve
+   */
+  CastCompoundShape(CastTransform::ConstPtr cast_transform, const btTransform& local_tf, int initial_child_capacity = 0);
+
+  void getAabb(const btTransform& t, btVector3& aabbMin, btVector3& aabbMax) const override;
+
+  const char* getName() const override;
+
+  /** @brief Get the transform from the start to the end pose of the compound */
+  const btTransform& getCastTransform() const;
+
+private:
+  CastTransform::ConstPtr m_cast_transform;
+  btTransform m_local_tf;
+  mutable btTransform m_t01;
+  mutable std::size_t m_cast_revision{ 0 };
+};
+
+/**
+ * @brief This is an octree collision shape which references the octomap directly
+ *
+ * Unlike a compound shape it does not create a child for every occupied voxel. Instead the octomap hierarchy is
+ * traversed during narrowphase by the TesseractOctreeCollisionAlgorithm, skipping any node whose occupancy is below the
+ * occupancy threshold. This relies on inner nodes storing the max occupancy of their children, which is the octomap
+ * default. If the octomap was updated using lazy evaluation, updateInnerOccupancy() must be called before it is used.
+ */
+class BulletOctreeShape : public btConcaveShape
+{
+public:
+  /** @brief Interface called for every occupied voxel found while traversing the octree */
+  struct VoxelCallback
+  {
+    virtual ~VoxelCallback() = default;
+
+    /**
+     * @brief Process an occupied voxel
+     * @param center The center of the voxel in the octree frame
+     * @param depth The depth of the voxel in the octree
+     * @return False to stop traversing the octree, otherwise true
+     */
+    virtual bool processVoxel(const btVector3& center, unsigned depth) = 0;
+  };
+
+  /**
+   * @brief Create an octree collision shape
+   * @param octree The octomap
+   * @param sub_type The shape used to represent an occupied voxel
+   * @param shape_index The user index assigned to the voxel shapes
+   */
+  BulletOctreeShape(std::shared_ptr<const octomap::OcTree> octree,
+                    tesseract_geometry::Octree::SubType sub_type,
+                    int shape_index);
+
+  /** @brief Get the octomap */
+  const octomap::OcTree& getOctree() const;
+
+  /** @brief Get the shape used to represent an occupied voxel */
+  tesseract_geometry::Octree::SubType getSubType() const;
+
+  /** @brief Get the shape representing an occupied voxel at the provided depth, centered at the origin */
+  btConvexShape* getVoxelShape(unsigned depth) const;
+
+  /**
+   * @brief Call the callback for every occupied voxel whose bounds overlap the provided AABB
+   * @param aabb_min The minimum of the AABB in the octree frame
+   * @param aabb_max The maximum of the AABB in the octree frame
+   * @param callback The callback to call for every overlapping voxel
+   */
+  void processOverlappingVoxels(const btVector3& aabb_min, const btVector3& aabb_max, VoxelCallback& callback) const;
+
+  void getAabb(const btTransform& t, btVector3& aabbMin, btVector3& aabbMax) const override;
+
+  const char* getName() const override;
+
+  // LCOV_EXCL_START
+  void processAllTriangles(btTriangleCallback* callback,
+                           const btVector3& aabbMin,
+                           const btVector3& aabbMax) const override;
+
+  void setLocalScaling(const btVector3& scaling) override;
+
+  const btVector3& getLocalScaling() const override;
+
+  void calculateLocalInertia(btScalar mass, btVector3& inertia) const override;
+  // LCOV_EXCL_STOP
+
+protected:
+  std::shared_ptr<const octomap::OcTree> octree_;
+  tesseract_geometry::Octree::SubType sub_type_;
+  double occupancy_threshold_;
+  octomap::key_type tree_max_val_;
+
+  /** @brief The scale applied to half the size of a node to get the half extents of its bounds */
+  btScalar bounds_scale_{ 1 };
+
+  /** @brief The shape for an occupied voxel at each depth of the octree */
+  std::vector<std::shared_ptr<btConvexShape>> voxel_shapes_;
+
+  btVector3 local_aabb_min_{ 0, 0, 0 };
+  btVector3 local_aabb_max_{ 0, 0, 0 };
+  btVector3 local_scaling_{ 1, 1, 1 };
+
+  bool processNode(const octomap::OcTreeNode* node,
+                   const octomap::OcTreeKey& key,
+                   unsigned depth,
+                   const btVector3& aabb_min,
+                   const btVector3& aabb_max,
+                   VoxelCallback& callback) const;
+};
+
+/**
+ * @brief The triangle mesh interface and quantized bounding volume hierarchy of a mesh or compact mesh
+ * @details The vertices and triangles of the mesh are referenced directly instead of being copied. It is immutable
+ * once created so it is shared by every collision shape created for the mesh.
+ */
+class BulletMeshBVH
+{
+public:
+  using Ptr = std::shared_ptr<BulletMeshBVH>;
+  using ConstPtr = std::shared_ptr<const BulletMeshBVH>;
+
+  /**
+   * @brief Create the bounding volume hierarchy of a mesh
+   * @details If a directory is provided the hierarchy is read from the file named after getKey() if it exists and
+   * matches the mesh, otherwise it is built and written to the file.
+   * @param mesh The mesh, it must contain at least one triangle
+   * @param directory The directory the serialized hierarchy is read from or written to
+   */
+  BulletMeshBVH(tesseract_geometry::Mesh::ConstPtr mesh, const std::string& directory = "");
+
+  /**
+   * @brief Create the bounding volume hierarchy of a compact mesh
+   * @details If a directory is provided the hierarchy is read from the file named after getKey() if it exists and
+   * matches the mesh, otherwise it is built and written to the file.
+   * @param mesh The compact mesh, it must contain at least one triangle
+   * @param directory The directory the serialized hierarchy is read from or written to
+   */
+  BulletMeshBVH(tesseract_geometry::CompactMesh::ConstPtr mesh, const std::string& directory = "");
+  ~BulletMeshBVH();
+  BulletMeshBVH(const BulletMeshBVH&) = delete;
+  BulletMeshBVH& operator=(const BulletMeshBVH&) = delete;
+  BulletMeshBVH(BulletMeshBVH&&) = delete;
+  BulletMeshBVH& operator=(BulletMeshBVH&&) = delete;
+
+  /** @brief Get the mesh or compact mesh */
+  const tesseract_geometry::Geometry& getGeometry() const;
+
+  /**
+   * @brief Get the key identifying the serialized hierarchy
+   * @details It is created from the geometry type, the mesh content, the precision of Bullet and the version of the
+   * file layout
+   */
+  const std::string& getKey() const;
+
+  /** @brief Get the mesh interface referencing the mesh buffers */
+  btStridingMeshInterface* getMeshInterface() const;
+
+  /** @brief Get the quantized bounding volume hierarchy */
+  btOptimizedBvh* getBVH() const;
+
+  /** @brief Check if the hierarchy was read from a file instead of being built */
+  bool isLoaded() const;
+
+  /**
+   * @brief Write the serialized hierarchy to a file
+   * @details The file is only valid for the mesh and a Bullet build with the same precision and endianness
+   * @param filepath The file path
+   * @return True if successful, otherwise false
+   */
+  bool save(const std::string& filepath) const;
+
+protected:
+  tesseract_geometry::Geometry::ConstPtr geometry_;
+  std::string key_;
+  std::unique_ptr<btTriangleIndexVertexArray> mesh_interface_;
+  btOptimizedBvh* bvh_{ nullptr };
+  /** @brief The aligned buffer a loaded hierarchy was deserialized in place into */
+  void* buffer_{ nullptr };
+
+  /** @brief Load the hierarchy from the directory or build it once the mesh interface is populated */
+  void init(const btIndexedMesh& indexed_mesh, const std::string& directory);
+
+  bool load(const std::string& filepath);
+};
+
+/**
+ * @brief Creates the bounding volume hierarchy of meshes and shares it between all collision objects using the mesh
+ * @details Meshes are identified by the address of their vertex and triangle buffers, so meshes sharing their buffers
+ * share the hierarchy, and an entry is only kept while a collision shape references it. If a directory is provided
+ * the serialized hierarchies are stored in it using the key of the hierarchy, so they are not rebuilt when the same
+ * mesh is loaded again.
+ */
+class BulletMeshBVHCache
+{
+public:
+  using Ptr = std::shared_ptr<BulletMeshBVHCache>;
+  using ConstPtr = std::shared_ptr<const BulletMeshBVHCache>;
+
+  /**
+   * @brief Constructor
+   * @param directory The directory to store the serialized hierarchies, if empty they are not stored
+   */
+  BulletMeshBVHCache(std::string directory = "");
+
+  /** @brief Get the directory the serialized hierarchies are stored in */
+  const std::string& getDirectory() const;
+
+  /**
+   * @brief Get the bounding volume hierarchy of a mesh, creating it if no collision shape references it
+   * @details This is thread safe. The hierarchy is created without holding the cache lock, so hierarchies of different
+   * meshes are created concurrently while requests for a hierarchy being created wait for it.
+   * @param mesh The mesh
+   * @return The bounding volume hierarchy
+   */
+  BulletMeshBVH::ConstPtr get(const tesseract_geometry::Mesh::ConstPtr& mesh);
+
+  /**
+   * @brief Get the bounding volume hierarchy of a compact mesh, creating it if no collision shape references it
+   * @details This is thread safe, see the mesh overload
+   * @param mesh The compact mesh
+   * @return The bounding volume hierarchy
+   */
+  BulletMeshBVH::ConstPtr get(const tesseract_geometry::CompactMesh::ConstPtr& mesh);
+
+  /** @brief Get the number of hierarchies currently referenced by collision shapes */
+  std::size_t size() const;
+
+protected:
+  /** @brief A hierarchy referenced by collision shapes or being created */
+  struct Entry
+  {
+    /** @brief The hierarchy once created */
+    std::weak_ptr<const BulletMeshBVH> bvh;
+
+    /** @brief Valid while the hierarchy is being created, other requests wait for it */
+    std::shared_future<BulletMeshBVH::ConstPtr> pending;
+  };
+
+  std::string directory_;
+  mutable std::mutex mutex_;
+  std::map<std::pair<const void*, const void*>, Entry> bvhs_;
+
+  BulletMeshBVH::ConstPtr get(const std::pair<const void*, const void*>& key,
+                              const std::function<BulletMeshBVH::ConstPtr()>& create);
+};
+
+/**
+ * @brief A static triangle mesh collision shape using a shared bounding volume hierarchy
+ * @details This is an alternative to representing a mesh as a compound shape with a child for every triangle, which
+ * requires an allocation and a compound tree node per triangle. Compact meshes always use this shape. Distance queries
+ * against convex shapes use the convex concave algorithm and mesh pairs use the
+ * TesseractTriangleMeshCollisionAlgorithm. The subshape id of a contact is the triangle index.
+ */
+class BulletMeshShape : public btBvhTriangleMeshShape
+{
+public:
+  /**
+   * @brief Create a mesh collision shape
+   * @param bvh The bounding volume hierarchy of the mesh
+   */
+  BulletMeshShape(BulletMeshBVH::ConstPtr bvh);
+
+  /** @brief Get the bounding volume hierarchy */
+  const BulletMeshBVH& getMeshBVH() const;
+
+protected:
+  /** @brief Keeps the mesh interface and hierarchy alive */
+  BulletMeshBVH::ConstPtr bvh_;
 };
 
 void GetAverageSupport(const btConvexShape* shape,
@@ -205,6 +679,15 @@ void GetAverageSupport(const btConvexShape* shape,
  */
 btTransform getLinkTransformFromCOW(const btCollisionObjectWrapper* cow);
 
+/**
+ * @brief Get the index of the tesseract collision shape a bullet collision object wrapper belongs to
+ * @details The triangles Bullet creates while checking a triangle mesh shape do not have an index, so the index of the
+ * parent triangle mesh shape is returned.
+ * @param cow Bullet collision object wrapper.
+ * @return The shape index
+ */
+int getShapeIndex(const btCollisionObjectWrapper* cow);
+
 /**
  * @brief This is used to check if a collision check is required between the provided two collision objects
  * @param cow1 The first collision object
@@ -247,6 +730,8 @@ btScalar addCastSingleResult(btManifoldPoint& cp,
 struct TesseractBridgedManifoldResult : public btManifoldResult
 {
   btCollisionWorld::ContactResultCallback& m_resultCallback;
+  /** @brief The smallest distance of all contact points added, before any filtering */
+  btScalar m_minDistance{ BT_LARGE_FLOAT };
 
   TesseractBridgedManifoldResult(const btCollisionObjectWrapper* obj0Wrap,
                                  const btCollisionObjectWrapper* obj1Wrap,
@@ -310,6 +795,8 @@ struct CastBroadphaseContactResultCallback : public BroadphaseContactResultCallb
 struct TesseractBroadphaseBridgedManifoldResult : public btManifoldResult
 {
   BroadphaseContactResultCallback& result_callback_;
+  /** @brief The smallest distance of all contact points added, before filtering by the contact distance */
+  btScalar min_distance_{ BT_LARGE_FLOAT };
 
   TesseractBroadphaseBridgedManifoldResult(const btCollisionObjectWrapper* obj0Wrap,
                                            const btCollisionObjectWrapper* obj1Wrap,
@@ -329,11 +816,20 @@ class TesseractCollisionPairCallback : public btOverlapCallback
   const btDispatcherInfo& dispatch_info_;
   btCollisionDispatcher* dispatcher_;
   BroadphaseContactResultCallback& results_callback_;
+  CollisionPairCache* pair_cache_;
 
 public:
+  /**
+   * @brief Constructor
+   * @param dispatchInfo The dispatcher information
+   * @param dispatcher The collision dispatcher
+   * @param results_callback The callback used to report contacts
+   * @param pair_cache An optional pair cache used to skip pairs which are guaranteed to be beyond the contact distance
+   */
   TesseractCollisionPairCallback(const btDispatcherInfo& dispatchInfo,
                                  btCollisionDispatcher* dispatcher,
-                                 BroadphaseContactResultCallback& results_callback);
+                                 BroadphaseContactResultCallback& results_callback,
+                                 CollisionPairCache* pair_cache = nullptr);
 
   ~TesseractCollisionPairCallback() override = default;
   TesseractCollisionPairCallback(const TesseractCollisionPairCallback&) = default;
@@ -362,11 +858,14 @@ private:
  * @param cow The collision object wrapper the collision shape is associated with
  * @param shape_index The collision shapes index within the collision shape wrapper. This can be accessed from the
  * bullet collision shape by calling getUserIndex function.
+ * @param mesh_bvh_cache If provided meshes use a BulletMeshShape instead of a compound of triangles, and meshes and
+ * compact meshes sharing their buffers share the hierarchy
  * @return Bullet collision shape.
  */
 std::shared_ptr<btCollisionShape> createShapePrimitive(const CollisionShapeConstPtr& geom,
                                                        CollisionObjectWrapper* cow,
-                                                       int shape_index);
+                                                       int shape_index,
+                                                       const BulletMeshBVHCache::Ptr& mesh_bvh_cache = nullptr);
 
 /**
  * @brief Update a collision objects filters
@@ -375,11 +874,22 @@ std::shared_ptr<btCollisionShape> createShapePrimitive(const CollisionShapeConst
  */
 void updateCollisionObjectFilters(const std::vector<std::string>& active, const COW::Ptr& cow);
 
+/**
+ * @brief Create a collision object
+ * @param name The name of the collision object
+ * @param type_id The type id of the collision object
+ * @param shapes The collision shapes
+ * @param shape_poses The poses of the collision shapes
+ * @param enabled Indicate if the collision object is enabled
+ * @param mesh_bvh_cache If provided meshes use a BulletMeshShape instead of a compound of triangles
+ * @return The collision object, nullptr if it has no shapes
+ */
 COW::Ptr createCollisionObject(const std::string& name,
                                const int& type_id,
                                const CollisionShapesConst& shapes,
                                const tesseract_common::VectorIsometry3d& shape_poses,
-                               bool enabled = true);
+                               bool enabled = true,
+                               const BulletMeshBVHCache::Ptr& mesh_bvh_cache = nullptr);
 
 struct DiscreteCollisionCollector : public btCollisionWorld::ContactResultCallback
 {
@@ -424,6 +934,30 @@ struct CastCollisionCollector : public btCollisionWorld::ContactResultCallback
   bool needsCollision(btBroadphaseProxy* proxy0) const override;
 };
 
+/**
+ * @brief Create a compound shape containing a cast shape for every occupied voxel of an octree
+ * @details Continuous collision checking requires convex shapes, so an active octree is expanded into its voxels
+ * @param shape The octree shape
+ * @param cow The cast collision object which will manage the created shapes
+ * @param local_tf The transform of the octree relative to the collision object
+ * @return The compound shape
+ */
+std::shared_ptr<btCompoundShape>
+createCastOctreeShape(const BulletOctreeShape& shape, CollisionObjectWrapper& cow, const btTransform& local_tf);
+
+/**
+ * @brief Create a compound shape containing a cast shape for every triangle of a triangle mesh shape
+ * @details Continuous collision checking requires convex shapes, so an active BulletMeshShape is expanded into its
+ * triangles
+ * @param shape The triangle mesh shape
+ * @param cow The cast collision object which will manage the created shapes
+ * @param local_tf The transform of the triangle mesh relative to the collision object
+ * @return The compound shape
+ */
+std::shared_ptr<btCompoundShape> createCastTriangleMeshShape(const btBvhTriangleMeshShape& shape,
+                                                             CollisionObjectWrapper& cow,
+                                                             const btTransform& local_tf);
+
 COW::Ptr makeCastCollisionObject(const COW::Ptr& cow);
 
 /**
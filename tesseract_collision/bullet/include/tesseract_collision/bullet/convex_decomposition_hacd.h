@@ -42,6 +42,9 @@ struct HACDParameters
   bool add_faces_points{ false };
 
   void print() const;
+
+  /** @brief Get a string uniquely identifying the parameters, used to key cached results */
+  std::string getKey() const;
 };
 
 class ConvexDecompositionHACD : public ConvexDecomposition
@@ -56,6 +59,8 @@ public:
   std::vector<tesseract_geometry::ConvexMesh::Ptr> compute(const tesseract_common::VectorVector3d& vertices,
                                                            const Eigen::VectorXi& faces) const override;
 
+  std::string getParametersKey() const override;
+
 private:
   HACDParameters params_;
 };
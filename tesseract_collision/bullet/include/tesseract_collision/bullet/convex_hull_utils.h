@@ -29,6 +29,7 @@
 #include <tesseract_common/types.h>
 #include <tesseract_geometry/impl/mesh.h>
 #include <tesseract_geometry/impl/convex_mesh.h>
+#include <tesseract_collision/core/convex_decomposition_cache.h>
 
 namespace tesseract_collision
 {
@@ -52,6 +53,18 @@ int createConvexHull(tesseract_common::VectorVector3d& vertices,
 
 tesseract_geometry::ConvexMesh::Ptr makeConvexMesh(const tesseract_geometry::Mesh& mesh);
 
+/**
+ * @brief Create the convex hulls of multiple meshes concurrently
+ * @param meshes The meshes to create convex hulls from
+ * @param num_threads The number of threads to use, if zero the hardware concurrency is used
+ * @param cache An optional persistent cache, if provided a convex hull is only computed once for each mesh content
+ * @return The convex hull of each mesh in the same order as the input meshes
+ */
+std::vector<tesseract_geometry::ConvexMesh::Ptr>
+makeConvexMeshes(const std::vector<tesseract_geometry::Mesh::ConstPtr>& meshes,
+                 std::size_t num_threads = 0,
+                 const ConvexMeshCache::ConstPtr& cache = nullptr);
+
 }  // namespace tesseract_collision
 
 #endif  // TESSERACT_COLLISION_BULLET_CONVEX_HULL_UTILS_H
@@ -49,6 +49,8 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 namespace tesseract_collision::tesseract_collision_bullet
 {
+class BulletMeshBVHCache;
+
 struct TesseractCollisionConfigurationInfo : public btDefaultCollisionConstructionInfo
 {
   /**
@@ -64,6 +66,12 @@ struct TesseractCollisionConfigurationInfo : public btDefaultCollisionConstructi
   /** @brief Clone the collision configuration information */
   TesseractCollisionConfigurationInfo clone() const;
 
+  /**
+   * @brief If provided meshes use a BulletMeshShape instead of a compound of triangles
+   * @details The cache is shared amongst clones so the bounding volume hierarchy of a mesh is only built once
+   */
+  std::shared_ptr<BulletMeshBVHCache> mesh_bvh_cache;
+
 protected:
   bool share_pool_allocators_{ false };
   std::shared_ptr<btPoolAllocator> persistent_manifold_pool_;
@@ -77,12 +85,30 @@ protected:
  *     - Compound to Collision
  *     - Compound to Compound
  *     - Convex to Convex
+ *
+ * It also adds an algorithm for the BulletOctreeShape (CUSTOM_CONCAVE_SHAPE_TYPE) to any non compound shape. Compound
+ * shapes use the compound algorithms which dispatch each child against the octree. Pairs of triangle mesh shapes
+ * (TRIANGLE_MESH_SHAPE_PROXYTYPE), which Bullet does not support, use the TesseractTriangleMeshCollisionAlgorithm.
  */
 class TesseractCollisionConfiguration : public btDefaultCollisionConfiguration
 {
 public:
   TesseractCollisionConfiguration(
       const TesseractCollisionConfigurationInfo& config_info = TesseractCollisionConfigurationInfo());
+  ~TesseractCollisionConfiguration() override;
+  TesseractCollisionConfiguration(const TesseractCollisionConfiguration&) = delete;
+  TesseractCollisionConfiguration& operator=(const TesseractCollisionConfiguration&) = delete;
+  TesseractCollisionConfiguration(TesseractCollisionConfiguration&&) = delete;
+  TesseractCollisionConfiguration& operator=(TesseractCollisionConfiguration&&) = delete;
+
+  btCollisionAlgorithmCreateFunc* getCollisionAlgorithmCreateFunc(int proxyType0, int proxyType1) override;
+
+  btCollisionAlgorithmCreateFunc* getClosestPointsAlgorithmCreateFunc(int proxyType0, int proxyType1) override;
+
+protected:
+  btCollisionAlgorithmCreateFunc* m_octreeCreateFunc{ nullptr };
+  btCollisionAlgorithmCreateFunc* m_swappedOctreeCreateFunc{ nullptr };
+  btCollisionAlgorithmCreateFunc* m_triangleMeshCreateFunc{ nullptr };
 };
 }  // namespace tesseract_collision::tesseract_collision_bullet
 #endif  // TESSERACT_COLLISION_TESSERACT_COLLISION_CONFIGURATION_H
@@ -0,0 +1,102 @@
+/**
+ * @file tesseract_triangle_mesh_collision_algorithm.h
+ * @brief Bullet collision algorithm for pairs of triangle mesh shapes
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (BSD-2-Clause)
+ * @par
+ * All rights reserved.
+ * @par
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * @par
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ * @par
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef TESSERACT_COLLISION_TESSERACT_TRIANGLE_MESH_COLLISION_ALGORITHM_H
+#define TESSERACT_COLLISION_TESSERACT_TRIANGLE_MESH_COLLISION_ALGORITHM_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <BulletCollision/BroadphaseCollision/btDispatcher.h>
+#include <BulletCollision/CollisionDispatch/btActivatingCollisionAlgorithm.h>
+#include <BulletCollision/CollisionDispatch/btCollisionCreateFunc.h>
+#include <BulletCollision/NarrowPhaseCollision/btPersistentManifold.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+namespace tesseract_collision::tesseract_collision_bullet
+{
+/**
+ * @brief Supports collision between two triangle mesh shapes (TRIANGLE_MESH_SHAPE_PROXYTYPE)
+ *
+ * Bullet does not provide an algorithm for a pair of concave shapes. The AABB of the second mesh is transformed into
+ * the frame of the first mesh and each triangle of the first mesh overlapping it is checked against the second mesh
+ * using the convex concave algorithm, so both meshes are traversed using their bounding volume hierarchy.
+ */
+class TesseractTriangleMeshCollisionAlgorithm : public btActivatingCollisionAlgorithm  // NOLINT
+{
+public:
+  TesseractTriangleMeshCollisionAlgorithm(const btCollisionAlgorithmConstructionInfo& ci,
+                                          const btCollisionObjectWrapper* body0Wrap,
+                                          const btCollisionObjectWrapper* body1Wrap);
+
+  ~TesseractTriangleMeshCollisionAlgorithm() override = default;
+  TesseractTriangleMeshCollisionAlgorithm(const TesseractTriangleMeshCollisionAlgorithm&) = default;
+  TesseractTriangleMeshCollisionAlgorithm& operator=(const TesseractTriangleMeshCollisionAlgorithm&) = default;
+  TesseractTriangleMeshCollisionAlgorithm(TesseractTriangleMeshCollisionAlgorithm&&) = default;
+  TesseractTriangleMeshCollisionAlgorithm& operator=(TesseractTriangleMeshCollisionAlgorithm&&) = default;
+
+  void processCollision(const btCollisionObjectWrapper* body0Wrap,
+                        const btCollisionObjectWrapper* body1Wrap,
+                        const btDispatcherInfo& dispatchInfo,
+                        btManifoldResult* resultOut) override;
+
+  btScalar calculateTimeOfImpact(btCollisionObject* body0,
+                                 btCollisionObject* body1,
+                                 const btDispatcherInfo& dispatchInfo,
+                                 btManifoldResult* resultOut) override;
+
+  /** @brief The triangle algorithm only lives for a single call to processCollision so there are no manifolds */
+  void getAllContactManifolds(btManifoldArray& /*manifoldArray*/) override {}
+
+  struct CreateFunc : public btCollisionAlgorithmCreateFunc
+  {
+    btCollisionAlgorithm* CreateCollisionAlgorithm(btCollisionAlgorithmConstructionInfo& ci,
+                                                   const btCollisionObjectWrapper* body0Wrap,
+                                                   const btCollisionObjectWrapper* body1Wrap) override
+    {
+      void* mem = ci.m_dispatcher1->allocateCollisionAlgorithm(sizeof(TesseractTriangleMeshCollisionAlgorithm));
+      return new (mem) TesseractTriangleMeshCollisionAlgorithm(ci, body0Wrap, body1Wrap);
+    }
+  };
+
+protected:
+  btPersistentManifold* m_sharedManifold;
+};
+}  // namespace tesseract_collision::tesseract_collision_bullet
+#endif  // TESSERACT_COLLISION_TESSERACT_TRIANGLE_MESH_COLLISION_ALGORITHM_H
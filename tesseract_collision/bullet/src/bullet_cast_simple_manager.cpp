@@ -40,6 +40,7 @@
  */
 
 #include "tesseract_collision/bullet/bullet_cast_simple_manager.h"
+#include <tesseract_common/metrics.h>
 
 namespace tesseract_collision::tesseract_collision_bullet
 {
@@ -98,7 +99,7 @@ bool BulletCastSimpleManager::addCollisionObject(const std::string& name,
   if (link2cow_.find(name) != link2cow_.end())
     removeCollisionObject(name);
 
-  COW::Ptr new_cow = createCollisionObject(name, mask_id, shapes, shape_poses, enabled);
+  COW::Ptr new_cow = createCollisionObject(name, mask_id, shapes, shape_poses, enabled, config_info_.mesh_bvh_cache);
   if (new_cow != nullptr)
   {
     auto margin = static_cast<btScalar>(contact_test_data_.collision_margin_data.getMaxCollisionMargin());
@@ -225,54 +226,9 @@ void BulletCastSimpleManager::setCollisionObjectsTransform(const std::string& na
     cow->setWorldTransform(tf1);
     link2cow_[name]->setWorldTransform(tf1);
 
-    // If collision object is disabled dont proceed
-    if (cow->m_enabled)
-    {
-      if (btBroadphaseProxy::isConvex(cow->getCollisionShape()->getShapeType()))
-      {
-        assert(dynamic_cast<CastHullShape*>(cow->getCollisionShape()) != nullptr);
-        static_cast<CastHullShape*>(cow->getCollisionShape())->updateCastTransform(tf1.inverseTimes(tf2));
-      }
-      else if (btBroadphaseProxy::isCompound(cow->getCollisionShape()->getShapeType()))
-      {
-        assert(dynamic_cast<btCompoundShape*>(cow->getCollisionShape()) != nullptr);
-        auto* compound = static_cast<btCompoundShape*>(cow->getCollisionShape());
-        for (int i = 0; i < compound->getNumChildShapes(); ++i)
-        {
-          if (btBroadphaseProxy::isConvex(compound->getChildShape(i)->getShapeType()))
-          {
-            assert(dynamic_cast<CastHullShape*>(compound->getChildShape(i)) != nullptr);
-            const btTransform& local_tf = compound->getChildTransform(i);
-
-            btTransform delta_tf = (tf1 * local_tf).inverseTimes(tf2 * local_tf);
-            static_cast<CastHullShape*>(compound->getChildShape(i))->updateCastTransform(delta_tf);
-            compound->updateChildTransform(i, local_tf, false);  // This is required to update the BVH tree
-          }
-          else if (btBroadphaseProxy::isCompound(compound->getChildShape(i)->getShapeType()))
-          {
-            assert(dynamic_cast<btCompoundShape*>(compound->getChildShape(i)) != nullptr);
-            auto* second_compound = static_cast<btCompoundShape*>(compound->getChildShape(i));
-
-            for (int j = 0; j < second_compound->getNumChildShapes(); ++j)
-            {
-              assert(!btBroadphaseProxy::isCompound(second_compound->getChildShape(j)->getShapeType()));
-              assert(dynamic_cast<CastHullShape*>(second_compound->getChildShape(j)) != nullptr);
-              const btTransform& local_tf = second_compound->getChildTransform(j);
-
-              btTransform delta_tf = (tf1 * local_tf).inverseTimes(tf2 * local_tf);
-              static_cast<CastHullShape*>(second_compound->getChildShape(j))->updateCastTransform(delta_tf);
-              second_compound->updateChildTransform(j, local_tf, false);  // This is required to update the BVH tree
-            }
-            second_compound->recalculateLocalAabb();
-          }
-        }
-        compound->recalculateLocalAabb();
-      }
-      else
-      {
-        throw std::runtime_error("I can only collision check convex shapes and compound shapes made of convex shapes");
-      }
-    }
+    // The cast shapes read this when they are used so they do not need to be updated individually
+    assert(cow->m_cast_transform != nullptr);
+    cow->m_cast_transform->setTransform(tf1.inverseTimes(tf2));
   }
 }
 
@@ -368,6 +324,7 @@ void BulletCastSimpleManager::setIsContactAllowedFn(IsContactAllowedFn fn) { con
 IsContactAllowedFn BulletCastSimpleManager::getIsContactAllowedFn() const { return contact_test_data_.fn; }
 void BulletCastSimpleManager::contactTest(ContactResultMap& collisions, const ContactRequest& request)
 {
+  TESSERACT_COMMON_METRICS_SCOPE("BulletCastSimpleManager::contactTest");
   contact_test_data_.res = &collisions;
   contact_test_data_.req = request;
   contact_test_data_.done = false;
@@ -401,6 +358,7 @@ void BulletCastSimpleManager::contactTest(ContactResultMap& collisions, const Co
 
       if (aabb_check)
       {
+        TESSERACT_COMMON_METRICS_COUNT("tesseract_collision::broadphase_pairs", 1);
         bool needs_collision = needsCollisionCheck(*cow1, *cow2, contact_test_data_.fn, false);
 
         if (needs_collision)
@@ -417,6 +375,7 @@ void BulletCastSimpleManager::contactTest(ContactResultMap& collisions, const Co
             contactPointResult.m_closestPointDistanceThreshold = cc.m_closestDistanceThreshold;
 
             // discrete collision detection query
+            TESSERACT_COMMON_METRICS_COUNT("tesseract_collision::narrowphase_calls", 1);
             algorithm->processCollision(&obA, &obB, dispatch_info_, &contactPointResult);
 
             algorithm->~btCollisionAlgorithm();
@@ -40,6 +40,7 @@
  */
 
 #include <tesseract_collision/bullet/bullet_discrete_bvh_manager.h>
+#include <tesseract_common/metrics.h>
 
 extern btScalar gDbvtMargin;  // NOLINT
 
@@ -114,7 +115,7 @@ bool BulletDiscreteBVHManager::addCollisionObject(const std::string& name,
   if (link2cow_.find(name) != link2cow_.end())
     removeCollisionObject(name);
 
-  COW::Ptr new_cow = createCollisionObject(name, mask_id, shapes, shape_poses, enabled);
+  COW::Ptr new_cow = createCollisionObject(name, mask_id, shapes, shape_poses, enabled, config_info_.mesh_bvh_cache);
   if (new_cow != nullptr)
   {
     auto margin = static_cast<btScalar>(contact_test_data_.collision_margin_data.getMaxCollisionMargin());
@@ -153,6 +154,7 @@ bool BulletDiscreteBVHManager::removeCollisionObject(const std::string& name)
   {
     collision_objects_.erase(std::find(collision_objects_.begin(), collision_objects_.end(), name));
     removeCollisionObjectFromBroadphase(it->second, broadphase_, dispatcher_);
+    pair_cache_.remove(it->second.get(), dispatcher_.get());
     link2cow_.erase(name);
     return true;
   }
@@ -276,6 +278,7 @@ void BulletDiscreteBVHManager::setIsContactAllowedFn(IsContactAllowedFn fn) { co
 IsContactAllowedFn BulletDiscreteBVHManager::getIsContactAllowedFn() const { return contact_test_data_.fn; }
 void BulletDiscreteBVHManager::contactTest(ContactResultMap& collisions, const ContactRequest& request)
 {
+  TESSERACT_COMMON_METRICS_SCOPE("BulletDiscreteBVHManager::contactTest");
   contact_test_data_.res = &collisions;
   contact_test_data_.req = request;
   contact_test_data_.done = false;
@@ -287,7 +290,7 @@ void BulletDiscreteBVHManager::contactTest(ContactResultMap& collisions, const C
   DiscreteBroadphaseContactResultCallback cc(contact_test_data_,
                                              contact_test_data_.collision_margin_data.getMaxCollisionMargin());
 
-  TesseractCollisionPairCallback collisionCallback(dispatch_info_, dispatcher_.get(), cc);
+  TesseractCollisionPairCallback collisionCallback(dispatch_info_, dispatcher_.get(), cc, &pair_cache_);
 
   pairCache->processAllOverlappingPairs(&collisionCallback, dispatcher_.get());
 }
@@ -40,6 +40,7 @@
  */
 
 #include "tesseract_collision/bullet/bullet_discrete_simple_manager.h"
+#include <tesseract_common/metrics.h>
 
 namespace tesseract_collision::tesseract_collision_bullet
 {
@@ -63,6 +64,8 @@ BulletDiscreteSimpleManager::BulletDiscreteSimpleManager(std::string name,
   contact_test_data_.collision_margin_data = CollisionMarginData(0);
 }
 
+BulletDiscreteSimpleManager::~BulletDiscreteSimpleManager() { pair_cache_.clear(dispatcher_.get()); }
+
 std::string BulletDiscreteSimpleManager::getName() const { return name_; }
 
 DiscreteContactManager::UPtr BulletDiscreteSimpleManager::clone() const
@@ -100,7 +103,7 @@ bool BulletDiscreteSimpleManager::addCollisionObject(const std::string& name,
   if (link2cow_.find(name) != link2cow_.end())
     removeCollisionObject(name);
 
-  COW::Ptr new_cow = createCollisionObject(name, mask_id, shapes, shape_poses, enabled);
+  COW::Ptr new_cow = createCollisionObject(name, mask_id, shapes, shape_poses, enabled, config_info_.mesh_bvh_cache);
   if (new_cow != nullptr)
   {
     auto margin = static_cast<btScalar>(contact_test_data_.collision_margin_data.getMaxCollisionMargin());
@@ -137,6 +140,7 @@ bool BulletDiscreteSimpleManager::removeCollisionObject(const std::string& name)
   auto it = link2cow_.find(name);
   if (it != link2cow_.end())
   {
+    pair_cache_.remove(it->second.get(), dispatcher_.get());
     cows_.erase(std::find(cows_.begin(), cows_.end(), it->second));
     collision_objects_.erase(std::find(collision_objects_.begin(), collision_objects_.end(), name));
     link2cow_.erase(name);
@@ -254,6 +258,7 @@ void BulletDiscreteSimpleManager::setIsContactAllowedFn(IsContactAllowedFn fn) {
 IsContactAllowedFn BulletDiscreteSimpleManager::getIsContactAllowedFn() const { return contact_test_data_.fn; }
 void BulletDiscreteSimpleManager::contactTest(ContactResultMap& collisions, const ContactRequest& request)
 {
+  TESSERACT_COMMON_METRICS_SCOPE("BulletDiscreteSimpleManager::contactTest");
   contact_test_data_.res = &collisions;
   contact_test_data_.req = request;
   contact_test_data_.done = false;
@@ -287,26 +292,36 @@ void BulletDiscreteSimpleManager::contactTest(ContactResultMap& collisions, cons
 
       if (aabb_check)
       {
+        TESSERACT_COMMON_METRICS_COUNT("tesseract_collision::broadphase_pairs", 1);
         bool needs_collision = needsCollisionCheck(*cow1, *cow2, contact_test_data_.fn, false);
 
         if (needs_collision)
         {
+          CollisionPairCache::Entry& entry = pair_cache_.getEntry(*cow1, *cow2);
+          if (pair_cache_.canSkip(entry, cc.m_closestDistanceThreshold))
+            continue;
+
           btCollisionObjectWrapper obB(
               nullptr, cow2->getCollisionShape(), cow2.get(), cow2->getWorldTransform(), -1, -1);
 
-          btCollisionAlgorithm* algorithm =
-              dispatcher_->findAlgorithm(&obA, &obB, nullptr, BT_CLOSEST_POINT_ALGORITHMS);
+          // the pair cache keeps algorithms persistent between contact tests
+          btCollisionAlgorithm* algorithm = CollisionPairCache::getAlgorithm(entry, &obA, &obB, dispatcher_.get());
           assert(algorithm != nullptr);
           if (algorithm != nullptr)
           {
             TesseractBridgedManifoldResult contactPointResult(&obA, &obB, cc);
-            contactPointResult.m_closestPointDistanceThreshold = cc.m_closestDistanceThreshold;
+            contactPointResult.m_closestPointDistanceThreshold =
+                cc.m_closestDistanceThreshold + pair_cache_.getDistancePadding();
 
             // discrete collision detection query
+            TESSERACT_COMMON_METRICS_COUNT("tesseract_collision::narrowphase_calls", 1);
             algorithm->processCollision(&obA, &obB, dispatch_info_, &contactPointResult);
 
-            algorithm->~btCollisionAlgorithm();
-            dispatcher_->freeCollisionAlgorithm(algorithm);
+            // If the search was terminated early not all contacts were processed so the separation is unknown
+            if (contact_test_data_.done)
+              CollisionPairCache::invalidate(entry);
+            else
+              pair_cache_.update(entry, cc.m_closestDistanceThreshold, contactPointResult.m_minDistance);
           }
         }
       }
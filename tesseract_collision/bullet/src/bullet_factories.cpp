@@ -34,6 +34,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract_collision/bullet/bullet_cast_simple_manager.h>
 #include <tesseract_collision/bullet/bullet_discrete_bvh_manager.h>
 #include <tesseract_collision/bullet/bullet_discrete_simple_manager.h>
+#include <tesseract_collision/bullet/bullet_utils.h>
 #include <tesseract_collision/bullet/tesseract_collision_configuration.h>
 
 namespace tesseract_collision::tesseract_collision_bullet
@@ -55,6 +56,18 @@ TesseractCollisionConfigurationInfo getConfigInfo(const YAML::Node& config)
   if (YAML::Node n = config["max_collision_algorithm_pool_size"])
     config_info.m_defaultMaxCollisionAlgorithmPoolSize = n.as<int>();
 
+  if (YAML::Node n = config["mesh_bvh"])
+  {
+    if (n.as<bool>())
+    {
+      std::string directory;
+      if (YAML::Node d = config["mesh_bvh_directory"])
+        directory = d.as<std::string>();
+
+      config_info.mesh_bvh_cache = std::make_shared<BulletMeshBVHCache>(directory);
+    }
+  }
+
   config_info.createPoolAllocators();
   return config_info;
 }
@@ -44,15 +44,23 @@
 #include "tesseract_collision/bullet/bullet_utils.h"
 
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <LinearMath/btAabbUtil2.h>
 #include <LinearMath/btConvexHullComputer.h>
 #include <BulletCollision/CollisionDispatch/btConvexConvexAlgorithm.h>
 #include <BulletCollision/CollisionShapes/btShapeHull.h>
 #include <BulletCollision/Gimpact/btTriangleShapeEx.h>
+#include <algorithm>
 #include <boost/thread/mutex.hpp>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
 #include <memory>
+#include <sstream>
 #include <octomap/octomap.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
+#include <tesseract_common/metrics.h>
+#include <tesseract_common/utils.h>
 #include <tesseract_geometry/geometries.h>
 
 namespace tesseract_collision::tesseract_collision_bullet
@@ -190,6 +198,31 @@ std::shared_ptr<btCollisionShape> createShapePrimitive(const tesseract_geometry:
   return nullptr;
 }
 
+std::shared_ptr<btCollisionShape> createShapePrimitive(const tesseract_geometry::Mesh::ConstPtr& geom,
+                                                       BulletMeshBVHCache& mesh_bvh_cache)
+{
+  if (geom->getVertexCount() > 0 && geom->getFaceCount() > 0)
+    return std::make_shared<BulletMeshShape>(mesh_bvh_cache.get(geom));
+
+  CONSOLE_BRIDGE_logError("The mesh is empty!");
+  return nullptr;
+}
+
+std::shared_ptr<btCollisionShape> createShapePrimitive(const tesseract_geometry::CompactMesh::ConstPtr& geom,
+                                                       BulletMeshBVHCache* mesh_bvh_cache)
+{
+  if (geom->getVertexCount() > 0 && geom->getTriangleCount() > 0)
+  {
+    if (mesh_bvh_cache != nullptr)
+      return std::make_shared<BulletMeshShape>(mesh_bvh_cache->get(geom));
+
+    return std::make_shared<BulletMeshShape>(std::make_shared<const BulletMeshBVH>(geom));
+  }
+
+  CONSOLE_BRIDGE_logError("The mesh is empty!");
+  return nullptr;
+}
+
 std::shared_ptr<btCollisionShape> createShapePrimitive(const tesseract_geometry::ConvexMesh::ConstPtr& geom)
 {
   int vertice_count = geom->getVertexCount();
@@ -210,123 +243,15 @@ std::shared_ptr<btCollisionShape> createShapePrimitive(const tesseract_geometry:
 }
 
 std::shared_ptr<btCollisionShape> createShapePrimitive(const tesseract_geometry::Octree::ConstPtr& geom,
-                                                       CollisionObjectWrapper* cow,
                                                        int shape_index)
 {
-  const octomap::OcTree& octree = *(geom->getOctree());
-  auto subshape = std::make_shared<btCompoundShape>(BULLET_COMPOUND_USE_DYNAMIC_AABB, static_cast<int>(octree.size()));
-  double occupancy_threshold = octree.getOccupancyThres();
-
-  std::vector<std::shared_ptr<btCollisionShape>> managed_shapes;
-  managed_shapes.resize(octree.getTreeDepth() + 1);
   switch (geom->getSubType())
   {
     case tesseract_geometry::Octree::SubType::BOX:
-    {
-      for (auto it = octree.begin(static_cast<unsigned char>(octree.getTreeDepth())), end = octree.end(); it != end;
-           ++it)
-      {
-        if (it->getOccupancy() >= occupancy_threshold)
-        {
-          double size = it.getSize();
-          btTransform geomTrans;
-          geomTrans.setIdentity();
-          geomTrans.setOrigin(btVector3(
-              static_cast<btScalar>(it.getX()), static_cast<btScalar>(it.getY()), static_cast<btScalar>(it.getZ())));
-          auto l = static_cast<btScalar>(size / 2.0);
-
-          std::shared_ptr<btCollisionShape> childshape = managed_shapes.at(it.getDepth());
-          if (childshape == nullptr)
-          {
-            childshape = std::make_shared<btBoxShape>(btVector3(l, l, l));
-            childshape->setUserIndex(shape_index);
-            childshape->setMargin(BULLET_MARGIN);
-            managed_shapes.at(it.getDepth()) = childshape;
-          }
-
-          subshape->addChildShape(geomTrans, childshape.get());
-        }
-      }
-
-      cow->manageReserve(managed_shapes.size());
-      for (const auto& managed_shape : managed_shapes)
-      {
-        if (managed_shape != nullptr)
-          cow->manage(managed_shape);
-      }
-
-      return subshape;
-    }
     case tesseract_geometry::Octree::SubType::SPHERE_INSIDE:
-    {
-      for (auto it = octree.begin(static_cast<unsigned char>(octree.getTreeDepth())), end = octree.end(); it != end;
-           ++it)
-      {
-        if (it->getOccupancy() >= occupancy_threshold)
-        {
-          double size = it.getSize();
-          btTransform geomTrans;
-          geomTrans.setIdentity();
-          geomTrans.setOrigin(btVector3(
-              static_cast<btScalar>(it.getX()), static_cast<btScalar>(it.getY()), static_cast<btScalar>(it.getZ())));
-
-          std::shared_ptr<btCollisionShape> childshape = managed_shapes.at(it.getDepth());
-          if (childshape == nullptr)
-          {
-            childshape = std::make_shared<btSphereShape>(static_cast<btScalar>((size / 2)));
-            childshape->setUserIndex(shape_index);
-            // Sphere is a special case where you do not modify the margin which is internally set to the radius
-            managed_shapes.at(it.getDepth()) = childshape;
-          }
-
-          subshape->addChildShape(geomTrans, childshape.get());
-        }
-      }
-
-      cow->manageReserve(managed_shapes.size());
-      for (const auto& managed_shape : managed_shapes)
-      {
-        if (managed_shape != nullptr)
-          cow->manage(managed_shape);
-      }
-
-      return subshape;
-    }
     case tesseract_geometry::Octree::SubType::SPHERE_OUTSIDE:
     {
-      for (auto it = octree.begin(static_cast<unsigned char>(octree.getTreeDepth())), end = octree.end(); it != end;
-           ++it)
-      {
-        if (it->getOccupancy() >= occupancy_threshold)
-        {
-          double size = it.getSize();
-          btTransform geomTrans;
-          geomTrans.setIdentity();
-          geomTrans.setOrigin(btVector3(
-              static_cast<btScalar>(it.getX()), static_cast<btScalar>(it.getY()), static_cast<btScalar>(it.getZ())));
-
-          std::shared_ptr<btCollisionShape> childshape = managed_shapes.at(it.getDepth());
-          if (childshape == nullptr)
-          {
-            childshape =
-                std::make_shared<btSphereShape>(static_cast<btScalar>(std::sqrt(2 * ((size / 2) * (size / 2)))));
-            childshape->setUserIndex(shape_index);
-            // Sphere is a special case where you do not modify the margin which is internally set to the radius
-            managed_shapes.at(it.getDepth()) = childshape;
-          }
-
-          subshape->addChildShape(geomTrans, childshape.get());
-        }
-      }
-
-      cow->manageReserve(managed_shapes.size());
-      for (const auto& managed_shape : managed_shapes)
-      {
-        if (managed_shape != nullptr)
-          cow->manage(managed_shape);
-      }
-
-      return subshape;
+      return std::make_shared<BulletOctreeShape>(geom->getOctree(), geom->getSubType(), shape_index);
     }
   }
 
@@ -337,7 +262,8 @@ std::shared_ptr<btCollisionShape> createShapePrimitive(const tesseract_geometry:
 
 std::shared_ptr<btCollisionShape> createShapePrimitive(const CollisionShapeConstPtr& geom,
                                                        CollisionObjectWrapper* cow,
-                                                       int shape_index)
+                                                       int shape_index,
+                                                       const BulletMeshBVHCache::Ptr& mesh_bvh_cache)
 {
   std::shared_ptr<btCollisionShape> shape = nullptr;
 
@@ -380,7 +306,11 @@ std::shared_ptr<btCollisionShape> createShapePrimitive(const CollisionShapeConst
     }
     case tesseract_geometry::GeometryType::MESH:
     {
-      shape = createShapePrimitive(std::static_pointer_cast<const tesseract_geometry::Mesh>(geom), cow, shape_index);
+      if (mesh_bvh_cache != nullptr)
+        shape = createShapePrimitive(std::static_pointer_cast<const tesseract_geometry::Mesh>(geom), *mesh_bvh_cache);
+      else
+        shape =
+            createShapePrimitive(std::static_pointer_cast<const tesseract_geometry::Mesh>(geom), cow, shape_index);
       shape->setUserIndex(shape_index);
       shape->setMargin(BULLET_MARGIN);
       break;
@@ -392,9 +322,17 @@ std::shared_ptr<btCollisionShape> createShapePrimitive(const CollisionShapeConst
       shape->setMargin(BULLET_MARGIN);
       break;
     }
+    case tesseract_geometry::GeometryType::COMPACT_MESH:
+    {
+      shape = createShapePrimitive(std::static_pointer_cast<const tesseract_geometry::CompactMesh>(geom),
+                                   mesh_bvh_cache.get());
+      shape->setUserIndex(shape_index);
+      shape->setMargin(BULLET_MARGIN);
+      break;
+    }
     case tesseract_geometry::GeometryType::OCTREE:
     {
-      shape = createShapePrimitive(std::static_pointer_cast<const tesseract_geometry::Octree>(geom), cow, shape_index);
+      shape = createShapePrimitive(std::static_pointer_cast<const tesseract_geometry::Octree>(geom), shape_index);
       shape->setUserIndex(shape_index);
       shape->setMargin(BULLET_MARGIN);
       break;
@@ -434,7 +372,8 @@ void updateCollisionObjectFilters(const std::vector<std::string>& active, const
 CollisionObjectWrapper::CollisionObjectWrapper(std::string name,
                                                const int& type_id,
                                                CollisionShapesConst shapes,
-                                               tesseract_common::VectorIsometry3d shape_poses)
+                                               tesseract_common::VectorIsometry3d shape_poses,
+                                               const std::shared_ptr<BulletMeshBVHCache>& mesh_bvh_cache)
   : m_name(std::move(name)), m_type_id(type_id), m_shapes(std::move(shapes)), m_shape_poses(std::move(shape_poses))
 {
   assert(!m_shapes.empty());
@@ -447,7 +386,7 @@ CollisionObjectWrapper::CollisionObjectWrapper(std::string name,
 
   if (m_shapes.size() == 1 && m_shape_poses[0].matrix().isIdentity())
   {
-    std::shared_ptr<btCollisionShape> shape = createShapePrimitive(m_shapes[0], this, 0);
+    std::shared_ptr<btCollisionShape> shape = createShapePrimitive(m_shapes[0], this, 0, mesh_bvh_cache);
     manage(shape);
     setCollisionShape(shape.get());
   }
@@ -463,7 +402,8 @@ CollisionObjectWrapper::CollisionObjectWrapper(std::string name,
 
     for (std::size_t j = 0; j < m_shapes.size(); ++j)
     {
-      std::shared_ptr<btCollisionShape> subshape = createShapePrimitive(m_shapes[j], this, static_cast<int>(j));
+      std::shared_ptr<btCollisionShape> subshape =
+          createShapePrimitive(m_shapes[j], this, static_cast<int>(j), mesh_bvh_cache);
       if (subshape != nullptr)
       {
         manage(subshape);
@@ -522,6 +462,7 @@ std::shared_ptr<CollisionObjectWrapper> CollisionObjectWrapper::clone()
   clone_cow->m_collisionFilterGroup = m_collisionFilterGroup;
   clone_cow->m_collisionFilterMask = m_collisionFilterMask;
   clone_cow->m_enabled = m_enabled;
+  clone_cow->m_cast_transform = m_cast_transform;
   clone_cow->setBroadphaseHandle(nullptr);
   return clone_cow;
 }
@@ -530,17 +471,56 @@ void CollisionObjectWrapper::manage(const std::shared_ptr<btCollisionShape>& t)
 
 void CollisionObjectWrapper::manageReserve(std::size_t s) { m_data.reserve(s); }
 
+void CastTransform::setTransform(const btTransform& t01)
+{
+  t01_ = t01;
+  ++revision_;
+}
+
+const btTransform& CastTransform::getTransform() const { return t01_; }
+
+btTransform CastTransform::getTransform(const btTransform& local_tf) const
+{
+  return local_tf.inverseTimes(t01_ * local_tf);
+}
+
+std::size_t CastTransform::getRevision() const { return revision_; }
+
 CastHullShape::CastHullShape(btConvexShape* shape, const btTransform& t01) : m_shape(shape), m_t01(t01)
 {
   m_shapeType = CUSTOM_CONVEX_SHAPE_TYPE;
   setUserIndex(m_shape->getUserIndex());
 }
 
+CastHullShape::CastHullShape(btConvexShape* shape, CastTransform::ConstPtr cast_transform, const btTransform& local_tf)
+  : m_shape(shape)
+  , m_t01(cast_transform->getTransform(local_tf))
+  , m_cast_transform(std::move(cast_transform))
+  , m_local_tf(local_tf)
+  , m_cast_revision(m_cast_transform->getRevision())
+{
+  m_shapeType = CUSTOM_CONVEX_SHAPE_TYPE;
+  setUserIndex(m_shape->getUserIndex());
+}
+
 void CastHullShape::updateCastTransform(const btTransform& t01) { m_t01 = t01; }
+
+const btTransform& CastHullShape::getCastTransform() const
+{
+  if (m_cast_transform != nullptr && m_cast_revision != m_cast_transform->getRevision())
+  {
+    m_t01 = m_cast_transform->getTransform(m_local_tf);
+    m_cast_revision = m_cast_transform->getRevision();
+  }
+
+  return m_t01;
+}
+
 btVector3 CastHullShape::localGetSupportingVertex(const btVector3& vec) const
 {
+  const btTransform& t01 = getCastTransform();
   btVector3 sv0 = m_shape->localGetSupportingVertex(vec);
-  btVector3 sv1 = m_t01 * m_shape->localGetSupportingVertex(vec * m_t01.getBasis());
+  btVector3 sv1 = t01 * m_shape->localGetSupportingVertex(vec * t01.getBasis());
   return (vec.dot(sv0) > vec.dot(sv1)) ? sv0 : sv1;
 }
 
@@ -549,7 +529,7 @@ void CastHullShape::getAabb(const btTransform& t_w0, btVector3& aabbMin, btVecto
 {
   m_shape->getAabb(t_w0, aabbMin, aabbMax);
   btVector3 min1, max1;
-  m_shape->getAabb(t_w0 * m_t01, min1, max1);
+  m_shape->getAabb(t_w0 * getCastTransform(), min1, max1);
   aabbMin.setMin(min1);
   aabbMax.setMax(max1);
 }
@@ -611,6 +591,499 @@ void CastHullShape::calculateLocalInertia(btScalar, btVector3&) const
                            "function, then review commit history to determine what change.");
 }
 
+CastCompoundShape::CastCompoundShape(CastTransform::ConstPtr cast_transform,
+                                     const btTransform& local_tf,
+                                     int initial_child_capacity)
+  : btCompoundShape(false, initial_child_capacity)
+  , m_cast_transform(std::move(cast_transform))
+  , m_local_tf(local_tf)
+  , m_t01(m_cast_transform->getTransform(local_tf))
+  , m_cast_revision(m_cast_transform->getRevision())
+{
+}
+
+void CastCompoundShape::getAabb(const btTransform& t, btVector3& aabbMin, btVector3& aabbMax) const
+{
+  btCompoundShape::getAabb(t, aabbMin, aabbMax);
+  btVector3 min1, max1;
+  btCompoundShape::getAabb(t * getCastTransform(), min1, max1);
+  aabbMin.setMin(min1);
+  aabbMax.setMax(max1);
+}
+
+const char* CastCompoundShape::getName() const { return "CastCompound"; }
+
+const btTransform& CastCompoundShape::getCastTransform() const
+{
+  if (m_cast_revision != m_cast_transform->getRevision())
+  {
+    m_t01 = m_cast_transform->getTransform(m_local_tf);
+    m_cast_revision = m_cast_transform->getRevision();
+  }
+
+  return m_t01;
+}
+
+BulletOctreeShape::BulletOctreeShape(std::shared_ptr<const octomap::OcTree> octree,
+                                     tesseract_geometry::Octree::SubType sub_type,
+                                     int shape_index)
+  : octree_(std::move(octree))
+  , sub_type_(sub_type)
+  , occupancy_threshold_(octree_->getOccupancyThres())
+  , tree_max_val_(static_cast<octomap::key_type>(1U << (octree_->getTreeDepth() - 1)))
+{
+  m_shapeType = CUSTOM_CONCAVE_SHAPE_TYPE;
+  setUserIndex(shape_index);
+
+  voxel_shapes_.resize(octree_->getTreeDepth() + 1);
+  for (unsigned depth = 0; depth < voxel_shapes_.size(); ++depth)
+  {
+    double size = octree_->getNodeSize(depth);
+    switch (sub_type_)
+    {
+      case tesseract_geometry::Octree::SubType::BOX:
+      {
+        auto l = static_cast<btScalar>(size / 2.0);
+        voxel_shapes_[depth] = std::make_shared<btBoxShape>(btVector3(l, l, l));
+        voxel_shapes_[depth]->setMargin(BULLET_MARGIN);
+        break;
+      }
+      case tesseract_geometry::Octree::SubType::SPHERE_INSIDE:
+      {
+        // Sphere is a special case where you do not modify the margin which is internally set to the radius
+        voxel_shapes_[depth] = std::make_shared<btSphereShape>(static_cast<btScalar>((size / 2)));
+        break;
+      }
+      case tesseract_geometry::Octree::SubType::SPHERE_OUTSIDE:
+      {
+        // Sphere is a special case where you do not modify the margin which is internally set to the radius
+        voxel_shapes_[depth] =
+            std::make_shared<btSphereShape>(static_cast<btScalar>(std::sqrt(2 * ((size / 2) * (size / 2)))));
+        break;
+      }
+    }
+    voxel_shapes_[depth]->setUserIndex(shape_index);
+  }
+
+  // The spheres of SPHERE_OUTSIDE extend past the voxel so the node bounds must be enlarged to remain conservative
+  if (sub_type_ == tesseract_geometry::Octree::SubType::SPHERE_OUTSIDE)
+    bounds_scale_ = static_cast<btScalar>(std::sqrt(2.0));
+
+  // The local AABB only bounds the occupied voxels so free space does not inflate the broadphase AABB
+  bool empty{ true };
+  for (auto it = octree_->begin_leafs(), end = octree_->end_leafs(); it != end; ++it)
+  {
+    if (it->getOccupancy() < occupancy_threshold_)
+      continue;
+
+    auto half = static_cast<btScalar>(it.getSize() / 2.0) * bounds_scale_;
+    btVector3 center(
+        static_cast<btScalar>(it.getX()), static_cast<btScalar>(it.getY()), static_cast<btScalar>(it.getZ()));
+    btVector3 extents(half, half, half);
+    if (empty)
+    {
+      local_aabb_min_ = center - extents;
+      local_aabb_max_ = center + extents;
+      empty = false;
+    }
+    else
+    {
+      local_aabb_min_.setMin(center - extents);
+      local_aabb_max_.setMax(center + extents);
+    }
+  }
+}
+
+const octomap::OcTree& BulletOctreeShape::getOctree() const { return *octree_; }
+
+tesseract_geometry::Octree::SubType BulletOctreeShape::getSubType() const { return sub_type_; }
+
+btConvexShape* BulletOctreeShape::getVoxelShape(unsigned depth) const { return voxel_shapes_[depth].get(); }
+
+void BulletOctreeShape::processOverlappingVoxels(const btVector3& aabb_min,
+                                                 const btVector3& aabb_max,
+                                                 VoxelCallback& callback) const
+{
+  const octomap::OcTreeNode* root = octree_->getRoot();
+  if (root == nullptr)
+    return;
+
+  octomap::OcTreeKey root_key(tree_max_val_, tree_max_val_, tree_max_val_);
+  processNode(root, root_key, 0, aabb_min, aabb_max, callback);
+}
+
+bool BulletOctreeShape::processNode(const octomap::OcTreeNode* node,
+                                    const octomap::OcTreeKey& key,
+                                    unsigned depth,
+                                    const btVector3& aabb_min,
+                                    const btVector3& aabb_max,
+                                    VoxelCallback& callback) const
+{
+  // Inner nodes store the max occupancy of their children so an unoccupied node has no occupied descendants
+  if (node->getOccupancy() < occupancy_threshold_)
+    return true;
+
+  octomap::point3d c = octree_->keyToCoord(key, depth);
+  btVector3 center(static_cast<btScalar>(c.x()), static_cast<btScalar>(c.y()), static_cast<btScalar>(c.z()));
+  auto half = static_cast<btScalar>(octree_->getNodeSize(depth) / 2.0) * bounds_scale_;
+  btVector3 extents(half, half, half);
+  if (!TestAabbAgainstAabb2(center - extents, center + extents, aabb_min, aabb_max))
+    return true;
+
+  if (!octree_->nodeHasChildren(node))
+    return callback.processVoxel(center, depth);
+
+  octomap::OcTreeKey child_key;
+  auto center_offset_key = static_cast<octomap::key_type>(tree_max_val_ >> (depth + 1));
+  for (unsigned i = 0; i < 8; ++i)
+  {
+    if (!octree_->nodeChildExists(node, i))
+      continue;
+
+    octomap::computeChildKey(i, center_offset_key, key, child_key);
+    if (!processNode(octree_->getNodeChild(node, i), child_key, depth + 1, aabb_min, aabb_max, callback))
+      return false;
+  }
+
+  return true;
+}
+
+void BulletOctreeShape::getAabb(const btTransform& t, btVector3& aabbMin, btVector3& aabbMax) const
+{
+  btTransformAabb(local_aabb_min_, local_aabb_max_, getMargin(), t, aabbMin, aabbMax);
+}
+
+const char* BulletOctreeShape::getName() const { return "Octree"; }
+
+// LCOV_EXCL_START
+void BulletOctreeShape::processAllTriangles(btTriangleCallback* /*callback*/,
+                                            const btVector3& /*aabbMin*/,
+                                            const btVector3& /*aabbMax*/) const
+{
+  throw std::runtime_error("BulletOctreeShape does not support triangle processing, collision checking is handled by "
+                           "the TesseractOctreeCollisionAlgorithm.");
+}
+
+void BulletOctreeShape::setLocalScaling(const btVector3& scaling) { local_scaling_ = scaling; }
+
+const btVector3& BulletOctreeShape::getLocalScaling() const { return local_scaling_; }
+
+void BulletOctreeShape::calculateLocalInertia(btScalar /*mass*/, btVector3& inertia) const
+{
+  inertia.setValue(btScalar(0), btScalar(0), btScalar(0));
+}
+// LCOV_EXCL_STOP
+
+namespace
+{
+/** @brief Identifies a serialized hierarchy, the version is incremented if the file layout changes */
+const std::string BULLET_MESH_BVH_FILE_ID = "bullet_mesh_bvh_2";
+
+/** @brief The hierarchy must be 16 byte aligned so the header is padded to a multiple of 16 bytes */
+std::size_t getBulletMeshBVHHeaderSize(std::size_t key_size)
+{
+  return ((sizeof(std::uint32_t) + key_size + 15) / 16) * 16;
+}
+
+/**
+ * @brief Create the key of a hierarchy
+ * @details The key starts with the file layout version, the precision of Bullet and the geometry type so hierarchies
+ * of different geometry types with the same bytes or created by a different layout never share a file
+ */
+std::string createBulletMeshBVHKey(const std::string& type,
+                                   const void* vertices,
+                                   std::size_t vertices_size,
+                                   const void* triangles,
+                                   std::size_t triangles_size,
+                                   int vertex_count,
+                                   int triangle_count)
+{
+  const std::uint64_t hash = tesseract_common::hashBytes(
+      triangles, triangles_size, tesseract_common::hashBytes(vertices, vertices_size));
+
+  // The sizes are included to further reduce the chance of a collision
+  std::stringstream ss;
+  ss << BULLET_MESH_BVH_FILE_ID << "_" << ((sizeof(btScalar) == sizeof(double)) ? "d" : "f") << "_" << type << "_"
+     << std::hex << std::setfill('0') << std::setw(16) << hash << std::dec << "_" << vertex_count << "_"
+     << triangle_count;
+  return ss.str();
+}
+}  // namespace
+
+BulletMeshBVH::BulletMeshBVH(tesseract_geometry::Mesh::ConstPtr mesh, const std::string& directory)
+  : geometry_(mesh), mesh_interface_(std::make_unique<btTriangleIndexVertexArray>())
+{
+  const tesseract_common::VectorVector3d& vertices = *mesh->getVertices();
+  const Eigen::VectorXi& faces = *mesh->getFaces();
+  key_ = createBulletMeshBVHKey("mesh",
+                                vertices.data(),
+                                vertices.size() * sizeof(Eigen::Vector3d),
+                                faces.data(),
+                                static_cast<std::size_t>(faces.size()) * sizeof(int),
+                                mesh->getVertexCount(),
+                                mesh->getFaceCount());
+
+  // A mesh only contains triangles, stored as the number of vertices followed by the vertex indices, so both the
+  // vertices and the indices are referenced directly using a stride
+  btIndexedMesh indexed_mesh;
+  indexed_mesh.m_numTriangles = mesh->getFaceCount();
+  indexed_mesh.m_triangleIndexBase = reinterpret_cast<const unsigned char*>(faces.data() + 1);  // NOLINT
+  indexed_mesh.m_triangleIndexStride = 4 * static_cast<int>(sizeof(int));
+  indexed_mesh.m_indexType = PHY_INTEGER;
+  indexed_mesh.m_numVertices = static_cast<int>(vertices.size());
+  indexed_mesh.m_vertexBase = reinterpret_cast<const unsigned char*>(vertices.data());  // NOLINT
+  indexed_mesh.m_vertexStride = static_cast<int>(sizeof(Eigen::Vector3d));
+  indexed_mesh.m_vertexType = PHY_DOUBLE;
+  init(indexed_mesh, directory);
+}
+
+BulletMeshBVH::BulletMeshBVH(tesseract_geometry::CompactMesh::ConstPtr mesh, const std::string& directory)
+  : geometry_(mesh), mesh_interface_(std::make_unique<btTriangleIndexVertexArray>())
+{
+  const std::vector<float>& vertices = *mesh->getVertices();
+  const std::vector<std::uint32_t>& triangles = *mesh->getTriangles();
+  key_ = createBulletMeshBVHKey("compact_mesh",
+                                vertices.data(),
+                                vertices.size() * sizeof(float),
+                                triangles.data(),
+                                triangles.size() * sizeof(std::uint32_t),
+                                mesh->getVertexCount(),
+                                mesh->getTriangleCount());
+
+  btIndexedMesh indexed_mesh;
+  indexed_mesh.m_numTriangles = mesh->getTriangleCount();
+  indexed_mesh.m_triangleIndexBase = reinterpret_cast<const unsigned char*>(triangles.data());  // NOLINT
+  indexed_mesh.m_triangleIndexStride = 3 * static_cast<int>(sizeof(std::uint32_t));
+  indexed_mesh.m_indexType = PHY_INTEGER;
+  indexed_mesh.m_numVertices = mesh->getVertexCount();
+  indexed_mesh.m_vertexBase = reinterpret_cast<const unsigned char*>(vertices.data());  // NOLINT
+  indexed_mesh.m_vertexStride = 3 * static_cast<int>(sizeof(float));
+  indexed_mesh.m_vertexType = PHY_FLOAT;
+  init(indexed_mesh, directory);
+}
+
+void BulletMeshBVH::init(const btIndexedMesh& indexed_mesh, const std::string& directory)
+{
+  mesh_interface_->addIndexedMesh(indexed_mesh, PHY_INTEGER);
+
+  // Shapes created for the mesh use the premade AABB instead of recalculating it from the triangles
+  btVector3 aabb_min, aabb_max;
+  mesh_interface_->calculateAabbBruteForce(aabb_min, aabb_max);
+  mesh_interface_->setPremadeAabb(aabb_min, aabb_max);
+
+  std::string filepath;
+  if (!directory.empty())
+    filepath = (tesseract_common::fs::path(directory) / (key_ + ".bvh")).string();
+
+  if (!filepath.empty() && load(filepath))
+    return;
+
+  bvh_ = new btOptimizedBvh();  // NOLINT(cppcoreguidelines-owning-memory)
+  bvh_->build(mesh_interface_.get(), true, aabb_min, aabb_max);
+
+  if (!filepath.empty())
+    save(filepath);
+}
+
+BulletMeshBVH::~BulletMeshBVH()
+{
+  if (buffer_ != nullptr)
+  {
+    // A loaded hierarchy is constructed in place and does not own its memory
+    bvh_->~btOptimizedBvh();
+    btAlignedFree(buffer_);
+  }
+  else
+  {
+    delete bvh_;  // NOLINT(cppcoreguidelines-owning-memory)
+  }
+}
+
+const tesseract_geometry::Geometry& BulletMeshBVH::getGeometry() const { return *geometry_; }
+
+const std::string& BulletMeshBVH::getKey() const { return key_; }
+
+btStridingMeshInterface* BulletMeshBVH::getMeshInterface() const { return mesh_interface_.get(); }
+
+btOptimizedBvh* BulletMeshBVH::getBVH() const { return bvh_; }
+
+bool BulletMeshBVH::isLoaded() const { return (buffer_ != nullptr); }
+
+bool BulletMeshBVH::save(const std::string& filepath) const
+{
+  const std::size_t header_size = getBulletMeshBVHHeaderSize(key_.size());
+  const unsigned bvh_size = bvh_->calculateSerializeBufferSize();
+
+  void* buffer = btAlignedAlloc(header_size + bvh_size, 16);
+  std::fill_n(static_cast<char*>(buffer), header_size, 0);
+  const auto key_size = static_cast<std::uint32_t>(key_.size());
+  std::memcpy(buffer, &key_size, sizeof(std::uint32_t));
+  std::memcpy(static_cast<char*>(buffer) + sizeof(std::uint32_t), key_.data(), key_.size());
+  bool success = bvh_->serializeInPlace(static_cast<char*>(buffer) + header_size, bvh_size, false);
+
+  // Write to a unique temporary file and rename so a partially written file is never loaded
+  const std::string tmp_path = tesseract_common::fs::unique_path(filepath + ".%%%%-%%%%-%%%%.tmp").string();
+  if (success)
+  {
+    std::ofstream file(tmp_path, std::ios::binary);
+    file.write(static_cast<const char*>(buffer), static_cast<std::streamsize>(header_size + bvh_size));
+    file.close();
+    success = !file.fail();
+  }
+  btAlignedFree(buffer);
+
+  boost::system::error_code ec;
+  if (success)
+    tesseract_common::fs::rename(tmp_path, filepath, ec);
+
+  if (!success || ec)
+  {
+    CONSOLE_BRIDGE_logWarn("BulletMeshBVH, failed to save '%s'", filepath.c_str());
+    tesseract_common::fs::remove(tmp_path, ec);
+    return false;
+  }
+
+  return true;
+}
+
+bool BulletMeshBVH::load(const std::string& filepath)
+{
+  std::ifstream file(filepath, std::ios::binary | std::ios::ate);
+  if (!file)
+    return false;
+
+  const auto size = static_cast<std::size_t>(file.tellg());
+  const std::size_t header_size = getBulletMeshBVHHeaderSize(key_.size());
+  if (size <= header_size)
+    return false;
+
+  void* buffer = btAlignedAlloc(size, 16);
+  file.seekg(0);
+  file.read(static_cast<char*>(buffer), static_cast<std::streamsize>(size));
+
+  std::uint32_t key_size{ 0 };
+  std::memcpy(&key_size, buffer, sizeof(std::uint32_t));
+  if (!file || key_size != key_.size() ||
+      key_.compare(0, key_.size(), static_cast<const char*>(buffer) + sizeof(std::uint32_t), key_size) != 0)
+  {
+    CONSOLE_BRIDGE_logDebug("BulletMeshBVH, the file '%s' does not match the mesh", filepath.c_str());
+    btAlignedFree(buffer);
+    return false;
+  }
+
+  btOptimizedBvh* bvh = btOptimizedBvh::deSerializeInPlace(
+      static_cast<char*>(buffer) + header_size, static_cast<unsigned>(size - header_size), false);
+  if (bvh == nullptr)
+  {
+    CONSOLE_BRIDGE_logWarn("BulletMeshBVH, failed to load '%s'", filepath.c_str());
+    btAlignedFree(buffer);
+    return false;
+  }
+
+  bvh_ = bvh;
+  buffer_ = buffer;
+  return true;
+}
+
+BulletMeshBVHCache::BulletMeshBVHCache(std::string directory) : directory_(std::move(directory))
+{
+  if (directory_.empty())
+    return;
+
+  boost::system::error_code ec;
+  tesseract_common::fs::create_directories(directory_, ec);
+  if (ec)
+    CONSOLE_BRIDGE_logError("BulletMeshBVHCache, failed to create directory '%s': %s",
+                            directory_.c_str(),
+                            ec.message().c_str());
+}
+
+const std::string& BulletMeshBVHCache::getDirectory() const { return directory_; }
+
+BulletMeshBVH::ConstPtr BulletMeshBVHCache::get(const tesseract_geometry::Mesh::ConstPtr& mesh)
+{
+  return get(std::make_pair(mesh->getVertices().get(), mesh->getFaces().get()),
+             [this, &mesh]() { return std::make_shared<const BulletMeshBVH>(mesh, directory_); });
+}
+
+BulletMeshBVH::ConstPtr BulletMeshBVHCache::get(const tesseract_geometry::CompactMesh::ConstPtr& mesh)
+{
+  return get(std::make_pair(mesh->getVertices().get(), mesh->getTriangles().get()),
+             [this, &mesh]() { return std::make_shared<const BulletMeshBVH>(mesh, directory_); });
+}
+
+BulletMeshBVH::ConstPtr BulletMeshBVHCache::get(const std::pair<const void*, const void*>& key,
+                                                const std::function<BulletMeshBVH::ConstPtr()>& create)
+{
+  std::promise<BulletMeshBVH::ConstPtr> promise;
+  std::shared_future<BulletMeshBVH::ConstPtr> pending;
+  {
+    std::scoped_lock lock(mutex_);
+
+    // An entry keeps the mesh buffers alive, so their address can not be reused while the entry is not expired
+    auto it = bvhs_.find(key);
+    if (it != bvhs_.end())
+    {
+      if (it->second.pending.valid())
+        pending = it->second.pending;
+      else if (BulletMeshBVH::ConstPtr bvh = it->second.bvh.lock())
+        return bvh;
+    }
+
+    if (!pending.valid())
+    {
+      // Expired entries are only pruned when inserting
+      for (auto e = bvhs_.begin(); e != bvhs_.end();)
+        e = (!e->second.pending.valid() && e->second.bvh.expired()) ? bvhs_.erase(e) : std::next(e);
+
+      bvhs_[key] = Entry{ {}, promise.get_future().share() };
+    }
+  }
+
+  // Another thread is creating the hierarchy, wait for it without holding the lock
+  if (pending.valid())
+    return pending.get();
+
+  // The hierarchy is created, possibly reading or writing the directory, without holding the lock
+  BulletMeshBVH::ConstPtr bvh;
+  try
+  {
+    bvh = create();
+  }
+  catch (...)
+  {
+    {
+      std::scoped_lock lock(mutex_);
+      bvhs_.erase(key);
+    }
+    promise.set_exception(std::current_exception());
+    throw;
+  }
+
+  {
+    // The entry only holds a weak reference once created so it expires when no collision shape references it
+    std::scoped_lock lock(mutex_);
+    bvhs_[key] = Entry{ bvh, {} };
+  }
+  promise.set_value(bvh);
+  return bvh;
+}
+
+std::size_t BulletMeshBVHCache::size() const
+{
+  std::scoped_lock lock(mutex_);
+  return static_cast<std::size_t>(
+      std::count_if(bvhs_.begin(), bvhs_.end(), [](const auto& e) { return !e.second.bvh.expired(); }));
+}
+
+BulletMeshShape::BulletMeshShape(BulletMeshBVH::ConstPtr bvh)
+  : btBvhTriangleMeshShape(bvh->getMeshInterface(), true, false), bvh_(std::move(bvh))
+{
+  setOptimizedBvh(bvh_->getBVH());
+}
+
+const BulletMeshBVH& BulletMeshShape::getMeshBVH() const { return *bvh_; }
+
 void GetAverageSupport(const btConvexShape* shape, const btVector3& localNormal, btScalar& outsupport, btVector3& outpt)
 {
   btVector3 ptSum(0, 0, 0);
@@ -671,6 +1144,16 @@ btTransform getLinkTransformFromCOW(const btCollisionObjectWrapper* cow)
   return cow->getWorldTransform();
 }
 
+int getShapeIndex(const btCollisionObjectWrapper* cow)
+{
+  // The triangles created while checking a triangle mesh shape do not have a shape index so the mesh index is used
+  const int shape_index = cow->getCollisionShape()->getUserIndex();
+  if (shape_index < 0 && cow->m_parent != nullptr)
+    return cow->m_parent->getCollisionShape()->getUserIndex();
+
+  return shape_index;
+}
+
 bool needsCollisionCheck(const COW& cow1, const COW& cow2, const IsContactAllowedFn& acm, bool verbose)
 {
   return cow1.m_enabled && cow2.m_enabled && (cow2.m_collisionFilterGroup & cow1.m_collisionFilterMask) &&  // NOLINT
@@ -702,29 +1185,49 @@ btScalar addDiscreteSingleResult(btManifoldPoint& cp,
 
   //    }
 
-  btTransform tf0 = getLinkTransformFromCOW(colObj0Wrap);
-  btTransform tf1 = getLinkTransformFromCOW(colObj1Wrap);
-  btTransform tf0_inv = tf0.inverse();
-  btTransform tf1_inv = tf1.inverse();
+  const ContactRequest& req = collisions.req;
 
   ContactResult contact;
   contact.link_names[0] = cd0->getName();
   contact.link_names[1] = cd1->getName();
-  contact.shape_id[0] = colObj0Wrap->getCollisionShape()->getUserIndex();
-  contact.shape_id[1] = colObj1Wrap->getCollisionShape()->getUserIndex();
+  contact.shape_id[0] = getShapeIndex(colObj0Wrap);
+  contact.shape_id[1] = getShapeIndex(colObj1Wrap);
   contact.subshape_id[0] = colObj0Wrap->m_index;
   contact.subshape_id[1] = colObj1Wrap->m_index;
-  contact.nearest_points[0] = convertBtToEigen(cp.m_positionWorldOnA);
-  contact.nearest_points[1] = convertBtToEigen(cp.m_positionWorldOnB);
-  contact.nearest_points_local[0] = convertBtToEigen(tf0_inv * cp.m_positionWorldOnA);
-  contact.nearest_points_local[1] = convertBtToEigen(tf1_inv * cp.m_positionWorldOnB);
-  contact.transform[0] = convertBtToEigen(tf0);
-  contact.transform[1] = convertBtToEigen(tf1);
   contact.type_id[0] = cd0->getTypeID();
   contact.type_id[1] = cd1->getTypeID();
   contact.distance = static_cast<double>(cp.m_distance1);
   contact.normal = convertBtToEigen(-1 * cp.m_normalWorldOnB);
 
+  if (req.hasResultField(ContactResultFields::NEAREST_POINTS))
+  {
+    contact.nearest_points[0] = convertBtToEigen(cp.m_positionWorldOnA);
+    contact.nearest_points[1] = convertBtToEigen(cp.m_positionWorldOnB);
+  }
+
+  if (req.result_fields != ContactResultFields::NONE)
+  {
+    // Only look up the link transforms if a field depending on them was requested
+    const bool calc_local = req.hasResultField(ContactResultFields::NEAREST_POINTS_LOCAL);
+    const bool calc_transform = req.hasResultField(ContactResultFields::TRANSFORM);
+    if (calc_local || calc_transform)
+    {
+      btTransform tf0 = getLinkTransformFromCOW(colObj0Wrap);
+      btTransform tf1 = getLinkTransformFromCOW(colObj1Wrap);
+      if (calc_local)
+      {
+        contact.nearest_points_local[0] = convertBtToEigen(tf0.invXform(cp.m_positionWorldOnA));
+        contact.nearest_points_local[1] = convertBtToEigen(tf1.invXform(cp.m_positionWorldOnB));
+      }
+
+      if (calc_transform)
+      {
+        contact.transform[0] = convertBtToEigen(tf0);
+        contact.transform[1] = convertBtToEigen(tf1);
+      }
+    }
+  }
+
   if (processResult(collisions, contact, pc, found) == nullptr)
     return 0;
 
@@ -744,11 +1247,12 @@ void calculateContinuousData(ContactResult* col,
 
   // Get the start and final location of the shape
   btTransform shape_tfWorld0 = cow->getWorldTransform();
-  btTransform shape_tfWorld1 = cow->getWorldTransform() * shape->m_t01;
+  btTransform shape_tfWorld1 = cow->getWorldTransform() * shape->getCastTransform();
 
   // Given the shapes final location calculate the links transform at the final location
+  // Note: link_tf_inv is used instead of col->transform because the transform field may not have been requested
   // NOLINTNEXTLINE
-  Eigen::Isometry3d s = col->transform[link_index].inverse() * convertBtToEigen(shape_tfWorld0);
+  Eigen::Isometry3d s = convertBtToEigen(link_tf_inv) * convertBtToEigen(shape_tfWorld0);
   col->cc_transform[link_index] = convertBtToEigen(shape_tfWorld1) * s.inverse();
 
   // Get the normal in the local shapes coordinate system at start and final location
@@ -834,33 +1338,76 @@ btScalar addCastSingleResult(btManifoldPoint& cp,
   //          return 0;
   //    }
 
-  btTransform tf0 = getLinkTransformFromCOW(colObj0Wrap);
-  btTransform tf1 = getLinkTransformFromCOW(colObj1Wrap);
-  btTransform tf0_inv = tf0.inverse();
-  btTransform tf1_inv = tf1.inverse();
+  const ContactRequest& req = collisions.req;
+  const bool calc_local = req.hasResultField(ContactResultFields::NEAREST_POINTS_LOCAL);
+  const bool calc_transform = req.hasResultField(ContactResultFields::TRANSFORM);
+  const bool calc_continuous = req.hasResultField(ContactResultFields::CONTINUOUS_DATA);
+
+  btTransform tf0;
+  btTransform tf1;
+  btTransform tf0_inv;
+  btTransform tf1_inv;
+  if (calc_local || calc_transform || calc_continuous)
+  {
+    tf0 = getLinkTransformFromCOW(colObj0Wrap);
+    tf1 = getLinkTransformFromCOW(colObj1Wrap);
+    tf0_inv = tf0.inverse();
+    tf1_inv = tf1.inverse();
+  }
 
   ContactResult contact;
   contact.link_names[0] = cd0->getName();
   contact.link_names[1] = cd1->getName();
-  contact.shape_id[0] = colObj0Wrap->getCollisionShape()->getUserIndex();
-  contact.shape_id[1] = colObj1Wrap->getCollisionShape()->getUserIndex();
+  contact.shape_id[0] = getShapeIndex(colObj0Wrap);
+  contact.shape_id[1] = getShapeIndex(colObj1Wrap);
   contact.subshape_id[0] = colObj0Wrap->m_index;
   contact.subshape_id[1] = colObj1Wrap->m_index;
-  contact.nearest_points[0] = convertBtToEigen(cp.m_positionWorldOnA);
-  contact.nearest_points[1] = convertBtToEigen(cp.m_positionWorldOnB);
-  contact.nearest_points_local[0] = convertBtToEigen(tf0_inv * cp.m_positionWorldOnA);
-  contact.nearest_points_local[1] = convertBtToEigen(tf1_inv * cp.m_positionWorldOnB);
-  contact.transform[0] = convertBtToEigen(tf0);
-  contact.transform[1] = convertBtToEigen(tf1);
   contact.type_id[0] = cd0->getTypeID();
   contact.type_id[1] = cd1->getTypeID();
   contact.distance = static_cast<double>(cp.m_distance1);
   contact.normal = convertBtToEigen(-1 * cp.m_normalWorldOnB);
 
+  if (req.hasResultField(ContactResultFields::NEAREST_POINTS))
+  {
+    contact.nearest_points[0] = convertBtToEigen(cp.m_positionWorldOnA);
+    contact.nearest_points[1] = convertBtToEigen(cp.m_positionWorldOnB);
+  }
+
+  if (calc_local)
+  {
+    contact.nearest_points_local[0] = convertBtToEigen(tf0_inv * cp.m_positionWorldOnA);
+    contact.nearest_points_local[1] = convertBtToEigen(tf1_inv * cp.m_positionWorldOnB);
+  }
+
+  if (calc_transform)
+  {
+    contact.transform[0] = convertBtToEigen(tf0);
+    contact.transform[1] = convertBtToEigen(tf1);
+  }
+
   ContactResult* col = processResult(collisions, contact, pc, found);
   if (col == nullptr)
     return 0;
 
+  if (!calc_continuous)
+  {
+    // The link order must still be consistent with the discrete results, cast object second
+    if (cd0->m_collisionFilterGroup == btBroadphaseProxy::KinematicFilter &&
+        cd1->m_collisionFilterGroup != btBroadphaseProxy::KinematicFilter)
+    {
+      std::swap(col->nearest_points[0], col->nearest_points[1]);
+      std::swap(col->nearest_points_local[0], col->nearest_points_local[1]);
+      std::swap(col->transform[0], col->transform[1]);
+      std::swap(col->link_names[0], col->link_names[1]);
+      std::swap(col->type_id[0], col->type_id[1]);
+      std::swap(col->shape_id[0], col->shape_id[1]);
+      std::swap(col->subshape_id[0], col->subshape_id[1]);
+      col->normal *= -1;
+    }
+
+    return 1;
+  }
+
   if (cd0->m_collisionFilterGroup == btBroadphaseProxy::KinematicFilter &&
       cd1->m_collisionFilterGroup == btBroadphaseProxy::KinematicFilter)
   {
@@ -939,6 +1486,8 @@ void TesseractBridgedManifoldResult::addContactPoint(const btVector3& normalOnBI
     newPt.m_index1 = m_index1;
   }
 
+  m_minDistance = std::min(m_minDistance, depth);
+
   // experimental feature info, for per-triangle material etc.
   const btCollisionObjectWrapper* obj0Wrap = isSwapped ? m_body1Wrap : m_body0Wrap;
   const btCollisionObjectWrapper* obj1Wrap = isSwapped ? m_body0Wrap : m_body1Wrap;
@@ -1013,7 +1562,12 @@ void TesseractBroadphaseBridgedManifoldResult::addContactPoint(const btVector3&
                                                                const btVector3& pointInWorld,
                                                                btScalar depth)
 {
-  if (result_callback_.collisions_.done || depth > static_cast<btScalar>(result_callback_.contact_distance_))
+  if (result_callback_.collisions_.done)
+    return;
+
+  min_distance_ = std::min(min_distance_, depth);
+
+  if (depth > static_cast<btScalar>(result_callback_.contact_distance_))
     return;
 
   bool isSwapped = m_manifoldPtr->getBody0() != m_body0Wrap->getCollisionObject();
@@ -1060,8 +1614,9 @@ void TesseractBroadphaseBridgedManifoldResult::addContactPoint(const btVector3&
 
 TesseractCollisionPairCallback::TesseractCollisionPairCallback(const btDispatcherInfo& dispatchInfo,
                                                                btCollisionDispatcher* dispatcher,
-                                                               BroadphaseContactResultCallback& results_callback)
-  : dispatch_info_(dispatchInfo), dispatcher_(dispatcher), results_callback_(results_callback)
+                                                               BroadphaseContactResultCallback& results_callback,
+                                                               CollisionPairCache* pair_cache)
+  : dispatch_info_(dispatchInfo), dispatcher_(dispatcher), results_callback_(results_callback), pair_cache_(pair_cache)
 {
 }
 
@@ -1073,8 +1628,18 @@ bool TesseractCollisionPairCallback::processOverlap(btBroadphasePair& pair)
   const auto* cow0 = static_cast<const CollisionObjectWrapper*>(pair.m_pProxy0->m_clientObject);
   const auto* cow1 = static_cast<const CollisionObjectWrapper*>(pair.m_pProxy1->m_clientObject);
 
+  TESSERACT_COMMON_METRICS_COUNT("tesseract_collision::broadphase_pairs", 1);
   if (results_callback_.needsCollision(cow0, cow1))
   {
+    const auto contact_distance = static_cast<btScalar>(results_callback_.contact_distance_);
+    CollisionPairCache::Entry* entry{ nullptr };
+    if (pair_cache_ != nullptr)
+    {
+      entry = &pair_cache_->getEntry(*cow0, *cow1);
+      if (pair_cache_->canSkip(*entry, contact_distance))
+        return false;
+    }
+
     btCollisionObjectWrapper obj0Wrap(nullptr, cow0->getCollisionShape(), cow0, cow0->getWorldTransform(), -1, -1);
     btCollisionObjectWrapper obj1Wrap(nullptr, cow1->getCollisionShape(), cow1, cow1->getWorldTransform(), -1, -1);
 
@@ -1087,10 +1652,22 @@ bool TesseractCollisionPairCallback::processOverlap(btBroadphasePair& pair)
     if (pair.m_algorithm != nullptr)
     {
       TesseractBroadphaseBridgedManifoldResult contactPointResult(&obj0Wrap, &obj1Wrap, results_callback_);
-      contactPointResult.m_closestPointDistanceThreshold = static_cast<btScalar>(results_callback_.contact_distance_);
+      contactPointResult.m_closestPointDistanceThreshold = contact_distance;
+      if (entry != nullptr)
+        contactPointResult.m_closestPointDistanceThreshold += pair_cache_->getDistancePadding();
 
       // discrete collision detection query
+      TESSERACT_COMMON_METRICS_COUNT("tesseract_collision::narrowphase_calls", 1);
       pair.m_algorithm->processCollision(&obj0Wrap, &obj1Wrap, dispatch_info_, &contactPointResult);
+
+      // If the search was terminated early not all contacts were processed so the separation is unknown
+      if (entry != nullptr)
+      {
+        if (results_callback_.collisions_.done)
+          CollisionPairCache::invalidate(*entry);
+        else
+          pair_cache_->update(*entry, contact_distance, contactPointResult.min_distance_);
+      }
     }
   }
   return false;
@@ -1108,11 +1685,150 @@ bool TesseractOverlapFilterCallback::needBroadphaseCollision(btBroadphaseProxy*
                              verbose_);
 }
 
+CollisionPairCache::CollisionPairCache(btScalar distance_padding) : distance_padding_(distance_padding) {}
+
+CollisionPairCache::~CollisionPairCache()
+{
+  // Algorithms must be freed by calling clear with the dispatcher that created them
+  assert(std::none_of(entries_.begin(), entries_.end(), [](const auto& e) { return e.second.algorithm != nullptr; }));
+}
+
+btScalar CollisionPairCache::getDistancePadding() const { return distance_padding_; }
+
+CollisionPairCache::Entry& CollisionPairCache::getEntry(const CollisionObjectWrapper& cow0,
+                                                        const CollisionObjectWrapper& cow1)
+{
+  const CollisionObjectWrapper* first = &cow0;
+  const CollisionObjectWrapper* second = &cow1;
+  if (second < first)
+    std::swap(first, second);
+
+  auto it = entries_.find(std::make_pair(first, second));
+  if (it != entries_.end())
+    return it->second;
+
+  Entry& entry = entries_[std::make_pair(first, second)];
+  entry.cow0 = first;
+  entry.cow1 = second;
+  return entry;
+}
+
+bool CollisionPairCache::canSkip(const Entry& entry, btScalar contact_distance)
+{
+  if (entry.separation <= contact_distance)
+    return false;
+
+  btScalar bound = entry.separation - getMaxMotion(entry.cow0, entry.tf0);
+  if (bound <= contact_distance)
+    return false;
+
+  bound -= getMaxMotion(entry.cow1, entry.tf1);
+  return (bound > contact_distance);
+}
+
+void CollisionPairCache::update(Entry& entry, btScalar contact_distance, btScalar min_distance) const
+{
+  // The narrowphase only reports distances less than the threshold it was called with, so if nothing closer was
+  // reported the objects are known to be at least the threshold apart.
+  entry.separation = std::min(min_distance, contact_distance + distance_padding_) - BULLET_LENGTH_TOLERANCE;
+  entry.tf0 = entry.cow0->getWorldTransform();
+  entry.tf1 = entry.cow1->getWorldTransform();
+}
+
+void CollisionPairCache::invalidate(Entry& entry) { entry.separation = -BT_LARGE_FLOAT; }
+
+btCollisionAlgorithm* CollisionPairCache::getAlgorithm(Entry& entry,
+                                                       const btCollisionObjectWrapper* obj0_wrap,
+                                                       const btCollisionObjectWrapper* obj1_wrap,
+                                                       btCollisionDispatcher* dispatcher)
+{
+  const auto* body0 = static_cast<const CollisionObjectWrapper*>(obj0_wrap->getCollisionObject());
+  if (entry.algorithm != nullptr && entry.algorithm_body0 != body0)
+  {
+    entry.algorithm->~btCollisionAlgorithm();
+    dispatcher->freeCollisionAlgorithm(entry.algorithm);
+    entry.algorithm = nullptr;
+  }
+
+  if (entry.algorithm == nullptr)
+  {
+    entry.algorithm = dispatcher->findAlgorithm(obj0_wrap, obj1_wrap, nullptr, BT_CLOSEST_POINT_ALGORITHMS);
+    entry.algorithm_body0 = body0;
+  }
+
+  return entry.algorithm;
+}
+
+void CollisionPairCache::remove(const CollisionObjectWrapper* cow, btCollisionDispatcher* dispatcher)
+{
+  for (auto it = entries_.begin(); it != entries_.end();)
+  {
+    if (it->first.first == cow || it->first.second == cow)
+    {
+      if (it->second.algorithm != nullptr)
+      {
+        it->second.algorithm->~btCollisionAlgorithm();
+        dispatcher->freeCollisionAlgorithm(it->second.algorithm);
+      }
+      it = entries_.erase(it);
+    }
+    else
+    {
+      ++it;
+    }
+  }
+  radius_.erase(cow);
+}
+
+void CollisionPairCache::clear(btCollisionDispatcher* dispatcher)
+{
+  for (auto& entry : entries_)
+  {
+    if (entry.second.algorithm != nullptr)
+    {
+      entry.second.algorithm->~btCollisionAlgorithm();
+      dispatcher->freeCollisionAlgorithm(entry.second.algorithm);
+    }
+  }
+  entries_.clear();
+  radius_.clear();
+}
+
+btScalar CollisionPairCache::getOriginRadius(const CollisionObjectWrapper* cow)
+{
+  auto it = radius_.find(cow);
+  if (it != radius_.end())
+    return it->second;
+
+  btVector3 center;
+  btScalar radius{ 0 };
+  cow->getCollisionShape()->getBoundingSphere(center, radius);
+  radius += center.length();
+  radius_[cow] = radius;
+  return radius;
+}
+
+btScalar CollisionPairCache::getMaxMotion(const CollisionObjectWrapper* cow, const btTransform& tf_from)
+{
+  const btTransform& tf_to = cow->getWorldTransform();
+  btScalar motion = (tf_to.getOrigin() - tf_from.getOrigin()).length();
+
+  // A point at distance r from the origin moves at most 2 * sin(theta / 2) * r for a rotation of theta, where
+  // sin(theta / 2) is the length of the vector part of the relative quaternion.
+  btQuaternion dq = tf_to.getRotation() * tf_from.getRotation().inverse();
+  btScalar half_chord = btVector3(dq.x(), dq.y(), dq.z()).length();
+  if (half_chord > btScalar(0))
+    motion += btScalar(2) * half_chord * getOriginRadius(cow);
+
+  return motion;
+}
+
 COW::Ptr createCollisionObject(const std::string& name,
                                const int& type_id,
                                const CollisionShapesConst& shapes,
                                const tesseract_common::VectorIsometry3d& shape_poses,
-                               bool enabled)
+                               bool enabled,
+                               const BulletMeshBVHCache::Ptr& mesh_bvh_cache)
 {
   // dont add object that does not have geometry
   if (shapes.empty() || shape_poses.empty() || (shapes.size() != shape_poses.size()))
@@ -1121,7 +1837,7 @@ COW::Ptr createCollisionObject(const std::string& name,
     return nullptr;
   }
 
-  auto new_cow = std::make_shared<COW>(name, type_id, shapes, shape_poses);
+  auto new_cow = std::make_shared<COW>(name, type_id, shapes, shape_poses, mesh_bvh_cache);
 
   new_cow->m_enabled = enabled;
   new_cow->setContactProcessingThreshold(BULLET_DEFAULT_CONTACT_DISTANCE);
@@ -1195,9 +1911,101 @@ bool CastCollisionCollector::needsCollision(btBroadphaseProxy* proxy0) const
              *cow_, *(static_cast<CollisionObjectWrapper*>(proxy0->m_clientObject)), collisions_.fn, verbose_);
 }
 
+std::shared_ptr<btCompoundShape>
+createCastOctreeShape(const BulletOctreeShape& shape, CollisionObjectWrapper& cow, const btTransform& local_tf)
+{
+  assert(cow.m_cast_transform != nullptr);
+  const octomap::OcTree& octree = shape.getOctree();
+  double occupancy_threshold = octree.getOccupancyThres();
+
+  auto compound =
+      std::make_shared<CastCompoundShape>(cow.m_cast_transform, local_tf, static_cast<int>(octree.size()));
+
+  // Each voxel requires its own cast shape because the cast transform depends on the location of the voxel
+  for (auto it = octree.begin_leafs(), end = octree.end_leafs(); it != end; ++it)
+  {
+    if (it->getOccupancy() < occupancy_threshold)
+      continue;
+
+    btTransform geomTrans;
+    geomTrans.setIdentity();
+    geomTrans.setOrigin(
+        btVector3(static_cast<btScalar>(it.getX()), static_cast<btScalar>(it.getY()), static_cast<btScalar>(it.getZ())));
+
+    auto subshape =
+        std::make_shared<CastHullShape>(shape.getVoxelShape(it.getDepth()), cow.m_cast_transform, local_tf * geomTrans);
+    subshape->setMargin(BULLET_MARGIN);
+    cow.manage(subshape);
+
+    compound->addChildShape(geomTrans, subshape.get());
+  }
+
+  compound->setUserIndex(shape.getUserIndex());
+  compound->setMargin(BULLET_MARGIN);
+  cow.manage(compound);
+  return compound;
+}
+
+namespace
+{
+/** @brief Creates a cast shape for every triangle of a mesh interface in the order of the triangle indices */
+struct CastTriangleCallback : public btInternalTriangleIndexCallback
+{
+  const btBvhTriangleMeshShape& m_shape;
+  CollisionObjectWrapper& m_cow;
+  const btTransform& m_local_tf;
+  btCompoundShape& m_compound;
+
+  CastTriangleCallback(const btBvhTriangleMeshShape& shape,
+                       CollisionObjectWrapper& cow,
+                       const btTransform& local_tf,
+                       btCompoundShape& compound)
+    : m_shape(shape), m_cow(cow), m_local_tf(local_tf), m_compound(compound)
+  {
+  }
+
+  void internalProcessTriangleIndex(btVector3* triangle, int /*partId*/, int /*triangleIndex*/) override
+  {
+    auto subshape_triangle = std::make_shared<btTriangleShapeEx>(triangle[0], triangle[1], triangle[2]);
+    subshape_triangle->setUserIndex(m_shape.getUserIndex());
+    subshape_triangle->setMargin(BULLET_MARGIN);
+    m_cow.manage(subshape_triangle);
+
+    auto subshape = std::make_shared<CastHullShape>(subshape_triangle.get(), m_cow.m_cast_transform, m_local_tf);
+    subshape->setMargin(BULLET_MARGIN);
+    m_cow.manage(subshape);
+
+    btTransform geomTrans;
+    geomTrans.setIdentity();
+    m_compound.addChildShape(geomTrans, subshape.get());
+  }
+};
+}  // namespace
+
+std::shared_ptr<btCompoundShape> createCastTriangleMeshShape(const btBvhTriangleMeshShape& shape,
+                                                             CollisionObjectWrapper& cow,
+                                                             const btTransform& local_tf)
+{
+  assert(cow.m_cast_transform != nullptr);
+  auto compound = std::make_shared<CastCompoundShape>(cow.m_cast_transform, local_tf);
+
+  // Each triangle is a child so the subshape id of a contact is the triangle index like the discrete shape
+  CastTriangleCallback callback(shape, cow, local_tf, *compound);
+  btVector3 aabb_min, aabb_max;
+  shape.getAabb(btTransform::getIdentity(), aabb_min, aabb_max);
+  shape.getMeshInterface()->InternalProcessAllTriangles(&callback, aabb_min, aabb_max);
+
+  compound->setUserIndex(shape.getUserIndex());
+  compound->setMargin(BULLET_MARGIN);
+  cow.manage(compound);
+  return compound;
+}
+
 COW::Ptr makeCastCollisionObject(const COW::Ptr& cow)
 {
   COW::Ptr new_cow = cow->clone();
+  new_cow->m_cast_transform = std::make_shared<CastTransform>();
+  const CastTransform::Ptr& cast_tf = new_cow->m_cast_transform;
 
   btTransform tf;
   tf.setIdentity();
@@ -1209,18 +2017,35 @@ COW::Ptr makeCastCollisionObject(const COW::Ptr& cow)
     assert(convex->getShapeType() != CUSTOM_CONVEX_SHAPE_TYPE);  // This checks if the collision object is already a
                                                                  // cast collision object
 
-    auto shape = std::make_shared<CastHullShape>(convex, tf);
+    auto shape = std::make_shared<CastHullShape>(convex, cast_tf, tf);
     assert(shape != nullptr);
 
     new_cow->manage(shape);
     new_cow->setCollisionShape(shape.get());
   }
+  else if (new_cow->getCollisionShape()->getShapeType() == CUSTOM_CONCAVE_SHAPE_TYPE)
+  {
+    assert(dynamic_cast<BulletOctreeShape*>(new_cow->getCollisionShape()) != nullptr);
+    auto* octree = static_cast<BulletOctreeShape*>(new_cow->getCollisionShape());  // NOLINT
+
+    std::shared_ptr<btCompoundShape> shape = createCastOctreeShape(*octree, *new_cow, tf);
+    new_cow->setCollisionShape(shape.get());
+    new_cow->setWorldTransform(cow->getWorldTransform());
+  }
+  else if (new_cow->getCollisionShape()->getShapeType() == TRIANGLE_MESH_SHAPE_PROXYTYPE)
+  {
+    assert(dynamic_cast<btBvhTriangleMeshShape*>(new_cow->getCollisionShape()) != nullptr);
+    auto* mesh = static_cast<btBvhTriangleMeshShape*>(new_cow->getCollisionShape());  // NOLINT
+
+    std::shared_ptr<btCompoundShape> shape = createCastTriangleMeshShape(*mesh, *new_cow, tf);
+    new_cow->setCollisionShape(shape.get());
+    new_cow->setWorldTransform(cow->getWorldTransform());
+  }
   else if (btBroadphaseProxy::isCompound(new_cow->getCollisionShape()->getShapeType()))
   {
     assert(dynamic_cast<btCompoundShape*>(new_cow->getCollisionShape()) != nullptr);
     auto* compound = static_cast<btCompoundShape*>(new_cow->getCollisionShape());  // NOLINT
-    auto new_compound =
-        std::make_shared<btCompoundShape>(BULLET_COMPOUND_USE_DYNAMIC_AABB, compound->getNumChildShapes());
+    auto new_compound = std::make_shared<CastCompoundShape>(cast_tf, tf, compound->getNumChildShapes());
 
     for (int i = 0; i < compound->getNumChildShapes(); ++i)
     {
@@ -1231,18 +2056,37 @@ COW::Ptr makeCastCollisionObject(const COW::Ptr& cow)
 
         btTransform geomTrans = compound->getChildTransform(i);
 
-        auto subshape = std::make_shared<CastHullShape>(convex, tf);
+        auto subshape = std::make_shared<CastHullShape>(convex, cast_tf, geomTrans);
         assert(subshape != nullptr);
 
         new_cow->manage(subshape);
         subshape->setMargin(BULLET_MARGIN);
         new_compound->addChildShape(geomTrans, subshape.get());
       }
+      else if (compound->getChildShape(i)->getShapeType() == CUSTOM_CONCAVE_SHAPE_TYPE)
+      {
+        auto* octree = static_cast<BulletOctreeShape*>(compound->getChildShape(i));  // NOLINT
+
+        btTransform geomTrans = compound->getChildTransform(i);
+
+        std::shared_ptr<btCompoundShape> subshape = createCastOctreeShape(*octree, *new_cow, geomTrans);
+        new_compound->addChildShape(geomTrans, subshape.get());
+      }
+      else if (compound->getChildShape(i)->getShapeType() == TRIANGLE_MESH_SHAPE_PROXYTYPE)
+      {
+        auto* mesh = static_cast<btBvhTriangleMeshShape*>(compound->getChildShape(i));  // NOLINT
+
+        btTransform geomTrans = compound->getChildTransform(i);
+
+        std::shared_ptr<btCompoundShape> subshape = createCastTriangleMeshShape(*mesh, *new_cow, geomTrans);
+        new_compound->addChildShape(geomTrans, subshape.get());
+      }
       else if (btBroadphaseProxy::isCompound(compound->getChildShape(i)->getShapeType()))
       {
         auto* second_compound = static_cast<btCompoundShape*>(compound->getChildShape(i));  // NOLINT
+        const btTransform& second_compound_tf = compound->getChildTransform(i);
         auto new_second_compound =
-            std::make_shared<btCompoundShape>(BULLET_COMPOUND_USE_DYNAMIC_AABB, second_compound->getNumChildShapes());
+            std::make_shared<CastCompoundShape>(cast_tf, second_compound_tf, second_compound->getNumChildShapes());
         for (int j = 0; j < second_compound->getNumChildShapes(); ++j)
         {
           assert(!btBroadphaseProxy::isCompound(second_compound->getChildShape(j)->getShapeType()));
@@ -1253,7 +2097,7 @@ COW::Ptr makeCastCollisionObject(const COW::Ptr& cow)
 
           btTransform geomTrans = second_compound->getChildTransform(j);
 
-          auto subshape = std::make_shared<CastHullShape>(convex, tf);
+          auto subshape = std::make_shared<CastHullShape>(convex, cast_tf, second_compound_tf * geomTrans);
           assert(subshape != nullptr);
 
           new_cow->manage(subshape);
@@ -99,6 +99,8 @@ ConvexDecompositionHACD::compute(const tesseract_common::VectorVector3d& vertice
   return output;
 }
 
+std::string ConvexDecompositionHACD::getParametersKey() const { return "HACD;" + params_.getKey(); }
+
 void HACDParameters::print() const
 {
   std::stringstream msg;
@@ -114,4 +116,14 @@ void HACDParameters::print() const
   std::cout << msg.str();
 }
 
+std::string HACDParameters::getKey() const
+{
+  std::stringstream key;
+  key.precision(17);
+  key << compacity_weight << ";" << volume_weight << ";" << concavity << ";" << max_num_vertices_per_ch << ";"
+      << min_num_clusters << ";" << add_extra_dist_points << ";" << add_neighbours_dist_points << ";"
+      << add_faces_points;
+  return key.str();
+}
+
 }  // namespace tesseract_collision
@@ -30,6 +30,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <LinearMath/btConvexHullComputer.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
+#include <tesseract_common/parallel_for.h>
 #include <tesseract_collision/bullet/convex_hull_utils.h>
 
 namespace tesseract_collision
@@ -122,4 +123,43 @@ tesseract_geometry::ConvexMesh::Ptr makeConvexMesh(const tesseract_geometry::Mes
   return convex_mesh;
 }
 
+std::vector<tesseract_geometry::ConvexMesh::Ptr>
+makeConvexMeshes(const std::vector<tesseract_geometry::Mesh::ConstPtr>& meshes,
+                 std::size_t num_threads,
+                 const ConvexMeshCache::ConstPtr& cache)
+{
+  std::vector<tesseract_geometry::ConvexMesh::Ptr> convex_meshes(meshes.size());
+
+  auto make = [&cache](const tesseract_geometry::Mesh& mesh) {
+    if (cache == nullptr)
+      return makeConvexMesh(mesh);
+
+    const std::string key = ConvexMeshCache::createKey(*mesh.getVertices(), *mesh.getFaces(), "BulletConvexHull");
+    std::vector<tesseract_geometry::ConvexMesh::Ptr> cached;
+    if (cache->load(cached, key) && cached.size() == 1)
+    {
+      // The resource and scale are not part of the key so they are taken from the mesh
+      auto convex_mesh = std::make_shared<tesseract_geometry::ConvexMesh>(cached.front()->getVertices(),
+                                                                          cached.front()->getFaces(),
+                                                                          cached.front()->getFaceCount(),
+                                                                          mesh.getResource(),
+                                                                          mesh.getScale());
+      convex_mesh->setCreationMethod(tesseract_geometry::ConvexMesh::CONVERTED);
+      return convex_mesh;
+    }
+
+    auto convex_mesh = makeConvexMesh(mesh);
+    if (convex_mesh->getFaceCount() > 0)
+      cache->store({ convex_mesh }, key);
+
+    return convex_mesh;
+  };
+
+  tesseract_common::parallelFor(meshes.size(), num_threads, [&](std::size_t i, std::size_t /*thread_index*/) {
+    convex_meshes[i] = make(*meshes[i]);
+  });
+
+  return convex_meshes;
+}
+
 }  // namespace tesseract_collision
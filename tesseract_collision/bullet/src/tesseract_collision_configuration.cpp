@@ -49,6 +49,8 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract_collision/bullet/tesseract_compound_collision_algorithm.h>
 #include <tesseract_collision/bullet/tesseract_compound_compound_collision_algorithm.h>
 #include <tesseract_collision/bullet/tesseract_convex_convex_algorithm.h>
+#include <tesseract_collision/bullet/tesseract_octree_collision_algorithm.h>
+#include <tesseract_collision/bullet/tesseract_triangle_mesh_collision_algorithm.h>
 
 namespace tesseract_collision::tesseract_collision_bullet
 {
@@ -89,11 +91,15 @@ void TesseractCollisionConfigurationInfo::createPoolAllocators()
   int maxSize2 = sizeof(btConvexConcaveCollisionAlgorithm);
   int maxSize3 = sizeof(TesseractCompoundCollisionAlgorithm);
   int maxSize4 = sizeof(TesseractCompoundCompoundCollisionAlgorithm);
+  int maxSize5 = sizeof(TesseractOctreeCollisionAlgorithm);
+  int maxSize6 = sizeof(TesseractTriangleMeshCollisionAlgorithm);
 
   int collisionAlgorithmMaxElementSize = btMax(maxSize, m_customCollisionAlgorithmMaxElementSize);
   collisionAlgorithmMaxElementSize = btMax(collisionAlgorithmMaxElementSize, maxSize2);
   collisionAlgorithmMaxElementSize = btMax(collisionAlgorithmMaxElementSize, maxSize3);
   collisionAlgorithmMaxElementSize = btMax(collisionAlgorithmMaxElementSize, maxSize4);
+  collisionAlgorithmMaxElementSize = btMax(collisionAlgorithmMaxElementSize, maxSize5);
+  collisionAlgorithmMaxElementSize = btMax(collisionAlgorithmMaxElementSize, maxSize6);
 
   TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
   collisionAlgorithmMaxElementSize = (collisionAlgorithmMaxElementSize + 16) & 0xffffffffffff0;  // NOLINT
@@ -148,6 +154,57 @@ TesseractCollisionConfiguration::TesseractCollisionConfiguration(const Tesseract
 
   mem = btAlignedAlloc(sizeof(TesseractCompoundCollisionAlgorithm::SwappedCreateFunc), 16);
   m_swappedCompoundCreateFunc = new (mem) TesseractCompoundCollisionAlgorithm::SwappedCreateFunc;
+
+  mem = btAlignedAlloc(sizeof(TesseractOctreeCollisionAlgorithm::CreateFunc), 16);
+  m_octreeCreateFunc = new (mem) TesseractOctreeCollisionAlgorithm::CreateFunc;
+
+  mem = btAlignedAlloc(sizeof(TesseractOctreeCollisionAlgorithm::SwappedCreateFunc), 16);
+  m_swappedOctreeCreateFunc = new (mem) TesseractOctreeCollisionAlgorithm::SwappedCreateFunc;
+
+  mem = btAlignedAlloc(sizeof(TesseractTriangleMeshCollisionAlgorithm::CreateFunc), 16);
+  m_triangleMeshCreateFunc = new (mem) TesseractTriangleMeshCollisionAlgorithm::CreateFunc;
+}
+
+TesseractCollisionConfiguration::~TesseractCollisionConfiguration()
+{
+  m_octreeCreateFunc->~btCollisionAlgorithmCreateFunc();
+  btAlignedFree(m_octreeCreateFunc);
+
+  m_swappedOctreeCreateFunc->~btCollisionAlgorithmCreateFunc();
+  btAlignedFree(m_swappedOctreeCreateFunc);
+
+  m_triangleMeshCreateFunc->~btCollisionAlgorithmCreateFunc();
+  btAlignedFree(m_triangleMeshCreateFunc);
+}
+
+btCollisionAlgorithmCreateFunc* TesseractCollisionConfiguration::getCollisionAlgorithmCreateFunc(int proxyType0,
+                                                                                               int proxyType1)
+{
+  if (proxyType0 == CUSTOM_CONCAVE_SHAPE_TYPE && !btBroadphaseProxy::isCompound(proxyType1))
+    return m_octreeCreateFunc;
+
+  if (proxyType1 == CUSTOM_CONCAVE_SHAPE_TYPE && !btBroadphaseProxy::isCompound(proxyType0))
+    return m_swappedOctreeCreateFunc;
+
+  if (proxyType0 == TRIANGLE_MESH_SHAPE_PROXYTYPE && proxyType1 == TRIANGLE_MESH_SHAPE_PROXYTYPE)
+    return m_triangleMeshCreateFunc;
+
+  return btDefaultCollisionConfiguration::getCollisionAlgorithmCreateFunc(proxyType0, proxyType1);
+}
+
+btCollisionAlgorithmCreateFunc* TesseractCollisionConfiguration::getClosestPointsAlgorithmCreateFunc(int proxyType0,
+                                                                                                   int proxyType1)
+{
+  if (proxyType0 == CUSTOM_CONCAVE_SHAPE_TYPE && !btBroadphaseProxy::isCompound(proxyType1))
+    return m_octreeCreateFunc;
+
+  if (proxyType1 == CUSTOM_CONCAVE_SHAPE_TYPE && !btBroadphaseProxy::isCompound(proxyType0))
+    return m_swappedOctreeCreateFunc;
+
+  if (proxyType0 == TRIANGLE_MESH_SHAPE_PROXYTYPE && proxyType1 == TRIANGLE_MESH_SHAPE_PROXYTYPE)
+    return m_triangleMeshCreateFunc;
+
+  return btDefaultCollisionConfiguration::getClosestPointsAlgorithmCreateFunc(proxyType0, proxyType1);
 }
 
 }  // namespace tesseract_collision::tesseract_collision_bullet
@@ -0,0 +1,201 @@
+/**
+ * @file tesseract_octree_collision_algorithm.cpp
+ * @brief Bullet collision algorithm for octree shapes
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (BSD-2-Clause)
+ * @par
+ * All rights reserved.
+ * @par
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * @par
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ * @par
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <BulletCollision/CollisionDispatch/btCollisionObjectWrapper.h>
+#include <BulletCollision/CollisionDispatch/btManifoldResult.h>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/bullet/tesseract_octree_collision_algorithm.h>
+#include <tesseract_collision/bullet/bullet_utils.h>
+
+namespace tesseract_collision::tesseract_collision_bullet
+{
+/**
+ * @brief Checks each occupied voxel found while traversing the octree against the other collision object
+ *
+ * The dispatcher returns the same algorithm for every voxel at a given depth, so an algorithm is only created for each
+ * depth visited and they are all freed once the traversal is complete.
+ */
+struct TesseractOctreeVoxelCallback : public BulletOctreeShape::VoxelCallback
+{
+  const btCollisionObjectWrapper* m_octreeColObjWrap;
+  const btCollisionObjectWrapper* m_otherObjWrap;
+  btDispatcher* m_dispatcher;
+  const btDispatcherInfo& m_dispatchInfo;
+  btManifoldResult* m_resultOut;
+  btPersistentManifold* m_sharedManifold;
+  ContactTestData* m_contact_test_data;
+  const BulletOctreeShape* m_octreeShape;
+  std::vector<btCollisionAlgorithm*> m_voxelCollisionAlgorithms;
+
+  TesseractOctreeVoxelCallback(const btCollisionObjectWrapper* octreeObjWrap,
+                               const btCollisionObjectWrapper* otherObjWrap,
+                               btDispatcher* dispatcher,
+                               const btDispatcherInfo& dispatchInfo,
+                               btManifoldResult* resultOut,
+                               btPersistentManifold* sharedManifold)
+    : m_octreeColObjWrap(octreeObjWrap)
+    , m_otherObjWrap(otherObjWrap)
+    , m_dispatcher(dispatcher)
+    , m_dispatchInfo(dispatchInfo)
+    , m_resultOut(resultOut)
+    , m_sharedManifold(sharedManifold)
+    , m_contact_test_data(static_cast<ContactTestData*>(octreeObjWrap->m_collisionObject->getUserPointer()))
+    , m_octreeShape(static_cast<const BulletOctreeShape*>(octreeObjWrap->getCollisionShape()))
+    , m_voxelCollisionAlgorithms(m_octreeShape->getOctree().getTreeDepth() + 1, nullptr)
+  {
+  }
+
+  ~TesseractOctreeVoxelCallback() override
+  {
+    for (btCollisionAlgorithm* algo : m_voxelCollisionAlgorithms)
+    {
+      if (algo != nullptr)
+      {
+        algo->~btCollisionAlgorithm();
+        m_dispatcher->freeCollisionAlgorithm(algo);
+      }
+    }
+  }
+  TesseractOctreeVoxelCallback(const TesseractOctreeVoxelCallback&) = delete;
+  TesseractOctreeVoxelCallback& operator=(const TesseractOctreeVoxelCallback&) = delete;
+  TesseractOctreeVoxelCallback(TesseractOctreeVoxelCallback&&) = delete;
+  TesseractOctreeVoxelCallback& operator=(TesseractOctreeVoxelCallback&&) = delete;
+
+  bool processVoxel(const btVector3& center, unsigned depth) override
+  {
+    if (m_contact_test_data->done)
+      return false;
+
+    // The voxels are axis aligned with the octree
+    btTransform voxelWorldTrans = m_octreeColObjWrap->getWorldTransform();
+    voxelWorldTrans.setOrigin(voxelWorldTrans * center);
+
+    btCollisionObjectWrapper voxelWrap(m_octreeColObjWrap,
+                                       m_octreeShape->getVoxelShape(depth),
+                                       m_octreeColObjWrap->getCollisionObject(),
+                                       voxelWorldTrans,
+                                       -1,
+                                       -1);
+
+    btCollisionAlgorithm*& algo = m_voxelCollisionAlgorithms[depth];
+    if (algo == nullptr)
+    {
+      if (m_resultOut->m_closestPointDistanceThreshold > 0)
+        algo = m_dispatcher->findAlgorithm(&voxelWrap, m_otherObjWrap, nullptr, BT_CLOSEST_POINT_ALGORITHMS);
+      else
+        algo = m_dispatcher->findAlgorithm(&voxelWrap, m_otherObjWrap, m_sharedManifold, BT_CONTACT_POINT_ALGORITHMS);
+    }
+
+    const btCollisionObjectWrapper* tmpWrap = nullptr;
+
+    /// detect swapping case
+    if (m_resultOut->getBody0Internal() == m_octreeColObjWrap->getCollisionObject())
+    {
+      tmpWrap = m_resultOut->getBody0Wrap();
+      m_resultOut->setBody0Wrap(&voxelWrap);
+      m_resultOut->setShapeIdentifiersA(-1, -1);
+    }
+    else
+    {
+      tmpWrap = m_resultOut->getBody1Wrap();
+      m_resultOut->setBody1Wrap(&voxelWrap);
+      m_resultOut->setShapeIdentifiersB(-1, -1);
+    }
+
+    algo->processCollision(&voxelWrap, m_otherObjWrap, m_dispatchInfo, m_resultOut);
+
+    if (m_resultOut->getBody0Internal() == m_octreeColObjWrap->getCollisionObject())
+      m_resultOut->setBody0Wrap(tmpWrap);
+    else
+      m_resultOut->setBody1Wrap(tmpWrap);
+
+    return !m_contact_test_data->done;
+  }
+};
+
+TesseractOctreeCollisionAlgorithm::TesseractOctreeCollisionAlgorithm(const btCollisionAlgorithmConstructionInfo& ci,
+                                                                     const btCollisionObjectWrapper* body0Wrap,
+                                                                     const btCollisionObjectWrapper* body1Wrap,
+                                                                     bool isSwapped)
+  : btActivatingCollisionAlgorithm(ci, body0Wrap, body1Wrap), m_isSwapped(isSwapped), m_sharedManifold(ci.m_manifold)
+{
+}
+
+void TesseractOctreeCollisionAlgorithm::processCollision(const btCollisionObjectWrapper* body0Wrap,
+                                                         const btCollisionObjectWrapper* body1Wrap,
+                                                         const btDispatcherInfo& dispatchInfo,
+                                                         btManifoldResult* resultOut)
+{
+  const btCollisionObjectWrapper* octreeObjWrap = m_isSwapped ? body1Wrap : body0Wrap;
+  const btCollisionObjectWrapper* otherObjWrap = m_isSwapped ? body0Wrap : body1Wrap;
+  assert(octreeObjWrap->getCollisionShape()->getShapeType() == CUSTOM_CONCAVE_SHAPE_TYPE);
+
+  const auto* octreeShape = static_cast<const BulletOctreeShape*>(octreeObjWrap->getCollisionShape());
+
+  // Only voxels overlapping the AABB of the other object, expanded by the contact distance, need to be checked
+  btTransform otherInOctreeSpace = octreeObjWrap->getWorldTransform().inverse() * otherObjWrap->getWorldTransform();
+  btVector3 localAabbMin, localAabbMax;
+  otherObjWrap->getCollisionShape()->getAabb(otherInOctreeSpace, localAabbMin, localAabbMax);
+  btVector3 extraExtends(resultOut->m_closestPointDistanceThreshold,
+                         resultOut->m_closestPointDistanceThreshold,
+                         resultOut->m_closestPointDistanceThreshold);
+  localAabbMin -= extraExtends;
+  localAabbMax += extraExtends;
+
+  TesseractOctreeVoxelCallback callback(
+      octreeObjWrap, otherObjWrap, m_dispatcher, dispatchInfo, resultOut, m_sharedManifold);
+  octreeShape->processOverlappingVoxels(localAabbMin, localAabbMax, callback);
+}
+
+// LCOV_EXCL_START
+btScalar TesseractOctreeCollisionAlgorithm::calculateTimeOfImpact(btCollisionObject* /*body0*/,
+                                                                  btCollisionObject* /*body1*/,
+                                                                  const btDispatcherInfo& /*dispatchInfo*/,
+                                                                  btManifoldResult* /*resultOut*/)
+{
+  return 1;
+}
+// LCOV_EXCL_STOP
+}  // namespace tesseract_collision::tesseract_collision_bullet
@@ -0,0 +1,200 @@
+/**
+ * @file tesseract_triangle_mesh_collision_algorithm.cpp
+ * @brief Bullet collision algorithm for pairs of triangle mesh shapes
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (BSD-2-Clause)
+ * @par
+ * All rights reserved.
+ * @par
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * @par
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ * @par
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <BulletCollision/CollisionDispatch/btCollisionObjectWrapper.h>
+#include <BulletCollision/CollisionDispatch/btManifoldResult.h>
+#include <BulletCollision/CollisionShapes/btTriangleShape.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/bullet/tesseract_triangle_mesh_collision_algorithm.h>
+#include <tesseract_collision/bullet/bullet_utils.h>
+
+namespace tesseract_collision::tesseract_collision_bullet
+{
+/**
+ * @brief Checks each triangle of the first mesh found while traversing its hierarchy against the second mesh
+ *
+ * The dispatcher returns the same algorithm for every triangle, so it is only created once and freed once the
+ * traversal is complete.
+ */
+struct TesseractTriangleMeshTriangleCallback : public btTriangleCallback
+{
+  const btCollisionObjectWrapper* m_meshColObjWrap;
+  const btCollisionObjectWrapper* m_otherObjWrap;
+  btDispatcher* m_dispatcher;
+  const btDispatcherInfo& m_dispatchInfo;
+  btManifoldResult* m_resultOut;
+  btPersistentManifold* m_sharedManifold;
+  ContactTestData* m_contact_test_data;
+  btCollisionAlgorithm* m_triangleCollisionAlgorithm{ nullptr };
+
+  TesseractTriangleMeshTriangleCallback(const btCollisionObjectWrapper* meshObjWrap,
+                                        const btCollisionObjectWrapper* otherObjWrap,
+                                        btDispatcher* dispatcher,
+                                        const btDispatcherInfo& dispatchInfo,
+                                        btManifoldResult* resultOut,
+                                        btPersistentManifold* sharedManifold)
+    : m_meshColObjWrap(meshObjWrap)
+    , m_otherObjWrap(otherObjWrap)
+    , m_dispatcher(dispatcher)
+    , m_dispatchInfo(dispatchInfo)
+    , m_resultOut(resultOut)
+    , m_sharedManifold(sharedManifold)
+    , m_contact_test_data(static_cast<ContactTestData*>(meshObjWrap->m_collisionObject->getUserPointer()))
+  {
+  }
+
+  ~TesseractTriangleMeshTriangleCallback() override
+  {
+    if (m_triangleCollisionAlgorithm != nullptr)
+    {
+      m_triangleCollisionAlgorithm->~btCollisionAlgorithm();
+      m_dispatcher->freeCollisionAlgorithm(m_triangleCollisionAlgorithm);
+    }
+  }
+  TesseractTriangleMeshTriangleCallback(const TesseractTriangleMeshTriangleCallback&) = delete;
+  TesseractTriangleMeshTriangleCallback& operator=(const TesseractTriangleMeshTriangleCallback&) = delete;
+  TesseractTriangleMeshTriangleCallback(TesseractTriangleMeshTriangleCallback&&) = delete;
+  TesseractTriangleMeshTriangleCallback& operator=(TesseractTriangleMeshTriangleCallback&&) = delete;
+
+  void processTriangle(btVector3* triangle, int partId, int triangleIndex) override
+  {
+    // The traversal can not be stopped early so the remaining triangles are skipped
+    if (m_contact_test_data->done)
+      return;
+
+    const btCollisionShape* meshShape = m_meshColObjWrap->getCollisionShape();
+    btTriangleShape triangleShape(triangle[0], triangle[1], triangle[2]);
+    triangleShape.setMargin(meshShape->getMargin());
+    triangleShape.setUserIndex(meshShape->getUserIndex());
+
+    btCollisionObjectWrapper triangleWrap(m_meshColObjWrap,
+                                          &triangleShape,
+                                          m_meshColObjWrap->getCollisionObject(),
+                                          m_meshColObjWrap->getWorldTransform(),
+                                          partId,
+                                          triangleIndex);
+
+    if (m_triangleCollisionAlgorithm == nullptr)
+    {
+      if (m_resultOut->m_closestPointDistanceThreshold > 0)
+        m_triangleCollisionAlgorithm =
+            m_dispatcher->findAlgorithm(&triangleWrap, m_otherObjWrap, nullptr, BT_CLOSEST_POINT_ALGORITHMS);
+      else
+        m_triangleCollisionAlgorithm = m_dispatcher->findAlgorithm(
+            &triangleWrap, m_otherObjWrap, m_sharedManifold, BT_CONTACT_POINT_ALGORITHMS);
+    }
+
+    const btCollisionObjectWrapper* tmpWrap = nullptr;
+
+    /// detect swapping case
+    if (m_resultOut->getBody0Internal() == m_meshColObjWrap->getCollisionObject())
+    {
+      tmpWrap = m_resultOut->getBody0Wrap();
+      m_resultOut->setBody0Wrap(&triangleWrap);
+      m_resultOut->setShapeIdentifiersA(partId, triangleIndex);
+    }
+    else
+    {
+      tmpWrap = m_resultOut->getBody1Wrap();
+      m_resultOut->setBody1Wrap(&triangleWrap);
+      m_resultOut->setShapeIdentifiersB(partId, triangleIndex);
+    }
+
+    m_triangleCollisionAlgorithm->processCollision(&triangleWrap, m_otherObjWrap, m_dispatchInfo, m_resultOut);
+
+    if (m_resultOut->getBody0Internal() == m_meshColObjWrap->getCollisionObject())
+      m_resultOut->setBody0Wrap(tmpWrap);
+    else
+      m_resultOut->setBody1Wrap(tmpWrap);
+  }
+};
+
+TesseractTriangleMeshCollisionAlgorithm::TesseractTriangleMeshCollisionAlgorithm(
+    const btCollisionAlgorithmConstructionInfo& ci,
+    const btCollisionObjectWrapper* body0Wrap,
+    const btCollisionObjectWrapper* body1Wrap)
+  : btActivatingCollisionAlgorithm(ci, body0Wrap, body1Wrap), m_sharedManifold(ci.m_manifold)
+{
+}
+
+void TesseractTriangleMeshCollisionAlgorithm::processCollision(const btCollisionObjectWrapper* body0Wrap,
+                                                               const btCollisionObjectWrapper* body1Wrap,
+                                                               const btDispatcherInfo& dispatchInfo,
+                                                               btManifoldResult* resultOut)
+{
+  assert(body0Wrap->getCollisionShape()->getShapeType() == TRIANGLE_MESH_SHAPE_PROXYTYPE);
+  assert(body1Wrap->getCollisionShape()->getShapeType() == TRIANGLE_MESH_SHAPE_PROXYTYPE);
+
+  const auto* meshShape = static_cast<const btConcaveShape*>(body0Wrap->getCollisionShape());
+
+  // Only triangles overlapping the AABB of the other mesh, expanded by the contact distance, need to be checked
+  btTransform otherInMeshSpace = body0Wrap->getWorldTransform().inverse() * body1Wrap->getWorldTransform();
+  btVector3 localAabbMin, localAabbMax;
+  body1Wrap->getCollisionShape()->getAabb(otherInMeshSpace, localAabbMin, localAabbMax);
+  btVector3 extraExtends(resultOut->m_closestPointDistanceThreshold,
+                         resultOut->m_closestPointDistanceThreshold,
+                         resultOut->m_closestPointDistanceThreshold);
+  localAabbMin -= extraExtends;
+  localAabbMax += extraExtends;
+
+  // The triangle algorithm replaces the manifold of the result with its own which is freed with the algorithm
+  btPersistentManifold* manifold = resultOut->getPersistentManifold();
+  {
+    TesseractTriangleMeshTriangleCallback callback(
+        body0Wrap, body1Wrap, m_dispatcher, dispatchInfo, resultOut, m_sharedManifold);
+    meshShape->processAllTriangles(&callback, localAabbMin, localAabbMax);
+  }
+  resultOut->setPersistentManifold(manifold);
+}
+
+// LCOV_EXCL_START
+btScalar TesseractTriangleMeshCollisionAlgorithm::calculateTimeOfImpact(btCollisionObject* /*body0*/,
+                                                                        btCollisionObject* /*body1*/,
+                                                                        const btDispatcherInfo& /*dispatchInfo*/,
+                                                                        btManifoldResult* /*resultOut*/)
+{
+  return 1;
+}
+// LCOV_EXCL_STOP
+}  // namespace tesseract_collision::tesseract_collision_bullet
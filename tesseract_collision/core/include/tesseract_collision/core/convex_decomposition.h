@@ -28,8 +28,10 @@
 
 #include <vector>
 #include <memory>
+#include <string>
 #include <tesseract_common/types.h>
 #include <tesseract_geometry/impl/convex_mesh.h>
+#include <tesseract_geometry/impl/polygon_mesh.h>
 
 namespace tesseract_collision
 {
@@ -55,6 +57,24 @@ public:
    */
   virtual std::vector<tesseract_geometry::ConvexMesh::Ptr> compute(const tesseract_common::VectorVector3d& vertices,
                                                                    const Eigen::VectorXi& faces) const = 0;
+
+  /**
+   * @brief Run convex decomposition algorithm on multiple meshes concurrently
+   * @details Each mesh is decomposed by a call to compute so implementations must be safe to call from multiple threads.
+   * The mesh scale is not applied to the vertices which is consistent with makeConvexMesh.
+   * @param meshes The meshes to decompose
+   * @param num_threads The number of threads to use, if zero the hardware concurrency is used
+   * @return The convex decomposition of each mesh in the same order as the input meshes
+   */
+  std::vector<std::vector<tesseract_geometry::ConvexMesh::Ptr>>
+  computeBatch(const std::vector<tesseract_geometry::PolygonMesh::ConstPtr>& meshes, std::size_t num_threads = 0) const;
+
+  /**
+   * @brief Get a string uniquely identifying the algorithm and the parameters affecting its results
+   * @details This is used to key cached results so it must change when any parameter affecting the results changes.
+   * @return The parameters key, if empty the results are not cached
+   */
+  virtual std::string getParametersKey() const;
 };
 
 }  // namespace tesseract_collision
@@ -0,0 +1,124 @@
+/**
+ * @file convex_decomposition_cache.h
+ * @brief Persistent cache of convex decomposition results
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_COLLISION_CONVEX_DECOMPOSITION_CACHE_H
+#define TESSERACT_COLLISION_CONVEX_DECOMPOSITION_CACHE_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <memory>
+#include <string>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/core/convex_decomposition.h>
+
+namespace tesseract_collision
+{
+/**
+ * @brief A persistent on disk cache of convex meshes
+ * @details Every entry is stored as a binary archive in the cache directory named by its key. Entries are written to a
+ * temporary file and renamed so the cache can be shared by multiple threads and processes.
+ */
+class ConvexMeshCache
+{
+public:
+  using Ptr = std::shared_ptr<ConvexMeshCache>;
+  using ConstPtr = std::shared_ptr<const ConvexMeshCache>;
+
+  /**
+   * @brief Constructor
+   * @param directory The cache directory, it is created if it does not exist
+   */
+  ConvexMeshCache(std::string directory);
+
+  /** @brief Get the cache directory */
+  const std::string& getDirectory() const;
+
+  /**
+   * @brief Create a cache key from the mesh content and the parameters used to create the convex meshes
+   * @param vertices The mesh vertices
+   * @param faces The mesh faces
+   * @param parameters_key A string identifying the algorithm and parameters used to create the convex meshes
+   * @return The cache key
+   */
+  static std::string createKey(const tesseract_common::VectorVector3d& vertices,
+                               const Eigen::VectorXi& faces,
+                               const std::string& parameters_key);
+
+  /**
+   * @brief Load a cache entry
+   * @param meshes (Output) The cached convex meshes
+   * @param key The cache key
+   * @return True if the entry exists and was loaded, otherwise false
+   */
+  bool load(std::vector<tesseract_geometry::ConvexMesh::Ptr>& meshes, const std::string& key) const;
+
+  /**
+   * @brief Store a cache entry, replacing an existing entry with the same key
+   * @param meshes The convex meshes
+   * @param key The cache key
+   * @return True if the entry was stored, otherwise false
+   */
+  bool store(const std::vector<tesseract_geometry::ConvexMesh::Ptr>& meshes, const std::string& key) const;
+
+private:
+  std::string directory_;
+
+  std::string getFilePath(const std::string& key) const;
+};
+
+/**
+ * @brief A convex decomposition which stores the results of another convex decomposition in a persistent cache
+ * @details Results are keyed by the mesh content and the parameters key of the wrapped decomposition, so decomposing the
+ * same mesh with the same parameters is only done once. If the wrapped decomposition does not provide a parameters key
+ * the results are not cached.
+ */
+class CachedConvexDecomposition : public ConvexDecomposition
+{
+public:
+  using Ptr = std::shared_ptr<CachedConvexDecomposition>;
+  using ConstPtr = std::shared_ptr<const CachedConvexDecomposition>;
+
+  /**
+   * @brief Constructor
+   * @param decomposition The convex decomposition to cache
+   * @param cache The cache to store the results
+   */
+  CachedConvexDecomposition(ConvexDecomposition::ConstPtr decomposition, ConvexMeshCache::ConstPtr cache);
+
+  std::vector<tesseract_geometry::ConvexMesh::Ptr> compute(const tesseract_common::VectorVector3d& vertices,
+                                                           const Eigen::VectorXi& faces) const override;
+
+  std::string getParametersKey() const override;
+
+private:
+  ConvexDecomposition::ConstPtr decomposition_;
+  ConvexMeshCache::ConstPtr cache_;
+};
+
+}  // namespace tesseract_collision
+
+#endif  // TESSERACT_COLLISION_CONVEX_DECOMPOSITION_CACHE_H
@@ -221,6 +221,8 @@ public:
 
   /**
    * @brief Applies settings in the config
+   * @details The ACM in the config replaces any ACM applied by a previous config instead of being combined with it, so
+   * the same manager can have a config applied many times.
    * @param config Settings to be applies
    */
   virtual void applyContactManagerConfig(const ContactManagerConfig& config);
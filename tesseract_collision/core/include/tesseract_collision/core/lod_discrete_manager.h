@@ -0,0 +1,199 @@
+/**
+ * @file lod_discrete_manager.h
+ * @brief Discrete contact manager which checks coarse levels of detail before the full collision geometry
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_COLLISION_LOD_DISCRETE_MANAGER_H
+#define TESSERACT_COLLISION_LOD_DISCRETE_MANAGER_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <functional>
+#include <memory>
+#include <unordered_set>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/core/discrete_contact_manager.h>
+
+namespace tesseract_collision
+{
+/**
+ * @brief Function used to create the geometry of a level of detail from the full collision geometry of an object
+ * @details The generated geometry must enclose the full collision geometry so the distance between two objects at a
+ * level of detail is never larger than the distance between their full collision geometry.
+ * @param lod_shapes The shapes of the level of detail to populate
+ * @param lod_shape_poses The poses of the level of detail shapes to populate
+ * @param shapes The full collision geometry
+ * @param shape_poses The poses of the full collision geometry
+ */
+using LODGeometryFn = std::function<void(CollisionShapesConst& lod_shapes,
+                                         tesseract_common::VectorIsometry3d& lod_shape_poses,
+                                         const CollisionShapesConst& shapes,
+                                         const tesseract_common::VectorIsometry3d& shape_poses)>;
+
+/**
+ * @brief Create a bounding sphere for every shape
+ * @details Spheres, planes and octrees are kept as is. This is a LODGeometryFn.
+ * @param lod_shapes The bounding spheres
+ * @param lod_shape_poses The poses of the bounding spheres
+ * @param shapes The full collision geometry
+ * @param shape_poses The poses of the full collision geometry
+ */
+void createBoundingSpheres(CollisionShapesConst& lod_shapes,
+                           tesseract_common::VectorIsometry3d& lod_shape_poses,
+                           const CollisionShapesConst& shapes,
+                           const tesseract_common::VectorIsometry3d& shape_poses);
+
+/** @brief A coarse level of detail used by the LODDiscreteManager */
+struct LODLevel
+{
+  /** @brief The contact manager which stores the geometry of the level of detail */
+  DiscreteContactManager::UPtr manager;
+
+  /** @brief The function used to create the geometry of the level of detail */
+  LODGeometryFn geometry_fn;
+};
+
+/**
+ * @brief A discrete contact manager which checks coarse levels of detail before the full collision geometry
+ * @details Each collision object is added to every level of detail using the geometry created by the level's
+ * LODGeometryFn, for example bounding spheres, a convex hull or a convex decomposition. When performing a contact test
+ * the levels are checked from coarsest to finest and each level only checks the pairs which were found within the
+ * collision margin by the previous level. Because the geometry of a level encloses the full collision geometry the
+ * final result is identical to only checking the full collision geometry.
+ *
+ * Every level keeps its own transforms, so this is only beneficial when the full collision geometry is expensive to
+ * check, like detailed meshes.
+ */
+class LODDiscreteManager : public DiscreteContactManager
+{
+public:
+  using Ptr = std::shared_ptr<LODDiscreteManager>;
+  using ConstPtr = std::shared_ptr<const LODDiscreteManager>;
+  using UPtr = std::unique_ptr<LODDiscreteManager>;
+  using ConstUPtr = std::unique_ptr<const LODDiscreteManager>;
+
+  /**
+   * @brief Constructor
+   * @param manager The contact manager used for the full collision geometry
+   * @param levels The levels of detail ordered from coarsest to finest
+   * @param name The name of the contact manager
+   */
+  LODDiscreteManager(DiscreteContactManager::UPtr manager,
+                     std::vector<LODLevel> levels,
+                     std::string name = "LODDiscreteManager");
+  ~LODDiscreteManager() override = default;
+  LODDiscreteManager(const LODDiscreteManager&) = delete;
+  LODDiscreteManager& operator=(const LODDiscreteManager&) = delete;
+  LODDiscreteManager(LODDiscreteManager&&) = delete;
+  LODDiscreteManager& operator=(LODDiscreteManager&&) = delete;
+
+  std::string getName() const override final;
+
+  DiscreteContactManager::UPtr clone() const override final;
+
+  bool addCollisionObject(const std::string& name,
+                          const int& mask_id,
+                          const CollisionShapesConst& shapes,
+                          const tesseract_common::VectorIsometry3d& shape_poses,
+                          bool enabled = true) override final;
+
+  const CollisionShapesConst& getCollisionObjectGeometries(const std::string& name) const override final;
+
+  const tesseract_common::VectorIsometry3d&
+  getCollisionObjectGeometriesTransforms(const std::string& name) const override final;
+
+  bool hasCollisionObject(const std::string& name) const override final;
+
+  bool removeCollisionObject(const std::string& name) override final;
+
+  bool enableCollisionObject(const std::string& name) override final;
+
+  bool disableCollisionObject(const std::string& name) override final;
+
+  bool isCollisionObjectEnabled(const std::string& name) const override final;
+
+  void setCollisionObjectsTransform(const std::string& name, const Eigen::Isometry3d& pose) override final;
+
+  void setCollisionObjectsTransform(const std::vector<std::string>& names,
+                                    const tesseract_common::VectorIsometry3d& poses) override final;
+
+  void setCollisionObjectsTransform(const tesseract_common::TransformMap& transforms) override final;
+
+  const std::vector<std::string>& getCollisionObjects() const override final;
+
+  void setActiveCollisionObjects(const std::vector<std::string>& names) override final;
+
+  const std::vector<std::string>& getActiveCollisionObjects() const override final;
+
+  void setCollisionMarginData(
+      CollisionMarginData collision_margin_data,
+      CollisionMarginOverrideType override_type = CollisionMarginOverrideType::REPLACE) override final;
+
+  void setDefaultCollisionMarginData(double default_collision_margin) override final;
+
+  void setPairCollisionMarginData(const std::string& name1,
+                                  const std::string& name2,
+                                  double collision_margin) override final;
+
+  const CollisionMarginData& getCollisionMarginData() const override final;
+
+  void setIsContactAllowedFn(IsContactAllowedFn fn) override final;
+
+  IsContactAllowedFn getIsContactAllowedFn() const override final;
+
+  void contactTest(ContactResultMap& collisions, const ContactRequest& request) override final;
+
+  /**
+   * @brief Get the number of levels of detail, not including the full collision geometry
+   * @return The number of levels of detail
+   */
+  std::size_t getLevelCount() const;
+
+  /**
+   * @brief Get the contact manager of a level of detail
+   * @param level The level of detail, zero being the coarsest
+   * @return The contact manager of the level of detail
+   */
+  const DiscreteContactManager& getLevelManager(std::size_t level) const;
+
+private:
+  using CandidatePairs = std::unordered_set<tesseract_common::LinkNamesPair, tesseract_common::PairHash>;
+
+  std::string name_;
+  /** @brief The contact manager of the full collision geometry */
+  DiscreteContactManager::UPtr manager_;
+  /** @brief The levels of detail ordered from coarsest to finest */
+  std::vector<LODLevel> levels_;
+  /** @brief The pairs found within the collision margin by each level of detail */
+  std::vector<std::shared_ptr<CandidatePairs>> candidates_;
+  /** @brief The user provided function for determining if two links are allowed to be in collision */
+  IsContactAllowedFn fn_;
+
+  /** @brief Assign the IsContactAllowedFn of every level which restricts it to the previous level's candidates */
+  void updateIsContactAllowedFns();
+};
+
+}  // namespace tesseract_collision
+#endif  // TESSERACT_COLLISION_LOD_DISCRETE_MANAGER_H
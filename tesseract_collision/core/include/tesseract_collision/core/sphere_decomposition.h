@@ -0,0 +1,53 @@
+/**
+ * @file sphere_decomposition.h
+ * @brief Approximate collision geometry by a set of spheres
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_COLLISION_SPHERE_DECOMPOSITION_H
+#define TESSERACT_COLLISION_SPHERE_DECOMPOSITION_H
+
+#include <tesseract_common/types.h>
+#include <tesseract_geometry/geometry.h>
+
+namespace tesseract_collision
+{
+/**
+ * @brief Approximate a geometry by a set of spheres
+ * @details The geometry is voxelized with the provided resolution and a sphere enclosing the voxel is created for every
+ * voxel intersecting the geometry, so the union of the spheres always encloses the geometry. The distance between two
+ * sphere sets underestimates the distance between the geometries by at most the sum of the sphere radii, and this
+ * error is reduced by using a smaller resolution.
+ *
+ * Primitive shapes and convex meshes are filled while meshes, compact meshes and SDF meshes only approximate their
+ * surface because they are not required to be closed. Spheres are returned as is, octrees create a sphere for every
+ * occupied leaf and planes can not be approximated so an empty set is returned.
+ *
+ * @param geometry The geometry to approximate
+ * @param resolution The edge length of the voxels used to create the spheres
+ * @return The spheres stored as (x, y, z, radius) in the geometry frame
+ */
+tesseract_common::VectorVector4d createSphereDecomposition(const tesseract_geometry::Geometry& geometry,
+                                                            double resolution);
+
+}  // namespace tesseract_collision
+#endif  // TESSERACT_COLLISION_SPHERE_DECOMPOSITION_H
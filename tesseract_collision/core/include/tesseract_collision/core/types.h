@@ -34,6 +34,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <memory>
 #include <map>
 #include <array>
+#include <cstdint>
 #include <unordered_map>
 #include <functional>
 #include <tesseract_geometry/geometry.h>
@@ -294,6 +295,37 @@ private:
  */
 using IsContactResultValidFn = std::function<bool(const ContactResult&)>;
 
+/**
+ * @brief Bit flags identifying the optional ContactResult fields populated by the contact managers
+ * @details The distance, link names, type ids, shape ids, subshape ids and normal are always populated. Fields which
+ * are not requested are left at their default values.
+ */
+enum class ContactResultFields : std::uint8_t
+{
+  /** @brief Only populate the required fields (distance, link pair and normal) */
+  NONE = 0x00,
+  /** @brief Populate nearest_points */
+  NEAREST_POINTS = 0x01,
+  /** @brief Populate nearest_points_local */
+  NEAREST_POINTS_LOCAL = 0x02,
+  /** @brief Populate transform */
+  TRANSFORM = 0x04,
+  /** @brief Populate cc_time, cc_type and cc_transform for continuous contact managers */
+  CONTINUOUS_DATA = 0x08,
+  /** @brief Populate all fields */
+  ALL = 0x0F
+};
+
+inline ContactResultFields operator|(ContactResultFields lhs, ContactResultFields rhs)
+{
+  return static_cast<ContactResultFields>(static_cast<std::uint8_t>(lhs) | static_cast<std::uint8_t>(rhs));
+}
+
+inline ContactResultFields operator&(ContactResultFields lhs, ContactResultFields rhs)
+{
+  return static_cast<ContactResultFields>(static_cast<std::uint8_t>(lhs) & static_cast<std::uint8_t>(rhs));
+}
+
 /** @brief The ContactRequest struct */
 struct ContactRequest
 {
@@ -313,7 +345,27 @@ struct ContactRequest
   /** @brief This provides a user defined function approve/reject contact results */
   IsContactResultValidFn is_valid = nullptr;
 
+  /**
+   * @brief Identifies which optional ContactResult fields should be calculated and copied
+   * @details Set to ContactResultFields::NONE for a distance only request, which is useful for cost functions.
+   */
+  ContactResultFields result_fields = ContactResultFields::ALL;
+
   ContactRequest(ContactTestType type = ContactTestType::ALL);
+
+  /**
+   * @brief Check if the provided ContactResult field should be populated
+   * @param field The field to check
+   * @return True if all bits of field are enabled in result_fields, otherwise false
+   */
+  bool hasResultField(ContactResultFields field) const;
+
+  /**
+   * @brief Create a distance only request which skips all optional ContactResult fields
+   * @param type The contact test type
+   * @return The contact request
+   */
+  static ContactRequest makeDistanceOnly(ContactTestType type = ContactTestType::CLOSEST);
 };
 
 /**
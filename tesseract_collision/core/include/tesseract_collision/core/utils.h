@@ -27,10 +27,12 @@
 
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <unordered_set>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
 #include <tesseract_collision/core/types.h>
 #include <tesseract_collision/core/continuous_contact_manager.h>
 #include <tesseract_collision/core/discrete_contact_manager.h>
-TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 namespace tesseract_collision
 {
@@ -63,6 +65,80 @@ inline void applyIsContactAllowedFnOverride(ManagerType& manager,
   manager.setIsContactAllowedFn(combineContactAllowedFn(original, override, type));
 }
 
+/**
+ * @brief An IsContactAllowedFn that combines a base IsContactAllowedFn with an AllowedCollisionMatrix
+ * @details The ACM is flattened into an adjacency table when constructed so a check does not need to build a link pair,
+ * and the table is shared between copies so storing this in a std::function is cheap. The base IsContactAllowedFn is
+ * kept so a new override can be applied on top of the base instead of on top of this one.
+ */
+class ContactAllowedFnOverride
+{
+public:
+  /**
+   * @brief Constructor
+   * @param base The IsContactAllowedFn the override is applied to
+   * @param acm ACM used to create the override
+   * @param type Determines how the base and the ACM are combined
+   */
+  ContactAllowedFnOverride(IsContactAllowedFn base,
+                           const tesseract_common::AllowedCollisionMatrix& acm,
+                           ACMOverrideType type);
+
+  bool operator()(const std::string& link_name1, const std::string& link_name2) const;
+
+  /** @brief Get the IsContactAllowedFn the override was applied to */
+  const IsContactAllowedFn& getBase() const;
+
+  /** @brief Get the override type */
+  ACMOverrideType getType() const;
+
+private:
+  using AllowedTable = std::unordered_map<std::string, std::unordered_set<std::string>>;
+
+  IsContactAllowedFn base_;
+  std::shared_ptr<const AllowedTable> allowed_;
+  ACMOverrideType type_;
+
+  bool isAllowed(const std::string& link_name1, const std::string& link_name2) const;
+};
+
+/**
+ * @brief Get the IsContactAllowedFn without an override applied by replaceIsContactAllowedFnOverride
+ * @param fn The IsContactAllowedFn
+ * @return If fn is a ContactAllowedFnOverride its base is returned, otherwise fn
+ */
+IsContactAllowedFn getBaseContactAllowedFn(const IsContactAllowedFn& fn);
+
+/**
+ * @brief Applies ACM to contact manager using override type, replacing any override previously applied by this function
+ * @details Unlike applyIsContactAllowedFnOverride this does not wrap the current IsContactAllowedFn, so applying a config
+ * many times to the same manager does not grow the IsContactAllowedFn.
+ * @param manager Manager whose IsContactAllowedFn will be overwritten
+ * @param acm ACM used to create IsContactAllowedFn
+ * @param type Determines how the base IsContactAllowedFn and the ACM are combined
+ */
+template <typename ManagerType>
+inline void replaceIsContactAllowedFnOverride(ManagerType& manager,
+                                              const tesseract_common::AllowedCollisionMatrix& acm,
+                                              ACMOverrideType type)
+{
+  IsContactAllowedFn base = getBaseContactAllowedFn(manager.getIsContactAllowedFn());
+  if (type == ACMOverrideType::NONE)
+    manager.setIsContactAllowedFn(base);
+  else
+    manager.setIsContactAllowedFn(ContactAllowedFnOverride(std::move(base), acm, type));
+}
+
+/**
+ * @brief Removes an override applied by replaceIsContactAllowedFnOverride, restoring the base IsContactAllowedFn
+ * @param manager Manager whose IsContactAllowedFn will be restored
+ */
+template <typename ManagerType>
+inline void restoreIsContactAllowedFn(ManagerType& manager)
+{
+  manager.setIsContactAllowedFn(getBaseContactAllowedFn(manager.getIsContactAllowedFn()));
+}
+
 /**
  * @brief Loops over the map and for every object string either enables or disables it based on the value (true=enable,
  * false=disable)
@@ -0,0 +1,140 @@
+#ifndef TESSERACT_COLLISION_CONTINUOUS_BENCHMARKS_HPP
+#define TESSERACT_COLLISION_CONTINUOUS_BENCHMARKS_HPP
+
+#include <tesseract_collision/core/continuous_contact_manager.h>
+#include <tesseract_geometry/geometries.h>
+
+#include <Eigen/Eigen>
+
+namespace tesseract_collision
+{
+namespace test_suite
+{
+/**
+ * @brief Contains the information necessary to run the benchmarks for continuous collision checking
+ * @details The first object is cast from pose1_start to pose1_end while the second object is static at pose2
+ */
+struct ContinuousBenchmarkInfo
+{
+  ContinuousBenchmarkInfo(const ContinuousContactManager::ConstPtr& contact_manager,
+                          const tesseract_geometry::Geometry::ConstPtr& geom1,
+                          const Eigen::Isometry3d& pose1_start,
+                          const Eigen::Isometry3d& pose1_end,
+                          const tesseract_geometry::Geometry::ConstPtr& geom2,
+                          const Eigen::Isometry3d& pose2,
+                          ContactTestType contact_test_type)
+    : pose1_start_(pose1_start), pose1_end_(pose1_end), pose2_(pose2), contact_test_type_(contact_test_type)
+  {
+    contact_manager_ = contact_manager->clone();
+    geom1_.push_back(geom1->clone());
+    geom2_.push_back(geom2->clone());
+    obj1_poses.emplace_back(Eigen::Isometry3d::Identity());
+    obj2_poses.emplace_back(Eigen::Isometry3d::Identity());
+  }
+  ContinuousContactManager::Ptr contact_manager_;
+  CollisionShapesConst geom1_;
+  tesseract_common::VectorIsometry3d obj1_poses;
+  CollisionShapesConst geom2_;
+  tesseract_common::VectorIsometry3d obj2_poses;
+  Eigen::Isometry3d pose1_start_;
+  Eigen::Isometry3d pose1_end_;
+  Eigen::Isometry3d pose2_;
+  ContactTestType contact_test_type_;
+};
+
+/** @brief Benchmark that checks the clone method in continuous contact managers*/
+static void BM_CAST_CLONE(benchmark::State& state, ContinuousBenchmarkInfo info, std::size_t num_obj)  // NOLINT
+{
+  std::vector<std::string> active_obj;
+  active_obj.reserve(num_obj);
+  for (std::size_t ind = 0; ind < num_obj; ind++)
+  {
+    std::string name = "geom_" + std::to_string(ind);
+    active_obj.push_back(name);
+    info.contact_manager_->addCollisionObject(name, 0, info.geom1_, info.obj1_poses);
+  }
+  info.contact_manager_->setActiveCollisionObjects(active_obj);
+  info.contact_manager_->setCollisionMarginData(CollisionMarginData(0.5));
+
+  ContinuousContactManager::Ptr clone;
+  for (auto _ : state)  // NOLINT
+  {
+    benchmark::DoNotOptimize(clone = info.contact_manager_->clone());
+  }
+}
+
+/** @brief Benchmark that checks the contactTest function in continuous contact managers*/
+static void BM_CAST_CONTACT_TEST(benchmark::State& state, ContinuousBenchmarkInfo info)  // NOLINT
+{
+  info.contact_manager_->addCollisionObject(std::string("geom1"), 0, info.geom1_, info.obj1_poses);
+  info.contact_manager_->addCollisionObject(std::string("geom2"), 0, info.geom2_, info.obj2_poses);
+
+  info.contact_manager_->setActiveCollisionObjects({ "geom1" });
+  info.contact_manager_->setCollisionMarginData(CollisionMarginData(0.5));
+  info.contact_manager_->setCollisionObjectsTransform("geom1", info.pose1_start_, info.pose1_end_);
+  info.contact_manager_->setCollisionObjectsTransform("geom2", info.pose2_);
+
+  ContactResultMap result;
+  for (auto _ : state)  // NOLINT
+  {
+    result.clear();
+    info.contact_manager_->contactTest(result, ContactRequest(info.contact_test_type_));
+  }
+}
+
+/** @brief Benchmark that checks the setCollisionObjectsTransform(const std::string& name, const Eigen::Isometry3d&
+ * pose1, const Eigen::Isometry3d& pose2) method in continuous contact managers*/
+static void BM_CAST_SET_COLLISION_OBJECTS_TRANSFORM_SINGLE(benchmark::State& state,
+                                                           ContinuousBenchmarkInfo info,  // NOLINT
+                                                           std::size_t num_obj)
+{
+  // Setting up collision objects
+  std::vector<std::string> active_obj(num_obj);
+  for (std::size_t ind = 0; ind < num_obj; ind++)
+  {
+    std::string name = "geom_" + std::to_string(ind);
+    active_obj[ind] = name;
+    info.contact_manager_->addCollisionObject(name, 0, info.geom1_, info.obj1_poses);
+  }
+  info.contact_manager_->setActiveCollisionObjects(active_obj);
+  info.contact_manager_->setCollisionMarginData(CollisionMarginData(0.5));
+
+  for (auto _ : state)  // NOLINT
+  {
+    // Subtract off approximately BM_SELECT_RANDOM_OBJECT if you need absolute numbers rather than relative.
+    std::size_t selected_link = static_cast<std::size_t>(rand()) % num_obj;
+    info.contact_manager_->setCollisionObjectsTransform(active_obj[selected_link], info.pose1_start_, info.pose1_end_);
+  }
+}
+
+/** @brief Benchmark that checks the setCollisionObjectsTransform(const tesseract_common::TransformMap& pose1, const
+ * tesseract_common::TransformMap& pose2) method in continuous contact managers. Moves all of the links*/
+static void BM_CAST_SET_COLLISION_OBJECTS_TRANSFORM_MAP(benchmark::State& state,
+                                                        ContinuousBenchmarkInfo info,  // NOLINT
+                                                        std::size_t num_obj)
+{
+  // Setting up collision objects
+  std::vector<std::string> active_obj(num_obj);
+  tesseract_common::TransformMap pose1;
+  tesseract_common::TransformMap pose2;
+  for (std::size_t ind = 0; ind < num_obj; ind++)
+  {
+    std::string name = "geom_" + std::to_string(ind);
+    active_obj[ind] = name;
+    info.contact_manager_->addCollisionObject(name, 0, info.geom1_, info.obj1_poses);
+    pose1[name] = info.pose1_start_;
+    pose2[name] = info.pose1_end_;
+  }
+  info.contact_manager_->setActiveCollisionObjects(active_obj);
+  info.contact_manager_->setCollisionMarginData(CollisionMarginData(0.5));
+
+  for (auto _ : state)  // NOLINT
+  {
+    info.contact_manager_->setCollisionObjectsTransform(pose1, pose2);
+  }
+}
+
+}  // namespace test_suite
+}  // namespace tesseract_collision
+
+#endif
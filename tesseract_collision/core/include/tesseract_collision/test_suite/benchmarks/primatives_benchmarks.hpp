@@ -169,6 +169,32 @@ static void BM_SET_COLLISION_OBJECTS_TRANSFORM_MAP(benchmark::State& state,
   }
 }
 
+/** @brief Benchmark that checks the setCollisionObjectsTransform(const tesseract_common::TransformMap& transforms)
+ * method in discrete contact managers. Moves all of the links, which is typical when updating from a robot state*/
+static void BM_SET_COLLISION_OBJECTS_TRANSFORM_MAP_ALL(benchmark::State& state,
+                                                       DiscreteBenchmarkInfo info,  // NOLINT
+                                                       std::size_t num_obj)
+{
+  // Setting up collision objects
+  std::vector<std::string> active_obj(num_obj);
+  tesseract_common::TransformMap transforms;
+  for (std::size_t ind = 0; ind < num_obj; ind++)
+  {
+    std::string name = "geom_" + std::to_string(ind);
+    active_obj[ind] = name;
+    info.contact_manager_->addCollisionObject(name, 0, info.geom1_, info.obj1_poses);
+    transforms[name] = info.obj2_poses[0];
+  }
+  info.contact_manager_->setActiveCollisionObjects(active_obj);
+  info.contact_manager_->setCollisionMarginData(CollisionMarginData(0.5));
+
+  for (auto _ : state)  // NOLINT
+  {
+    info.contact_manager_->setCollisionObjectsTransform(transforms);
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(num_obj));
+}
+
 }  // namespace test_suite
 }  // namespace tesseract_collision
 
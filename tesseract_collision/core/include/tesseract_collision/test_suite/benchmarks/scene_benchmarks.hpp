@@ -0,0 +1,181 @@
+#ifndef TESSERACT_COLLISION_SCENE_BENCHMARKS_HPP
+#define TESSERACT_COLLISION_SCENE_BENCHMARKS_HPP
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <octomap/octomap.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/bullet/convex_hull_utils.h>
+#include <tesseract_collision/core/discrete_contact_manager.h>
+#include <tesseract_collision/core/common.h>
+#include <tesseract_geometry/geometries.h>
+#include <tesseract_geometry/mesh_parser.h>
+
+namespace tesseract_collision
+{
+namespace test_suite
+{
+/**
+ * @brief Load a mesh from tesseract_support
+ * @param relative_path The path relative to the tesseract_support directory
+ * @param convex If true the convex hull of the mesh is returned
+ */
+inline CollisionShapePtr loadSupportMesh(const std::string& relative_path, bool convex = false)
+{
+  auto meshes = tesseract_geometry::createMeshFromPath<tesseract_geometry::Mesh>(
+      std::string(TESSERACT_SUPPORT_DIR) + "/" + relative_path, Eigen::Vector3d(1, 1, 1), true, true);
+  if (meshes.empty())
+    throw std::runtime_error("Failed to load mesh: " + relative_path);
+
+  if (convex)
+    return makeConvexMesh(*meshes.front());
+
+  return meshes.front();
+}
+
+/**
+ * @brief Add a grid of spheres to a discrete contact manager, each as its own active link
+ * @param checker The contact manager
+ * @param edge_size The number of spheres along each edge of the grid
+ */
+inline void addSphereGrid(DiscreteContactManager& checker, int edge_size)
+{
+  auto sphere = std::make_shared<tesseract_geometry::Sphere>(0.25);
+  double delta = 0.55;
+
+  std::vector<std::string> link_names;
+  tesseract_common::TransformMap location;
+  for (int x = 0; x < edge_size; ++x)
+  {
+    for (int y = 0; y < edge_size; ++y)
+    {
+      for (int z = 0; z < edge_size; ++z)
+      {
+        CollisionShapesConst shapes{ sphere };
+        tesseract_common::VectorIsometry3d poses{ Eigen::Isometry3d::Identity() };
+
+        link_names.push_back("sphere_link_" + std::to_string(x) + std::to_string(y) + std::to_string(z));
+        location[link_names.back()] = Eigen::Isometry3d::Identity();
+        location[link_names.back()].translation() = Eigen::Vector3d(
+            static_cast<double>(x) * delta, static_cast<double>(y) * delta, static_cast<double>(z) * delta);
+        checker.addCollisionObject(link_names.back(), 0, shapes, poses);
+      }
+    }
+  }
+
+  checker.setActiveCollisionObjects(link_names);
+  checker.setCollisionMarginData(CollisionMarginData(0.1));
+  checker.setCollisionObjectsTransform(location);
+}
+
+/**
+ * @brief Benchmark that checks collisions between two detailed meshes
+ * @param checker The contact manager to clone
+ * @param mesh1 The path of the first mesh relative to the tesseract_support directory
+ * @param mesh2 The path of the second mesh relative to the tesseract_support directory
+ * @param offset The translation along the x-axis of the second mesh
+ * @param type The contact test type
+ */
+static void BM_MESH_MESH(benchmark::State& state,
+                         const DiscreteContactManager::ConstPtr& checker,  // NOLINT
+                         const std::string& mesh1,
+                         const std::string& mesh2,
+                         double offset,
+                         ContactTestType type)
+{
+  DiscreteContactManager::Ptr manager = checker->clone();
+
+  CollisionShapesConst obj1_shapes{ loadSupportMesh(mesh1) };
+  tesseract_common::VectorIsometry3d obj1_poses{ Eigen::Isometry3d::Identity() };
+  manager->addCollisionObject("mesh1_link", 0, obj1_shapes, obj1_poses);
+
+  CollisionShapesConst obj2_shapes{ loadSupportMesh(mesh2) };
+  tesseract_common::VectorIsometry3d obj2_poses{ Eigen::Isometry3d::Identity() };
+  manager->addCollisionObject("mesh2_link", 0, obj2_shapes, obj2_poses);
+
+  Eigen::Isometry3d mesh2_pose = Eigen::Isometry3d::Identity();
+  mesh2_pose.translation() = Eigen::Vector3d(offset, 0, 0);
+
+  manager->setActiveCollisionObjects({ "mesh1_link", "mesh2_link" });
+  manager->setCollisionMarginData(CollisionMarginData(0.1));
+  manager->setCollisionObjectsTransform("mesh2_link", mesh2_pose);
+
+  ContactResultMap result;
+  for (auto _ : state)  // NOLINT
+  {
+    result.clear();
+    manager->contactTest(result, ContactRequest(type));
+  }
+  state.counters["contacts"] = static_cast<double>(result.count());
+}
+
+/**
+ * @brief Benchmark that checks collisions between an octomap and the collision links of a robot
+ * @details The robot links are the convex hulls of the KUKA iiwa7 collision meshes which are stacked along the z-axis
+ * through the octomap.
+ * @param checker The contact manager to clone
+ * @param sub_type The shape used to represent each occupied voxel
+ * @param num_links The number of robot links, at most 8
+ */
+static void BM_OCTOMAP_ROBOT(benchmark::State& state,
+                             const DiscreteContactManager::ConstPtr& checker,  // NOLINT
+                             tesseract_geometry::Octree::SubType sub_type,
+                             std::size_t num_links)
+{
+  DiscreteContactManager::Ptr manager = checker->clone();
+
+  std::string path = std::string(TESSERACT_SUPPORT_DIR) + "/meshes/blender_monkey.bt";
+  auto ot = std::make_shared<octomap::OcTree>(path);
+  CollisionShapesConst octomap_shapes{ std::make_shared<tesseract_geometry::Octree>(ot, sub_type) };
+  tesseract_common::VectorIsometry3d octomap_poses{ Eigen::Isometry3d::Identity() };
+  manager->addCollisionObject("octomap_link", 0, octomap_shapes, octomap_poses);
+
+  std::vector<std::string> link_names;
+  tesseract_common::TransformMap location;
+  for (std::size_t i = 0; i < num_links; ++i)
+  {
+    link_names.push_back("link_" + std::to_string(i));
+    CollisionShapesConst shapes{ loadSupportMesh("meshes/iiwa7/collision/" + link_names.back() + ".stl", true) };
+    tesseract_common::VectorIsometry3d poses{ Eigen::Isometry3d::Identity() };
+    manager->addCollisionObject(link_names.back(), 0, shapes, poses);
+
+    location[link_names.back()] = Eigen::Isometry3d::Identity();
+    location[link_names.back()].translation() = Eigen::Vector3d(0, 0, -0.5 + (0.15 * static_cast<double>(i)));
+  }
+
+  manager->setActiveCollisionObjects(link_names);
+  manager->setCollisionMarginData(CollisionMarginData(0.02));
+  manager->setCollisionObjectsTransform(location);
+
+  ContactResultMap result;
+  for (auto _ : state)  // NOLINT
+  {
+    result.clear();
+    manager->contactTest(result, ContactRequest(ContactTestType::FIRST));
+  }
+}
+
+/**
+ * @brief Benchmark that checks calling contactTest concurrently on clones of the same contact manager
+ * @details This should be registered with Threads(n). Each thread clones the contact manager before the timed loop
+ * so the results show how contact checking scales with threads, not the cost of cloning.
+ * @param checker The contact manager to clone, it must already contain the scene
+ */
+static void BM_CONTACT_TEST_MULTI_THREADED(benchmark::State& state,
+                                           const DiscreteContactManager::ConstPtr& checker)  // NOLINT
+{
+  DiscreteContactManager::Ptr manager = checker->clone();
+
+  ContactResultMap result;
+  for (auto _ : state)  // NOLINT
+  {
+    result.clear();
+    manager->contactTest(result, ContactRequest(ContactTestType::ALL));
+  }
+}
+
+}  // namespace test_suite
+}  // namespace tesseract_collision
+
+#endif
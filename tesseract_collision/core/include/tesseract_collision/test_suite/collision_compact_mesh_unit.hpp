@@ -0,0 +1,143 @@
+#ifndef TESSERACT_COLLISION_COLLISION_COMPACT_MESH_UNIT_HPP
+#define TESSERACT_COLLISION_COLLISION_COMPACT_MESH_UNIT_HPP
+
+#include <tesseract_collision/core/discrete_contact_manager.h>
+#include <tesseract_collision/core/common.h>
+#include <tesseract_geometry/geometries.h>
+
+namespace tesseract_collision::test_suite
+{
+namespace detail
+{
+inline tesseract_geometry::CompactMesh::Ptr createCompactSphere()
+{
+  auto vertices = std::make_shared<tesseract_common::VectorVector3d>();
+  auto faces = std::make_shared<Eigen::VectorXi>();
+  int num_faces =
+      loadSimplePlyFile(std::string(TESSERACT_SUPPORT_DIR) + "/meshes/sphere_p25m.ply", *vertices, *faces, true);
+  EXPECT_GT(num_faces, 0);
+
+  auto compact_mesh = std::make_shared<tesseract_geometry::CompactMesh>(tesseract_geometry::Mesh(vertices, faces));
+  EXPECT_EQ(compact_mesh->getTriangleCount(), num_faces);
+  return compact_mesh;
+}
+
+inline void addCompactMeshCollisionObjects(DiscreteContactManager& checker)
+{
+  //////////////////////////////////////////
+  // Add two compact meshes sharing buffers
+  //////////////////////////////////////////
+  tesseract_geometry::CompactMesh::Ptr sphere = createCompactSphere();
+
+  CollisionShapesConst obj1_shapes{ sphere };
+  tesseract_common::VectorIsometry3d obj1_poses{ Eigen::Isometry3d::Identity() };
+  checker.addCollisionObject("compact_link", 0, obj1_shapes, obj1_poses);
+
+  CollisionShapesConst obj2_shapes{ sphere->clone() };
+  tesseract_common::VectorIsometry3d obj2_poses{ Eigen::Isometry3d::Identity() };
+  checker.addCollisionObject("compact1_link", 0, obj2_shapes, obj2_poses);
+
+  ////////////////////////////////////////
+  // Add a primitive sphere to the checker
+  ////////////////////////////////////////
+  CollisionShapesConst obj3_shapes{ std::make_shared<tesseract_geometry::Sphere>(0.25) };
+  tesseract_common::VectorIsometry3d obj3_poses{ Eigen::Isometry3d::Identity() };
+  checker.addCollisionObject("sphere_link", 0, obj3_shapes, obj3_poses);
+
+  EXPECT_EQ(checker.getCollisionObjects().size(), 3);
+  for (const auto& co : checker.getCollisionObjects())
+  {
+    EXPECT_EQ(checker.getCollisionObjectGeometries(co).size(), 1);
+    EXPECT_EQ(checker.getCollisionObjectGeometriesTransforms(co).size(), 1);
+  }
+}
+
+/**
+ * @brief Check the compact mesh on compact_link against the object on other_link
+ * @details The other object is moved along the y axis where the closest feature of the compact mesh is a vertex at
+ * y = 0.25.
+ */
+inline void runCompactMeshTest(DiscreteContactManager& checker,
+                               const std::string& other_link,
+                               double other_radius,
+                               double closest_distance_tolerance)
+{
+  checker.setActiveCollisionObjects({ "compact_link", other_link });
+  checker.setDefaultCollisionMarginData(0);
+
+  tesseract_common::TransformMap location;
+  location["compact_link"] = Eigen::Isometry3d::Identity();
+  location["compact1_link"] = Eigen::Isometry3d::Identity();
+  location["sphere_link"] = Eigen::Isometry3d::Identity();
+  location["compact1_link"].translation() = Eigen::Vector3d(0, 5, 0);
+  location["sphere_link"].translation() = Eigen::Vector3d(0, 5, 0);
+
+  //////////////////////////////////////
+  // Test when the objects penetrate
+  //////////////////////////////////////
+  location[other_link].translation() = Eigen::Vector3d(0.2, 0, 0);
+  checker.setCollisionObjectsTransform(location);
+
+  ContactResultMap result;
+  checker.contactTest(result, ContactRequest(ContactTestType::ALL));
+
+  ContactResultVector result_vector;
+  result.flattenMoveResults(result_vector);
+  EXPECT_FALSE(result_vector.empty());
+  for (const auto& cr : result_vector)
+  {
+    EXPECT_LE(cr.distance, 0.0);
+
+    // Contacts report the index of the geometry in the collision object
+    EXPECT_EQ(cr.shape_id[0], 0);
+    EXPECT_EQ(cr.shape_id[1], 0);
+  }
+
+  ///////////////////////////////////////////////
+  // Test object is out side the contact distance
+  ///////////////////////////////////////////////
+  location[other_link].translation() = Eigen::Vector3d(0, 1, 0);
+  checker.setCollisionObjectsTransform(location);
+
+  result.clear();
+  result_vector.clear();
+  checker.contactTest(result, ContactRequest(ContactTestType::ALL));
+  result.flattenCopyResults(result_vector);
+  EXPECT_TRUE(result_vector.empty());
+
+  /////////////////////////////////////////////////////////////////////////////
+  // Test object inside the contact distance (Closest Feature Vertex to Vertex)
+  /////////////////////////////////////////////////////////////////////////////
+  checker.setCollisionMarginData(CollisionMarginData(0.55));
+
+  result.clear();
+  result_vector.clear();
+  checker.contactTest(result, ContactRequest(ContactTestType::CLOSEST));
+  result.flattenMoveResults(result_vector);
+
+  ASSERT_FALSE(result_vector.empty());
+  EXPECT_NEAR(result_vector[0].distance, 0.75 - other_radius, closest_distance_tolerance);
+
+  std::vector<int> idx = { 0, 1, 1 };
+  if (result_vector[0].link_names[0] != "compact_link")
+    idx = { 1, 0, -1 };
+
+  EXPECT_NEAR(result_vector[0].nearest_points[static_cast<size_t>(idx[0])][1], 0.25, closest_distance_tolerance);
+  EXPECT_NEAR(
+      result_vector[0].nearest_points[static_cast<size_t>(idx[1])][1], 1.0 - other_radius, closest_distance_tolerance);
+  EXPECT_GT((idx[2] * result_vector[0].normal).dot(Eigen::Vector3d(0, 1, 0)), 0.0);
+}
+}  // namespace detail
+
+inline void runTest(DiscreteContactManager& checker)
+{
+  detail::addCompactMeshCollisionObjects(checker);
+
+  // Compact mesh against a primitive
+  detail::runCompactMeshTest(checker, "sphere_link", 0.25, 0.001);
+
+  // Compact mesh against a compact mesh, the closest features are vertices on the y axis
+  detail::runCompactMeshTest(checker, "compact1_link", 0.25, 0.001);
+}
+}  // namespace tesseract_collision::test_suite
+#endif  // TESSERACT_COLLISION_COLLISION_COMPACT_MESH_UNIT_HPP
@@ -124,6 +124,19 @@ inline void runTestTyped(DiscreteContactManager& checker, double tol, ContactTes
     EXPECT_FALSE(result_vector.empty());
     EXPECT_TRUE(result_vector[0].distance < 0.1);
   }
+
+  ///////////////////////////////////////////////////////////////
+  // Test when object is outside the bounds of the occupied voxels
+  ///////////////////////////////////////////////////////////////
+  location["sphere_link"].translation() = Eigen::Vector3d(0, 0, 5);
+  checker.setCollisionObjectsTransform(location);
+
+  result.clear();
+  result_vector.clear();
+  checker.contactTest(result, ContactRequest(test_type));
+  result.flattenMoveResults(result_vector);
+
+  EXPECT_TRUE(result_vector.empty());
 }
 }  // namespace detail
 
@@ -237,6 +237,54 @@ inline void runTestPrimitive(DiscreteContactManager& checker)
   EXPECT_NEAR(result_vector[0].normal[0], idx[2] * 1.0, 0.001);
   EXPECT_NEAR(result_vector[0].normal[1], idx[2] * 0.0, 0.001);
   EXPECT_NEAR(result_vector[0].normal[2], idx[2] * 0.0, 0.001);
+
+  /////////////////////////////////////////////
+  // Test distance only request
+  /////////////////////////////////////////////
+  result.clear();
+  result_vector.clear();
+
+  checker.contactTest(result, ContactRequest::makeDistanceOnly(ContactTestType::CLOSEST));
+  result.flattenMoveResults(result_vector);
+
+  EXPECT_TRUE(!result_vector.empty());
+  EXPECT_NEAR(result_vector[0].distance, 0.5, 0.0001);
+  EXPECT_NEAR(result_vector[0].normal[0], idx[2] * 1.0, 0.001);
+  EXPECT_NEAR(result_vector[0].normal[1], idx[2] * 0.0, 0.001);
+  EXPECT_NEAR(result_vector[0].normal[2], idx[2] * 0.0, 0.001);
+  EXPECT_TRUE(result_vector[0].nearest_points[0].isZero());
+  EXPECT_TRUE(result_vector[0].nearest_points[1].isZero());
+  EXPECT_TRUE(result_vector[0].nearest_points_local[0].isZero());
+  EXPECT_TRUE(result_vector[0].nearest_points_local[1].isZero());
+  EXPECT_TRUE(result_vector[0].transform[0].isApprox(Eigen::Isometry3d::Identity()));
+  EXPECT_TRUE(result_vector[0].transform[1].isApprox(Eigen::Isometry3d::Identity()));
+
+  /////////////////////////////////////////////////////////////
+  // Test object moving into the contact distance in small steps
+  /////////////////////////////////////////////////////////////
+  checker.setCollisionMarginData(CollisionMarginData(0.1));
+  for (int i = 0; i <= 40; ++i)
+  {
+    const double x = 0.9 - (0.01 * i);
+    location["sphere1_link"].translation() = Eigen::Vector3d(x, 0, 0);
+    checker.setCollisionObjectsTransform("sphere1_link", location["sphere1_link"]);
+
+    result.clear();
+    result_vector.clear();
+    checker.contactTest(result, ContactRequest(ContactTestType::CLOSEST));
+    result.flattenMoveResults(result_vector);
+
+    const double expected_distance = x - 0.5;
+    if (expected_distance < 0.1 - 1e-6)
+    {
+      ASSERT_FALSE(result_vector.empty()) << "x = " << x;
+      EXPECT_NEAR(result_vector[0].distance, expected_distance, 0.0001);
+    }
+    else if (expected_distance > 0.1 + 1e-6)
+    {
+      EXPECT_TRUE(result_vector.empty()) << "x = " << x;
+    }
+  }
 }
 
 inline void runTestConvex1(DiscreteContactManager& checker)
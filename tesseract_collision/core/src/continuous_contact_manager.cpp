@@ -32,7 +32,7 @@ namespace tesseract_collision
 void ContinuousContactManager::applyContactManagerConfig(const ContactManagerConfig& config)
 {
   setCollisionMarginData(config.margin_data, config.margin_data_override_type);
-  applyIsContactAllowedFnOverride(*this, config.acm, config.acm_override_type);
+  replaceIsContactAllowedFnOverride(*this, config.acm, config.acm_override_type);
   applyModifyObjectEnabled(*this, config.modify_object_enabled);
 }
 }  // namespace tesseract_collision
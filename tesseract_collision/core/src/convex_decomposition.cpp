@@ -0,0 +1,47 @@
+/**
+ * @file convex_decomposition.cpp
+ * @brief Convex decomposition interface
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+#include <tesseract_common/parallel_for.h>
+#include <tesseract_collision/core/convex_decomposition.h>
+
+namespace tesseract_collision
+{
+std::vector<std::vector<tesseract_geometry::ConvexMesh::Ptr>>
+ConvexDecomposition::computeBatch(const std::vector<tesseract_geometry::PolygonMesh::ConstPtr>& meshes,
+                                  std::size_t num_threads) const
+{
+  std::vector<std::vector<tesseract_geometry::ConvexMesh::Ptr>> results(meshes.size());
+  tesseract_common::parallelFor(meshes.size(), num_threads, [&](std::size_t i, std::size_t /*thread_index*/) {
+    results[i] = compute(*meshes[i]->getVertices(), *meshes[i]->getFaces());
+  });
+
+  return results;
+}
+
+std::string ConvexDecomposition::getParametersKey() const { return {}; }
+
+}  // namespace tesseract_collision
@@ -0,0 +1,155 @@
+/**
+ * @file convex_decomposition_cache.cpp
+ * @brief Persistent cache of convex decomposition results
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <console_bridge/console.h>
+#include <boost/serialization/shared_ptr.hpp>
+#include <boost/serialization/vector.hpp>
+#include <iomanip>
+#include <sstream>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/core/convex_decomposition_cache.h>
+#include <tesseract_common/serialization.h>
+#include <tesseract_common/utils.h>
+
+namespace tesseract_collision
+{
+ConvexMeshCache::ConvexMeshCache(std::string directory) : directory_(std::move(directory))
+{
+  boost::system::error_code ec;
+  tesseract_common::fs::create_directories(directory_, ec);
+  if (ec)
+    CONSOLE_BRIDGE_logError("ConvexMeshCache, failed to create directory '%s': %s",
+                            directory_.c_str(),
+                            ec.message().c_str());
+}
+
+const std::string& ConvexMeshCache::getDirectory() const { return directory_; }
+
+std::string ConvexMeshCache::createKey(const tesseract_common::VectorVector3d& vertices,
+                                       const Eigen::VectorXi& faces,
+                                       const std::string& parameters_key)
+{
+  // The hash is stable across platforms and runs so the key can be used to name files
+  std::uint64_t hash = tesseract_common::hashBytes(parameters_key.data(), parameters_key.size());
+  for (const auto& v : vertices)
+    hash = tesseract_common::hashBytes(v.data(), 3 * sizeof(double), hash);
+  hash = tesseract_common::hashBytes(faces.data(), static_cast<std::size_t>(faces.size()) * sizeof(int), hash);
+
+  // The sizes are included to further reduce the chance of a collision
+  std::stringstream ss;
+  ss << std::hex << std::setfill('0') << std::setw(16) << hash << std::dec << "_" << vertices.size() << "_"
+     << faces.size();
+  return ss.str();
+}
+
+bool ConvexMeshCache::load(std::vector<tesseract_geometry::ConvexMesh::Ptr>& meshes, const std::string& key) const
+{
+  const std::string file_path = getFilePath(key);
+  if (!tesseract_common::fs::exists(file_path))
+    return false;
+
+  try
+  {
+    meshes = tesseract_common::Serialization::fromArchiveFileBinary<std::vector<tesseract_geometry::ConvexMesh::Ptr>>(
+        file_path);
+  }
+  catch (const std::exception& e)
+  {
+    CONSOLE_BRIDGE_logWarn("ConvexMeshCache, failed to load '%s': %s", file_path.c_str(), e.what());
+    return false;
+  }
+
+  return true;
+}
+
+bool ConvexMeshCache::store(const std::vector<tesseract_geometry::ConvexMesh::Ptr>& meshes,
+                            const std::string& key) const
+{
+  const std::string file_path = getFilePath(key);
+
+  // Write to a unique temporary file and rename so a partially written entry is never loaded
+  const std::string tmp_path = tesseract_common::fs::unique_path(file_path + ".%%%%-%%%%-%%%%.tmp").string();
+
+  try
+  {
+    tesseract_common::Serialization::toArchiveFileBinary<std::vector<tesseract_geometry::ConvexMesh::Ptr>>(
+        meshes, tmp_path);
+    tesseract_common::fs::rename(tmp_path, file_path);
+  }
+  catch (const std::exception& e)
+  {
+    CONSOLE_BRIDGE_logWarn("ConvexMeshCache, failed to store '%s': %s", file_path.c_str(), e.what());
+    boost::system::error_code ec;
+    tesseract_common::fs::remove(tmp_path, ec);
+    return false;
+  }
+
+  return true;
+}
+
+std::string ConvexMeshCache::getFilePath(const std::string& key) const
+{
+  return (tesseract_common::fs::path(directory_) / (key + ".bin")).string();
+}
+
+CachedConvexDecomposition::CachedConvexDecomposition(ConvexDecomposition::ConstPtr decomposition,
+                                                     ConvexMeshCache::ConstPtr cache)
+  : decomposition_(std::move(decomposition)), cache_(std::move(cache))
+{
+  if (decomposition_ == nullptr)
+    throw std::runtime_error("CachedConvexDecomposition, the decomposition is a nullptr!");
+
+  if (cache_ == nullptr)
+    throw std::runtime_error("CachedConvexDecomposition, the cache is a nullptr!");
+}
+
+std::vector<tesseract_geometry::ConvexMesh::Ptr>
+CachedConvexDecomposition::compute(const tesseract_common::VectorVector3d& vertices, const Eigen::VectorXi& faces) const
+{
+  const std::string parameters_key = decomposition_->getParametersKey();
+  if (parameters_key.empty())
+    return decomposition_->compute(vertices, faces);
+
+  const std::string key = ConvexMeshCache::createKey(vertices, faces, parameters_key);
+  std::vector<tesseract_geometry::ConvexMesh::Ptr> meshes;
+  if (cache_->load(meshes, key))
+    return meshes;
+
+  meshes = decomposition_->compute(vertices, faces);
+
+  // Failed decompositions are not stored so they are retried
+  if (!meshes.empty())
+    cache_->store(meshes, key);
+
+  return meshes;
+}
+
+std::string CachedConvexDecomposition::getParametersKey() const { return decomposition_->getParametersKey(); }
+
+}  // namespace tesseract_collision
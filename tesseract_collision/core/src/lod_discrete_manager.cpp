@@ -0,0 +1,393 @@
+/**
+ * @file lod_discrete_manager.cpp
+ * @brief Discrete contact manager which checks coarse levels of detail before the full collision geometry
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <cmath>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/core/lod_discrete_manager.h>
+#include <tesseract_common/metrics.h>
+#include <tesseract_geometry/geometries.h>
+
+namespace tesseract_collision
+{
+void createBoundingSpheres(CollisionShapesConst& lod_shapes,
+                           tesseract_common::VectorIsometry3d& lod_shape_poses,
+                           const CollisionShapesConst& shapes,
+                           const tesseract_common::VectorIsometry3d& shape_poses)
+{
+  lod_shapes.clear();
+  lod_shape_poses.clear();
+  lod_shapes.reserve(shapes.size());
+  lod_shape_poses.reserve(shapes.size());
+
+  for (std::size_t i = 0; i < shapes.size(); ++i)
+  {
+    const CollisionShapeConstPtr& shape = shapes[i];
+    switch (shape->getType())
+    {
+      case tesseract_geometry::GeometryType::BOX:
+      {
+        const auto& box = static_cast<const tesseract_geometry::Box&>(*shape);
+        double radius = 0.5 * Eigen::Vector3d(box.getX(), box.getY(), box.getZ()).norm();
+        lod_shapes.push_back(std::make_shared<tesseract_geometry::Sphere>(radius));
+        lod_shape_poses.push_back(shape_poses[i]);
+        break;
+      }
+      case tesseract_geometry::GeometryType::CYLINDER:
+      {
+        const auto& cylinder = static_cast<const tesseract_geometry::Cylinder&>(*shape);
+        double radius = std::hypot(cylinder.getRadius(), 0.5 * cylinder.getLength());
+        lod_shapes.push_back(std::make_shared<tesseract_geometry::Sphere>(radius));
+        lod_shape_poses.push_back(shape_poses[i]);
+        break;
+      }
+      case tesseract_geometry::GeometryType::CONE:
+      {
+        const auto& cone = static_cast<const tesseract_geometry::Cone&>(*shape);
+        double radius = std::hypot(cone.getRadius(), 0.5 * cone.getLength());
+        lod_shapes.push_back(std::make_shared<tesseract_geometry::Sphere>(radius));
+        lod_shape_poses.push_back(shape_poses[i]);
+        break;
+      }
+      case tesseract_geometry::GeometryType::CAPSULE:
+      {
+        const auto& capsule = static_cast<const tesseract_geometry::Capsule&>(*shape);
+        double radius = capsule.getRadius() + 0.5 * capsule.getLength();
+        lod_shapes.push_back(std::make_shared<tesseract_geometry::Sphere>(radius));
+        lod_shape_poses.push_back(shape_poses[i]);
+        break;
+      }
+      case tesseract_geometry::GeometryType::MESH:
+      case tesseract_geometry::GeometryType::CONVEX_MESH:
+      case tesseract_geometry::GeometryType::SDF_MESH:
+      case tesseract_geometry::GeometryType::POLYGON_MESH:
+      {
+        const auto& mesh = static_cast<const tesseract_geometry::PolygonMesh&>(*shape);
+        const tesseract_common::VectorVector3d& vertices = *mesh.getVertices();
+        if (vertices.empty())
+        {
+          lod_shapes.push_back(shape);
+          lod_shape_poses.push_back(shape_poses[i]);
+          break;
+        }
+
+        // The center of the bounding box is used as the center of the sphere
+        Eigen::AlignedBox3d aabb;
+        for (const auto& v : vertices)
+          aabb.extend(v);
+
+        const Eigen::Vector3d center = aabb.center();
+        double squared_radius{ 0 };
+        for (const auto& v : vertices)
+          squared_radius = std::max(squared_radius, (v - center).squaredNorm());
+
+        lod_shapes.push_back(std::make_shared<tesseract_geometry::Sphere>(std::sqrt(squared_radius)));
+        lod_shape_poses.push_back(shape_poses[i] * Eigen::Translation3d(center));
+        break;
+      }
+      case tesseract_geometry::GeometryType::COMPACT_MESH:
+      {
+        const auto& mesh = static_cast<const tesseract_geometry::CompactMesh&>(*shape);
+        const auto vertex_count = static_cast<std::size_t>(mesh.getVertexCount());
+        if (vertex_count == 0)
+        {
+          lod_shapes.push_back(shape);
+          lod_shape_poses.push_back(shape_poses[i]);
+          break;
+        }
+
+        Eigen::AlignedBox3d aabb;
+        for (std::size_t j = 0; j < vertex_count; ++j)
+          aabb.extend(mesh.getVertex(j));
+
+        const Eigen::Vector3d center = aabb.center();
+        double squared_radius{ 0 };
+        for (std::size_t j = 0; j < vertex_count; ++j)
+          squared_radius = std::max(squared_radius, (mesh.getVertex(j) - center).squaredNorm());
+
+        lod_shapes.push_back(std::make_shared<tesseract_geometry::Sphere>(std::sqrt(squared_radius)));
+        lod_shape_poses.push_back(shape_poses[i] * Eigen::Translation3d(center));
+        break;
+      }
+      default:
+      {
+        lod_shapes.push_back(shape);
+        lod_shape_poses.push_back(shape_poses[i]);
+        break;
+      }
+    }
+  }
+}
+
+LODDiscreteManager::LODDiscreteManager(DiscreteContactManager::UPtr manager,
+                                       std::vector<LODLevel> levels,
+                                       std::string name)
+  : name_(std::move(name)), manager_(std::move(manager)), levels_(std::move(levels))
+{
+  if (manager_ == nullptr)
+    throw std::runtime_error("LODDiscreteManager, the contact manager is a nullptr!");
+
+  for (const auto& level : levels_)
+  {
+    if (level.manager == nullptr || level.geometry_fn == nullptr)
+      throw std::runtime_error("LODDiscreteManager, level of detail is missing a contact manager or geometry function!");
+  }
+
+  candidates_.reserve(levels_.size());
+  for (std::size_t i = 0; i < levels_.size(); ++i)
+    candidates_.push_back(std::make_shared<CandidatePairs>());
+
+  fn_ = manager_->getIsContactAllowedFn();
+  updateIsContactAllowedFns();
+}
+
+std::string LODDiscreteManager::getName() const { return name_; }
+
+DiscreteContactManager::UPtr LODDiscreteManager::clone() const
+{
+  std::vector<LODLevel> levels;
+  levels.reserve(levels_.size());
+  for (const auto& level : levels_)
+    levels.push_back(LODLevel{ level.manager->clone(), level.geometry_fn });
+
+  auto manager = std::make_unique<LODDiscreteManager>(manager_->clone(), std::move(levels), name_);
+  manager->setIsContactAllowedFn(fn_);
+  return manager;
+}
+
+bool LODDiscreteManager::addCollisionObject(const std::string& name,
+                                            const int& mask_id,
+                                            const CollisionShapesConst& shapes,
+                                            const tesseract_common::VectorIsometry3d& shape_poses,
+                                            bool enabled)
+{
+  if (!manager_->addCollisionObject(name, mask_id, shapes, shape_poses, enabled))
+    return false;
+
+  for (auto& level : levels_)
+  {
+    CollisionShapesConst lod_shapes;
+    tesseract_common::VectorIsometry3d lod_shape_poses;
+    level.geometry_fn(lod_shapes, lod_shape_poses, shapes, shape_poses);
+
+    // Fall back to the full collision geometry so the level still includes the object
+    if (!level.manager->addCollisionObject(name, mask_id, lod_shapes, lod_shape_poses, enabled) &&
+        !level.manager->addCollisionObject(name, mask_id, shapes, shape_poses, enabled))
+    {
+      removeCollisionObject(name);
+      return false;
+    }
+  }
+
+  return true;
+}
+
+const CollisionShapesConst& LODDiscreteManager::getCollisionObjectGeometries(const std::string& name) const
+{
+  return manager_->getCollisionObjectGeometries(name);
+}
+
+const tesseract_common::VectorIsometry3d&
+LODDiscreteManager::getCollisionObjectGeometriesTransforms(const std::string& name) const
+{
+  return manager_->getCollisionObjectGeometriesTransforms(name);
+}
+
+bool LODDiscreteManager::hasCollisionObject(const std::string& name) const { return manager_->hasCollisionObject(name); }
+
+bool LODDiscreteManager::removeCollisionObject(const std::string& name)
+{
+  for (auto& level : levels_)
+    level.manager->removeCollisionObject(name);
+
+  return manager_->removeCollisionObject(name);
+}
+
+bool LODDiscreteManager::enableCollisionObject(const std::string& name)
+{
+  for (auto& level : levels_)
+    level.manager->enableCollisionObject(name);
+
+  return manager_->enableCollisionObject(name);
+}
+
+bool LODDiscreteManager::disableCollisionObject(const std::string& name)
+{
+  for (auto& level : levels_)
+    level.manager->disableCollisionObject(name);
+
+  return manager_->disableCollisionObject(name);
+}
+
+bool LODDiscreteManager::isCollisionObjectEnabled(const std::string& name) const
+{
+  return manager_->isCollisionObjectEnabled(name);
+}
+
+void LODDiscreteManager::setCollisionObjectsTransform(const std::string& name, const Eigen::Isometry3d& pose)
+{
+  for (auto& level : levels_)
+    level.manager->setCollisionObjectsTransform(name, pose);
+
+  manager_->setCollisionObjectsTransform(name, pose);
+}
+
+void LODDiscreteManager::setCollisionObjectsTransform(const std::vector<std::string>& names,
+                                                      const tesseract_common::VectorIsometry3d& poses)
+{
+  for (auto& level : levels_)
+    level.manager->setCollisionObjectsTransform(names, poses);
+
+  manager_->setCollisionObjectsTransform(names, poses);
+}
+
+void LODDiscreteManager::setCollisionObjectsTransform(const tesseract_common::TransformMap& transforms)
+{
+  for (auto& level : levels_)
+    level.manager->setCollisionObjectsTransform(transforms);
+
+  manager_->setCollisionObjectsTransform(transforms);
+}
+
+const std::vector<std::string>& LODDiscreteManager::getCollisionObjects() const
+{
+  return manager_->getCollisionObjects();
+}
+
+void LODDiscreteManager::setActiveCollisionObjects(const std::vector<std::string>& names)
+{
+  for (auto& level : levels_)
+    level.manager->setActiveCollisionObjects(names);
+
+  manager_->setActiveCollisionObjects(names);
+}
+
+const std::vector<std::string>& LODDiscreteManager::getActiveCollisionObjects() const
+{
+  return manager_->getActiveCollisionObjects();
+}
+
+void LODDiscreteManager::setCollisionMarginData(CollisionMarginData collision_margin_data,
+                                                CollisionMarginOverrideType override_type)
+{
+  for (auto& level : levels_)
+    level.manager->setCollisionMarginData(collision_margin_data, override_type);
+
+  manager_->setCollisionMarginData(std::move(collision_margin_data), override_type);
+}
+
+void LODDiscreteManager::setDefaultCollisionMarginData(double default_collision_margin)
+{
+  for (auto& level : levels_)
+    level.manager->setDefaultCollisionMarginData(default_collision_margin);
+
+  manager_->setDefaultCollisionMarginData(default_collision_margin);
+}
+
+void LODDiscreteManager::setPairCollisionMarginData(const std::string& name1,
+                                                    const std::string& name2,
+                                                    double collision_margin)
+{
+  for (auto& level : levels_)
+    level.manager->setPairCollisionMarginData(name1, name2, collision_margin);
+
+  manager_->setPairCollisionMarginData(name1, name2, collision_margin);
+}
+
+const CollisionMarginData& LODDiscreteManager::getCollisionMarginData() const
+{
+  return manager_->getCollisionMarginData();
+}
+
+void LODDiscreteManager::setIsContactAllowedFn(IsContactAllowedFn fn)
+{
+  fn_ = std::move(fn);
+  updateIsContactAllowedFns();
+}
+
+IsContactAllowedFn LODDiscreteManager::getIsContactAllowedFn() const { return fn_; }
+
+void LODDiscreteManager::contactTest(ContactResultMap& collisions, const ContactRequest& request)
+{
+  TESSERACT_COMMON_METRICS_SCOPE("LODDiscreteManager::contactTest");
+  // The levels only need to know which pairs are within the collision margin
+  ContactRequest lod_request(ContactTestType::ALL);
+  lod_request.calculate_penetration = false;
+  lod_request.calculate_distance = true;
+  lod_request.result_fields = ContactResultFields::NONE;
+
+  ContactResultMap lod_collisions;
+  for (std::size_t i = 0; i < levels_.size(); ++i)
+  {
+    lod_collisions.clear();
+    levels_[i].manager->contactTest(lod_collisions, lod_request);
+
+    CandidatePairs& candidates = *candidates_[i];
+    candidates.clear();
+    for (const auto& pair : lod_collisions)
+      candidates.insert(pair.first);
+
+    if (candidates.empty())
+      return;
+  }
+
+  manager_->contactTest(collisions, request);
+}
+
+std::size_t LODDiscreteManager::getLevelCount() const { return levels_.size(); }
+
+const DiscreteContactManager& LODDiscreteManager::getLevelManager(std::size_t level) const
+{
+  return *levels_.at(level).manager;
+}
+
+void LODDiscreteManager::updateIsContactAllowedFns()
+{
+  auto restrict_fn = [this](const std::shared_ptr<const CandidatePairs>& candidates) -> IsContactAllowedFn {
+    return [fn = fn_, candidates](const std::string& name1, const std::string& name2) {
+      if (fn != nullptr && fn(name1, name2))
+        return true;
+
+      return (candidates->find(tesseract_common::makeOrderedLinkPair(name1, name2)) == candidates->end());
+    };
+  };
+
+  if (levels_.empty())
+  {
+    manager_->setIsContactAllowedFn(fn_);
+    return;
+  }
+
+  levels_.front().manager->setIsContactAllowedFn(fn_);
+  for (std::size_t i = 1; i < levels_.size(); ++i)
+    levels_[i].manager->setIsContactAllowedFn(restrict_fn(candidates_[i - 1]));
+
+  manager_->setIsContactAllowedFn(restrict_fn(candidates_.back()));
+}
+
+}  // namespace tesseract_collision
@@ -0,0 +1,370 @@
+/**
+ * @file sphere_decomposition.cpp
+ * @brief Approximate collision geometry by a set of spheres
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <functional>
+#include <stdexcept>
+#include <unordered_set>
+#include <octomap/octomap.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/core/sphere_decomposition.h>
+#include <tesseract_geometry/geometries.h>
+
+namespace tesseract_collision
+{
+namespace
+{
+/** @brief A regular grid of voxels covering an axis aligned bounding box */
+struct VoxelGrid
+{
+  VoxelGrid(const Eigen::Vector3d& min, const Eigen::Vector3d& max, double voxel_size)
+    : origin(min), resolution(voxel_size)
+  {
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+      auto axis = static_cast<Eigen::Index>(i);
+      size[i] = std::max<long>(1, static_cast<long>(std::ceil((max[axis] - min[axis]) / resolution)));
+    }
+  }
+
+  Eigen::Vector3d center(long x, long y, long z) const
+  {
+    return origin + resolution * Eigen::Vector3d(static_cast<double>(x) + 0.5,
+                                                 static_cast<double>(y) + 0.5,
+                                                 static_cast<double>(z) + 0.5);
+  }
+
+  std::size_t key(long x, long y, long z) const { return static_cast<std::size_t>((x * size[1] + y) * size[2] + z); }
+
+  Eigen::Vector3d center(std::size_t key) const
+  {
+    auto k = static_cast<long>(key);
+    return center(k / (size[1] * size[2]), (k / size[2]) % size[1], k % size[2]);
+  }
+
+  long index(double value, std::size_t axis) const
+  {
+    auto i = static_cast<long>(std::floor((value - origin[static_cast<Eigen::Index>(axis)]) / resolution));
+    return std::clamp<long>(i, 0, size[axis] - 1);
+  }
+
+  Eigen::Vector3d origin;
+  double resolution;
+  std::array<long, 3> size{ 1, 1, 1 };
+};
+
+/**
+ * @brief Create a sphere for every voxel whose center is within the radius of the sphere of a signed distance field
+ * @details Because a signed distance field is 1-Lipschitz every voxel containing a point inside the geometry passes
+ * this test so the spheres enclose the geometry.
+ */
+void decomposeSignedDistance(tesseract_common::VectorVector4d& spheres,
+                             const std::function<double(const Eigen::Vector3d&)>& sdf,
+                             const Eigen::Vector3d& half_extents,
+                             double resolution)
+{
+  const double radius = 0.5 * std::sqrt(3.0) * resolution;
+  VoxelGrid grid(-half_extents, half_extents, resolution);
+  for (long x = 0; x < grid.size[0]; ++x)
+  {
+    for (long y = 0; y < grid.size[1]; ++y)
+    {
+      for (long z = 0; z < grid.size[2]; ++z)
+      {
+        Eigen::Vector3d c = grid.center(x, y, z);
+        if (sdf(c) <= radius)
+          spheres.emplace_back(c.x(), c.y(), c.z(), radius);
+      }
+    }
+  }
+}
+
+/** @brief Get the closest point on a triangle, see Real-Time Collision Detection by Christer Ericson */
+Eigen::Vector3d closestPointOnTriangle(const Eigen::Vector3d& p,
+                                       const Eigen::Vector3d& a,
+                                       const Eigen::Vector3d& b,
+                                       const Eigen::Vector3d& c)
+{
+  const Eigen::Vector3d ab = b - a;
+  const Eigen::Vector3d ac = c - a;
+  const Eigen::Vector3d ap = p - a;
+  const double d1 = ab.dot(ap);
+  const double d2 = ac.dot(ap);
+  if (d1 <= 0 && d2 <= 0)
+    return a;
+
+  const Eigen::Vector3d bp = p - b;
+  const double d3 = ab.dot(bp);
+  const double d4 = ac.dot(bp);
+  if (d3 >= 0 && d4 <= d3)
+    return b;
+
+  const double vc = d1 * d4 - d3 * d2;
+  if (vc <= 0 && d1 >= 0 && d3 <= 0)
+    return a + (d1 / (d1 - d3)) * ab;
+
+  const Eigen::Vector3d cp = p - c;
+  const double d5 = ab.dot(cp);
+  const double d6 = ac.dot(cp);
+  if (d6 >= 0 && d5 <= d6)
+    return c;
+
+  const double vb = d5 * d2 - d1 * d6;
+  if (vb <= 0 && d2 >= 0 && d6 <= 0)
+    return a + (d2 / (d2 - d6)) * ac;
+
+  const double va = d3 * d6 - d5 * d4;
+  if (va <= 0 && (d4 - d3) >= 0 && (d5 - d6) >= 0)
+    return b + ((d4 - d3) / ((d4 - d3) + (d5 - d6))) * (c - b);
+
+  const double denom = 1.0 / (va + vb + vc);
+  return a + ab * (vb * denom) + ac * (vc * denom);
+}
+
+void decomposePolygonMesh(tesseract_common::VectorVector4d& spheres,
+                          const tesseract_geometry::PolygonMesh& mesh,
+                          double resolution,
+                          bool fill)
+{
+  const tesseract_common::VectorVector3d& vertices = *mesh.getVertices();
+  const Eigen::VectorXi& faces = *mesh.getFaces();
+  if (vertices.empty())
+    return;
+
+  Eigen::Vector3d min = vertices.front();
+  Eigen::Vector3d max = vertices.front();
+  for (const auto& v : vertices)
+  {
+    min = min.cwiseMin(v);
+    max = max.cwiseMax(v);
+  }
+
+  const double radius = 0.5 * std::sqrt(3.0) * resolution;
+  VoxelGrid grid(min, max, resolution);
+  std::unordered_set<std::size_t> keys;
+
+  // Triangulate the polygons as a fan and keep every voxel whose center is within the radius of a triangle
+  tesseract_common::VectorVector4d planes;
+  for (Eigen::Index f = 0; f < faces.size(); f += faces[f] + 1)
+  {
+    const int num_vertices = faces[f];
+    const Eigen::Vector3d& a = vertices[static_cast<std::size_t>(faces[f + 1])];
+    for (int i = 2; i < num_vertices; ++i)
+    {
+      const Eigen::Vector3d& b = vertices[static_cast<std::size_t>(faces[f + i])];
+      const Eigen::Vector3d& c = vertices[static_cast<std::size_t>(faces[f + i + 1])];
+      const Eigen::Vector3d tri_min = a.cwiseMin(b).cwiseMin(c).array() - radius;
+      const Eigen::Vector3d tri_max = a.cwiseMax(b).cwiseMax(c).array() + radius;
+      for (long x = grid.index(tri_min.x(), 0); x <= grid.index(tri_max.x(), 0); ++x)
+      {
+        for (long y = grid.index(tri_min.y(), 1); y <= grid.index(tri_max.y(), 1); ++y)
+        {
+          for (long z = grid.index(tri_min.z(), 2); z <= grid.index(tri_max.z(), 2); ++z)
+          {
+            Eigen::Vector3d p = grid.center(x, y, z);
+            if ((closestPointOnTriangle(p, a, b, c) - p).squaredNorm() <= radius * radius)
+              keys.insert(grid.key(x, y, z));
+          }
+        }
+      }
+
+      if (fill)
+      {
+        Eigen::Vector3d normal = (b - a).cross(c - a);
+        if (normal.squaredNorm() > 0)
+        {
+          normal.normalize();
+          planes.emplace_back(normal.x(), normal.y(), normal.z(), -normal.dot(a));
+        }
+      }
+    }
+  }
+
+  // Voxels inside a convex mesh are on the same side of every face as the centroid
+  if (fill && !planes.empty())
+  {
+    Eigen::Vector3d centroid = Eigen::Vector3d::Zero();
+    for (const auto& v : vertices)
+      centroid += v;
+    centroid /= static_cast<double>(vertices.size());
+
+    for (auto& plane : planes)
+    {
+      if (plane.head<3>().dot(centroid) + plane[3] > 0)
+        plane = -plane;
+    }
+
+    for (long x = 0; x < grid.size[0]; ++x)
+    {
+      for (long y = 0; y < grid.size[1]; ++y)
+      {
+        for (long z = 0; z < grid.size[2]; ++z)
+        {
+          Eigen::Vector3d p = grid.center(x, y, z);
+          if (std::all_of(planes.begin(), planes.end(), [&p](const Eigen::Vector4d& plane) {
+                return plane.head<3>().dot(p) + plane[3] <= 0;
+              }))
+            keys.insert(grid.key(x, y, z));
+        }
+      }
+    }
+  }
+
+  // Sort the voxels so the result does not depend on the hash set
+  std::vector<std::size_t> sorted_keys(keys.begin(), keys.end());
+  std::sort(sorted_keys.begin(), sorted_keys.end());
+  spheres.reserve(sorted_keys.size());
+  for (std::size_t key : sorted_keys)
+  {
+    Eigen::Vector3d c = grid.center(key);
+    spheres.emplace_back(c.x(), c.y(), c.z(), radius);
+  }
+}
+}  // namespace
+
+tesseract_common::VectorVector4d createSphereDecomposition(const tesseract_geometry::Geometry& geometry,
+                                                            double resolution)
+{
+  if (resolution <= 0)
+    throw std::runtime_error("createSphereDecomposition, the resolution must be greater than zero!");
+
+  tesseract_common::VectorVector4d spheres;
+  switch (geometry.getType())
+  {
+    case tesseract_geometry::GeometryType::SPHERE:
+    {
+      const auto& sphere = static_cast<const tesseract_geometry::Sphere&>(geometry);
+      spheres.emplace_back(0, 0, 0, sphere.getRadius());
+      break;
+    }
+    case tesseract_geometry::GeometryType::BOX:
+    {
+      const auto& box = static_cast<const tesseract_geometry::Box&>(geometry);
+      const Eigen::Vector3d half_extents(0.5 * box.getX(), 0.5 * box.getY(), 0.5 * box.getZ());
+      auto sdf = [&half_extents](const Eigen::Vector3d& p) {
+        Eigen::Vector3d q = p.cwiseAbs() - half_extents;
+        return q.cwiseMax(0.0).norm() + std::min(q.maxCoeff(), 0.0);
+      };
+      decomposeSignedDistance(spheres, sdf, half_extents, resolution);
+      break;
+    }
+    case tesseract_geometry::GeometryType::CYLINDER:
+    {
+      const auto& cylinder = static_cast<const tesseract_geometry::Cylinder&>(geometry);
+      const double r = cylinder.getRadius();
+      const double h = 0.5 * cylinder.getLength();
+      auto sdf = [r, h](const Eigen::Vector3d& p) {
+        Eigen::Vector2d d(p.head<2>().norm() - r, std::abs(p.z()) - h);
+        return std::min(d.maxCoeff(), 0.0) + d.cwiseMax(0.0).norm();
+      };
+      decomposeSignedDistance(spheres, sdf, Eigen::Vector3d(r, r, h), resolution);
+      break;
+    }
+    case tesseract_geometry::GeometryType::CAPSULE:
+    {
+      const auto& capsule = static_cast<const tesseract_geometry::Capsule&>(geometry);
+      const double r = capsule.getRadius();
+      const double h = 0.5 * capsule.getLength();
+      auto sdf = [r, h](const Eigen::Vector3d& p) {
+        return (p - Eigen::Vector3d(0, 0, std::clamp(p.z(), -h, h))).norm() - r;
+      };
+      decomposeSignedDistance(spheres, sdf, Eigen::Vector3d(r, r, h + r), resolution);
+      break;
+    }
+    case tesseract_geometry::GeometryType::CONE:
+    {
+      // The apex of the cone is located at +z and the base at -z
+      const auto& cone = static_cast<const tesseract_geometry::Cone&>(geometry);
+      const double r = cone.getRadius();
+      const double h = 0.5 * cone.getLength();
+      auto sdf = [r, h](const Eigen::Vector3d& p) {
+        const Eigen::Vector2d q(p.head<2>().norm(), p.z());
+        const Eigen::Vector2d k1(0, h);
+        const Eigen::Vector2d k2(-r, 2.0 * h);
+        const Eigen::Vector2d ca(q.x() - std::min(q.x(), (q.y() < 0) ? r : 0.0), std::abs(q.y()) - h);
+        const Eigen::Vector2d cb = q - k1 + k2 * std::clamp((k1 - q).dot(k2) / k2.squaredNorm(), 0.0, 1.0);
+        const double s = (cb.x() < 0 && ca.y() < 0) ? -1.0 : 1.0;
+        return s * std::sqrt(std::min(ca.squaredNorm(), cb.squaredNorm()));
+      };
+      decomposeSignedDistance(spheres, sdf, Eigen::Vector3d(r, r, h), resolution);
+      break;
+    }
+    case tesseract_geometry::GeometryType::CONVEX_MESH:
+    {
+      decomposePolygonMesh(spheres, static_cast<const tesseract_geometry::PolygonMesh&>(geometry), resolution, true);
+      break;
+    }
+    case tesseract_geometry::GeometryType::MESH:
+    case tesseract_geometry::GeometryType::SDF_MESH:
+    case tesseract_geometry::GeometryType::POLYGON_MESH:
+    {
+      decomposePolygonMesh(spheres, static_cast<const tesseract_geometry::PolygonMesh&>(geometry), resolution, false);
+      break;
+    }
+    case tesseract_geometry::GeometryType::COMPACT_MESH:
+    {
+      const auto& geom = static_cast<const tesseract_geometry::CompactMesh&>(geometry);
+      decomposePolygonMesh(spheres, *geom.toMesh(), resolution, false);
+      break;
+    }
+    case tesseract_geometry::GeometryType::OCTREE:
+    {
+      const auto& geom = static_cast<const tesseract_geometry::Octree&>(geometry);
+      const octomap::OcTree& octree = *geom.getOctree();
+      const double occupancy_threshold = octree.getOccupancyThres();
+      const double scale = (geom.getSubType() == tesseract_geometry::Octree::SubType::SPHERE_INSIDE) ?
+                               0.5 :
+                               0.5 * std::sqrt(3.0);
+      for (auto it = octree.begin_leafs(), end = octree.end_leafs(); it != end; ++it)
+      {
+        if (it->getOccupancy() >= occupancy_threshold)
+          spheres.emplace_back(it.getX(), it.getY(), it.getZ(), scale * it.getSize());
+      }
+      break;
+    }
+    case tesseract_geometry::GeometryType::PLANE:
+    {
+      break;
+    }
+    // LCOV_EXCL_START
+    default:
+    {
+      throw std::runtime_error("createSphereDecomposition, unsupported geometry type '" +
+                               tesseract_geometry::GeometryTypeStrings[static_cast<std::size_t>(geometry.getType())] +
+                               "'!");
+    }
+      // LCOV_EXCL_STOP
+  }
+
+  return spheres;
+}
+
+}  // namespace tesseract_collision
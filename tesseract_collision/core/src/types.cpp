@@ -57,6 +57,15 @@ void ContactResult::clear()
 
 ContactRequest::ContactRequest(ContactTestType type) : type(type) {}
 
+bool ContactRequest::hasResultField(ContactResultFields field) const { return (result_fields & field) == field; }
+
+ContactRequest ContactRequest::makeDistanceOnly(ContactTestType type)
+{
+  ContactRequest request(type);
+  request.result_fields = ContactResultFields::NONE;
+  return request;
+}
+
 ContactResult& ContactResultMap::addContactResult(const KeyType& key, ContactResult result)
 {
   assert(tesseract_common::makeOrderedLinkPair(key.first, key.second) == key);
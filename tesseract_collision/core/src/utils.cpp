@@ -49,4 +49,51 @@ IsContactAllowedFn combineContactAllowedFn(const IsContactAllowedFn& original,
       return original;  // LCOV_EXCL_LINE
   }
 }
+
+ContactAllowedFnOverride::ContactAllowedFnOverride(IsContactAllowedFn base,
+                                                   const tesseract_common::AllowedCollisionMatrix& acm,
+                                                   ACMOverrideType type)
+  : base_(std::move(base)), type_(type)
+{
+  auto allowed = std::make_shared<AllowedTable>();
+  for (const auto& entry : acm.getAllAllowedCollisions())
+  {
+    (*allowed)[entry.first.first].insert(entry.first.second);
+    (*allowed)[entry.first.second].insert(entry.first.first);
+  }
+  allowed_ = allowed;
+}
+
+bool ContactAllowedFnOverride::operator()(const std::string& link_name1, const std::string& link_name2) const
+{
+  switch (type_)
+  {
+    case ACMOverrideType::NONE:
+      return (base_ == nullptr) ? false : base_(link_name1, link_name2);
+    case ACMOverrideType::ASSIGN:
+      return isAllowed(link_name1, link_name2);
+    case ACMOverrideType::AND:
+      return (base_ == nullptr) ? false : isAllowed(link_name1, link_name2) && base_(link_name1, link_name2);
+    case ACMOverrideType::OR:
+      return isAllowed(link_name1, link_name2) || (base_ != nullptr && base_(link_name1, link_name2));
+    default:         // LCOV_EXCL_LINE
+      return false;  // LCOV_EXCL_LINE
+  }
+}
+
+const IsContactAllowedFn& ContactAllowedFnOverride::getBase() const { return base_; }
+
+ACMOverrideType ContactAllowedFnOverride::getType() const { return type_; }
+
+bool ContactAllowedFnOverride::isAllowed(const std::string& link_name1, const std::string& link_name2) const
+{
+  auto it = allowed_->find(link_name1);
+  return (it != allowed_->end() && it->second.find(link_name2) != it->second.end());
+}
+
+IsContactAllowedFn getBaseContactAllowedFn(const IsContactAllowedFn& fn)
+{
+  const auto* override = fn.target<ContactAllowedFnOverride>();
+  return (override == nullptr) ? fn : override->getBase();
+}
 }  // namespace tesseract_collision
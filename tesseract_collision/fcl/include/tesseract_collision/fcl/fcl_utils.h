@@ -45,6 +45,7 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <fcl/broadphase/broadphase_dynamic_AABB_tree-inl.h>
+#include <fcl/geometry/octree/octree.h>
 #include <fcl/narrowphase/collision-inl.h>
 #include <fcl/narrowphase/distance-inl.h>
 #include <memory>
@@ -188,6 +189,21 @@ protected:
   double contact_distance_{ 0 }; /**< @brief The contact distance threshold */
 };
 
+/**
+ * @brief This is an fcl octree where the local AABB only bounds the occupied voxels
+ *
+ * By default fcl uses the bounds of the root node for the local AABB, which covers the full range of the octomap keys
+ * (hundreds of meters), so every object in the broadphase overlaps the octree and must be checked in narrowphase.
+ */
+class FCLOcTree : public fcl::OcTreed
+{
+public:
+  explicit FCLOcTree(const std::shared_ptr<const octomap::OcTree>& tree);
+
+  /** @brief Compute the local AABB from the occupied leaf nodes */
+  void computeLocalAABB() override;
+};
+
 CollisionGeometryPtr createShapePrimitive(const CollisionShapeConstPtr& geom);
 
 using COW = CollisionObjectWrapper;
@@ -40,6 +40,7 @@
  */
 
 #include <tesseract_collision/fcl/fcl_discrete_managers.h>
+#include <tesseract_common/metrics.h>
 
 namespace tesseract_collision::tesseract_collision_fcl
 {
@@ -313,6 +314,7 @@ IsContactAllowedFn FCLDiscreteBVHManager::getIsContactAllowedFn() const { return
 
 void FCLDiscreteBVHManager::contactTest(ContactResultMap& collisions, const ContactRequest& request)
 {
+  TESSERACT_COMMON_METRICS_SCOPE("FCLDiscreteBVHManager::contactTest");
   ContactTestData cdata(active_, collision_margin_data_, fn_, request, collisions);
   if (collision_margin_data_.getMaxCollisionMargin() > 0 && request.calculate_distance)
   {
@@ -54,6 +54,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_collision/fcl/fcl_utils.h>
 #include <tesseract_geometry/geometries.h>
+#include <tesseract_common/metrics.h>
 
 namespace tesseract_collision::tesseract_collision_fcl
 {
@@ -117,6 +118,37 @@ CollisionGeometryPtr createShapePrimitive(const tesseract_geometry::Mesh::ConstP
   return nullptr;
 }
 
+CollisionGeometryPtr createShapePrimitive(const tesseract_geometry::CompactMesh::ConstPtr& geom)
+{
+  int vertice_count = geom->getVertexCount();
+  int triangle_count = geom->getTriangleCount();
+  const std::vector<std::uint32_t>& triangles = *(geom->getTriangles());
+
+  if (vertice_count > 0 && triangle_count > 0)
+  {
+    // FCL stores the model in double precision so the buffers can not be referenced directly
+    tesseract_common::VectorVector3d vertices;
+    vertices.reserve(static_cast<size_t>(vertice_count));
+    for (std::size_t i = 0; i < static_cast<size_t>(vertice_count); ++i)
+      vertices.push_back(geom->getVertex(i));
+
+    std::vector<fcl::Triangle> tri_indices;
+    tri_indices.reserve(static_cast<size_t>(triangle_count));
+    for (std::size_t i = 0; i < triangles.size(); i += 3)
+      tri_indices.emplace_back(triangles[i], triangles[i + 1], triangles[i + 2]);
+
+    auto g = std::make_shared<fcl::BVHModel<fcl::OBBRSSd>>();
+    g->beginModel(triangle_count, vertice_count);
+    g->addSubModel(vertices, tri_indices);
+    g->endModel();
+
+    return g;
+  }
+
+  CONSOLE_BRIDGE_logError("The mesh is empty!");
+  return nullptr;
+}
+
 CollisionGeometryPtr createShapePrimitive(const tesseract_geometry::ConvexMesh::ConstPtr& geom)
 {
   int vertice_count = geom->getVertexCount();
@@ -133,13 +165,43 @@ CollisionGeometryPtr createShapePrimitive(const tesseract_geometry::ConvexMesh::
   return nullptr;
 }
 
+FCLOcTree::FCLOcTree(const std::shared_ptr<const octomap::OcTree>& tree) : fcl::OcTreed(tree) {}
+
+void FCLOcTree::computeLocalAABB()
+{
+  bool empty{ true };
+  for (auto it = tree->begin_leafs(), end = tree->end_leafs(); it != end; ++it)
+  {
+    if (!isNodeOccupied(&(*it)))
+      continue;
+
+    fcl::Vector3d center(it.getX(), it.getY(), it.getZ());
+    fcl::Vector3d delta = fcl::Vector3d::Constant(it.getSize() / 2.0);
+    if (empty)
+    {
+      aabb_local = fcl::AABBd(center - delta, center + delta);
+      empty = false;
+    }
+    else
+    {
+      aabb_local += fcl::AABBd(center - delta, center + delta);
+    }
+  }
+
+  if (empty)
+    aabb_local = fcl::AABBd(fcl::Vector3d::Zero());
+
+  aabb_center = aabb_local.center();
+  aabb_radius = (aabb_local.min_ - aabb_center).norm();
+}
+
 CollisionGeometryPtr createShapePrimitive(const tesseract_geometry::Octree::ConstPtr& geom)
 {
   switch (geom->getSubType())
   {
     case tesseract_geometry::Octree::SubType::BOX:
     {
-      return std::make_shared<fcl::OcTreed>(geom->getOctree());
+      return std::make_shared<FCLOcTree>(geom->getOctree());
     }
     default:
     {
@@ -186,6 +248,10 @@ CollisionGeometryPtr createShapePrimitive(const CollisionShapeConstPtr& geom)
     {
       return createShapePrimitive(std::static_pointer_cast<const tesseract_geometry::ConvexMesh>(geom));
     }
+    case tesseract_geometry::GeometryType::COMPACT_MESH:
+    {
+      return createShapePrimitive(std::static_pointer_cast<const tesseract_geometry::CompactMesh>(geom));
+    }
     case tesseract_geometry::GeometryType::OCTREE:
     {
       return createShapePrimitive(std::static_pointer_cast<const tesseract_geometry::Octree>(geom));
@@ -206,6 +272,7 @@ bool collisionCallback(fcl::CollisionObjectd* o1, fcl::CollisionObjectd* o2, voi
   if (cdata->done)
     return true;
 
+  TESSERACT_COMMON_METRICS_COUNT("tesseract_collision::broadphase_pairs", 1);
   const auto* cd1 = static_cast<const CollisionObjectWrapper*>(o1->getUserData());
   const auto* cd2 = static_cast<const CollisionObjectWrapper*>(o2->getUserData());
 
@@ -226,14 +293,23 @@ bool collisionCallback(fcl::CollisionObjectd* o1, fcl::CollisionObjectd* o2, voi
     num_contacts = 1;
 
   fcl::CollisionResultd col_result;
+  TESSERACT_COMMON_METRICS_COUNT("tesseract_collision::narrowphase_calls", 1);
   fcl::collide(o1, o2, fcl::CollisionRequestd(num_contacts, cdata->req.calculate_penetration, 1, false), col_result);
 
   if (col_result.isCollision())
   {
+    const bool calc_points = cdata->req.hasResultField(ContactResultFields::NEAREST_POINTS);
+    const bool calc_local = cdata->req.hasResultField(ContactResultFields::NEAREST_POINTS_LOCAL);
+    const bool calc_transform = cdata->req.hasResultField(ContactResultFields::TRANSFORM);
     const Eigen::Isometry3d& tf1 = cd1->getCollisionObjectsTransform();
     const Eigen::Isometry3d& tf2 = cd2->getCollisionObjectsTransform();
-    Eigen::Isometry3d tf1_inv = tf1.inverse();
-    Eigen::Isometry3d tf2_inv = tf2.inverse();
+    Eigen::Isometry3d tf1_inv;
+    Eigen::Isometry3d tf2_inv;
+    if (calc_local)
+    {
+      tf1_inv = tf1.inverse();
+      tf2_inv = tf2.inverse();
+    }
 
     for (size_t i = 0; i < col_result.numContacts(); ++i)
     {
@@ -245,12 +321,21 @@ bool collisionCallback(fcl::CollisionObjectd* o1, fcl::CollisionObjectd* o2, voi
       contact.shape_id[1] = static_cast<int>(cd2->getShapeIndex(o2));
       contact.subshape_id[0] = static_cast<int>(fcl_contact.b1);
       contact.subshape_id[1] = static_cast<int>(fcl_contact.b2);
-      contact.nearest_points[0] = fcl_contact.pos;
-      contact.nearest_points[1] = fcl_contact.pos;
-      contact.nearest_points_local[0] = tf1_inv * contact.nearest_points[0];
-      contact.nearest_points_local[1] = tf2_inv * contact.nearest_points[1];
-      contact.transform[0] = tf1;
-      contact.transform[1] = tf2;
+      if (calc_points)
+      {
+        contact.nearest_points[0] = fcl_contact.pos;
+        contact.nearest_points[1] = fcl_contact.pos;
+      }
+      if (calc_local)
+      {
+        contact.nearest_points_local[0] = tf1_inv * fcl_contact.pos;
+        contact.nearest_points_local[1] = tf2_inv * fcl_contact.pos;
+      }
+      if (calc_transform)
+      {
+        contact.transform[0] = tf1;
+        contact.transform[1] = tf2;
+      }
       contact.type_id[0] = cd1->getTypeID();
       contact.type_id[1] = cd2->getTypeID();
       contact.distance = -1.0 * fcl_contact.penetration_depth;
@@ -274,6 +359,7 @@ bool distanceCallback(fcl::CollisionObjectd* o1, fcl::CollisionObjectd* o2, void
   if (cdata->done)
     return true;
 
+  TESSERACT_COMMON_METRICS_COUNT("tesseract_collision::broadphase_pairs", 1);
   const auto* cd1 = static_cast<const CollisionObjectWrapper*>(o1->getUserData());
   const auto* cd2 = static_cast<const CollisionObjectWrapper*>(o2->getUserData());
 
@@ -290,15 +376,11 @@ bool distanceCallback(fcl::CollisionObjectd* o1, fcl::CollisionObjectd* o2, void
 
   fcl::DistanceResultd fcl_result;
   fcl::DistanceRequestd fcl_request(true, true);
+  TESSERACT_COMMON_METRICS_COUNT("tesseract_collision::narrowphase_calls", 1);
   double d = fcl::distance(o1, o2, fcl_request, fcl_result);
 
   if (d < cdata->collision_margin_data.getMaxCollisionMargin())
   {
-    const Eigen::Isometry3d& tf1 = cd1->getCollisionObjectsTransform();
-    const Eigen::Isometry3d& tf2 = cd2->getCollisionObjectsTransform();
-    Eigen::Isometry3d tf1_inv = tf1.inverse();
-    Eigen::Isometry3d tf2_inv = tf2.inverse();
-
     ContactResult contact;
     contact.link_names[0] = cd1->getName();
     contact.link_names[1] = cd2->getName();
@@ -306,19 +388,33 @@ bool distanceCallback(fcl::CollisionObjectd* o1, fcl::CollisionObjectd* o2, void
     contact.shape_id[1] = cd2->getShapeIndex(o2);
     contact.subshape_id[0] = static_cast<int>(fcl_result.b1);
     contact.subshape_id[1] = static_cast<int>(fcl_result.b2);
-    contact.nearest_points[0] = fcl_result.nearest_points[0];
-    contact.nearest_points[1] = fcl_result.nearest_points[1];
-    contact.nearest_points_local[0] = tf1_inv * contact.nearest_points[0];
-    contact.nearest_points_local[1] = tf2_inv * contact.nearest_points[1];
-    contact.transform[0] = tf1;
-    contact.transform[1] = tf2;
     contact.type_id[0] = cd1->getTypeID();
     contact.type_id[1] = cd2->getTypeID();
     contact.distance = fcl_result.min_distance;
-    contact.normal = (fcl_result.min_distance * (contact.nearest_points[1] - contact.nearest_points[0])).normalized();
+    // Note: The nearest points are always calculated by fcl because they are required to compute the normal
+    contact.normal =
+        (fcl_result.min_distance * (fcl_result.nearest_points[1] - fcl_result.nearest_points[0])).normalized();
 
     // TODO: There is an issue with FCL need to track down
-    assert(!std::isnan(contact.nearest_points[0](0)));
+    assert(!std::isnan(fcl_result.nearest_points[0](0)));
+
+    if (cdata->req.hasResultField(ContactResultFields::NEAREST_POINTS))
+    {
+      contact.nearest_points[0] = fcl_result.nearest_points[0];
+      contact.nearest_points[1] = fcl_result.nearest_points[1];
+    }
+
+    if (cdata->req.hasResultField(ContactResultFields::NEAREST_POINTS_LOCAL))
+    {
+      contact.nearest_points_local[0] = cd1->getCollisionObjectsTransform().inverse() * fcl_result.nearest_points[0];
+      contact.nearest_points_local[1] = cd2->getCollisionObjectsTransform().inverse() * fcl_result.nearest_points[1];
+    }
+
+    if (cdata->req.hasResultField(ContactResultFields::TRANSFORM))
+    {
+      contact.transform[0] = cd1->getCollisionObjectsTransform();
+      contact.transform[1] = cd2->getCollisionObjectsTransform();
+    }
 
     ObjectPairKey pc = tesseract_common::makeOrderedLinkPair(cd1->getName(), cd2->getName());
     const auto it = cdata->res->find(pc);
@@ -0,0 +1,144 @@
+/**
+ * @file sphere_discrete_manager.h
+ * @brief Tesseract sphere tree discrete contact manager
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_COLLISION_SPHERES_SPHERE_DISCRETE_MANAGER_H
+#define TESSERACT_COLLISION_SPHERES_SPHERE_DISCRETE_MANAGER_H
+
+#include <tesseract_collision/core/discrete_contact_manager.h>
+#include <tesseract_collision/spheres/sphere_utils.h>
+
+namespace tesseract_collision::tesseract_collision_spheres
+{
+/**
+ * @brief A discrete contact manager which approximates every collision object by a sphere tree
+ * @details Shapes are decomposed into spheres using createSphereDecomposition so primitives, meshes, SDF meshes and
+ * octrees are all checked using the same sphere distance kernels while planes are checked analytically. The reported
+ * distances underestimate the distance between the collision geometry by at most the radius of the leaf spheres, which
+ * is controlled by the resolution.
+ */
+class SphereDiscreteManager : public DiscreteContactManager
+{
+public:
+  using Ptr = std::shared_ptr<SphereDiscreteManager>;
+  using ConstPtr = std::shared_ptr<const SphereDiscreteManager>;
+  using UPtr = std::unique_ptr<SphereDiscreteManager>;
+  using ConstUPtr = std::unique_ptr<const SphereDiscreteManager>;
+
+  /**
+   * @brief Constructor
+   * @param name The name of the contact manager
+   * @param resolution The resolution used to decompose the collision geometry into spheres
+   */
+  SphereDiscreteManager(std::string name = "SphereDiscreteManager", double resolution = 0.05);
+  ~SphereDiscreteManager() override = default;
+  SphereDiscreteManager(const SphereDiscreteManager&) = delete;
+  SphereDiscreteManager& operator=(const SphereDiscreteManager&) = delete;
+  SphereDiscreteManager(SphereDiscreteManager&&) = delete;
+  SphereDiscreteManager& operator=(SphereDiscreteManager&&) = delete;
+
+  std::string getName() const override final;
+
+  DiscreteContactManager::UPtr clone() const override final;
+
+  bool addCollisionObject(const std::string& name,
+                          const int& mask_id,
+                          const CollisionShapesConst& shapes,
+                          const tesseract_common::VectorIsometry3d& shape_poses,
+                          bool enabled = true) override final;
+
+  const CollisionShapesConst& getCollisionObjectGeometries(const std::string& name) const override final;
+
+  const tesseract_common::VectorIsometry3d&
+  getCollisionObjectGeometriesTransforms(const std::string& name) const override final;
+
+  bool hasCollisionObject(const std::string& name) const override final;
+
+  bool removeCollisionObject(const std::string& name) override final;
+
+  bool enableCollisionObject(const std::string& name) override final;
+
+  bool disableCollisionObject(const std::string& name) override final;
+
+  bool isCollisionObjectEnabled(const std::string& name) const override final;
+
+  void setCollisionObjectsTransform(const std::string& name, const Eigen::Isometry3d& pose) override final;
+
+  void setCollisionObjectsTransform(const std::vector<std::string>& names,
+                                    const tesseract_common::VectorIsometry3d& poses) override final;
+
+  void setCollisionObjectsTransform(const tesseract_common::TransformMap& transforms) override final;
+
+  const std::vector<std::string>& getCollisionObjects() const override final;
+
+  void setActiveCollisionObjects(const std::vector<std::string>& names) override final;
+
+  const std::vector<std::string>& getActiveCollisionObjects() const override final;
+
+  void setCollisionMarginData(
+      CollisionMarginData collision_margin_data,
+      CollisionMarginOverrideType override_type = CollisionMarginOverrideType::REPLACE) override final;
+
+  void setDefaultCollisionMarginData(double default_collision_margin) override final;
+
+  void setPairCollisionMarginData(const std::string& name1,
+                                  const std::string& name2,
+                                  double collision_margin) override final;
+
+  const CollisionMarginData& getCollisionMarginData() const override final;
+
+  void setIsContactAllowedFn(IsContactAllowedFn fn) override final;
+
+  IsContactAllowedFn getIsContactAllowedFn() const override final;
+
+  void contactTest(ContactResultMap& collisions, const ContactRequest& request) override final;
+
+  /**
+   * @brief Get the resolution used to decompose the collision geometry into spheres
+   * @return The resolution
+   */
+  double getResolution() const;
+
+  /**
+   * @brief Add a sphere collision object to the manager
+   * @param sco The sphere collision object
+   */
+  void addCollisionObject(const SphereCollisionObject::Ptr& sco);
+
+private:
+  std::string name_;
+  double resolution_;
+
+  Link2SCO link2sco_;               /**< @brief A map of all (static and active) collision objects being managed */
+  std::vector<std::string> active_; /**< @brief A list of the active collision objects */
+  std::vector<std::string> collision_objects_; /**< @brief A list of the collision objects */
+  CollisionMarginData collision_margin_data_;  /**< @brief The contact distance threshold */
+  IsContactAllowedFn fn_;                      /**< @brief The is allowed collision function */
+
+  /** @brief The collision objects in the same order as collision_objects_ */
+  std::vector<SphereCollisionObject::Ptr> objects_;
+};
+
+}  // namespace tesseract_collision::tesseract_collision_spheres
+#endif  // TESSERACT_COLLISION_SPHERES_SPHERE_DISCRETE_MANAGER_H
@@ -0,0 +1,173 @@
+/**
+ * @file sphere_utils.h
+ * @brief Tesseract sphere tree collision object and distance kernels
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_COLLISION_SPHERES_SPHERE_UTILS_H
+#define TESSERACT_COLLISION_SPHERES_SPHERE_UTILS_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <map>
+#include <memory>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/core/types.h>
+
+namespace tesseract_collision::tesseract_collision_spheres
+{
+/** @brief Spheres stored as a structure of arrays so the distance kernels can be vectorized by the compiler */
+struct SphereArray
+{
+  std::vector<double> x;
+  std::vector<double> y;
+  std::vector<double> z;
+  std::vector<double> r;
+
+  std::size_t size() const { return r.size(); }
+  void resize(std::size_t n);
+  void reserve(std::size_t n);
+  void push_back(const Eigen::Vector4d& sphere);
+
+  /**
+   * @brief Assign the sphere centers of this array to the centers of another array transformed by a pose
+   * @param pose The transform to apply
+   * @param local The array to transform
+   */
+  void transform(const Eigen::Isometry3d& pose, const SphereArray& local);
+};
+
+/**
+ * @brief A collision object approximated by a two level sphere tree
+ * @details Every shape is decomposed into leaf spheres using createSphereDecomposition. The leaf spheres of a shape are
+ * grouped into clusters of neighboring spheres each having a bounding sphere, so most leaf sphere pairs can be rejected
+ * by checking the cluster bounding spheres. Planes can not be approximated by spheres so they are checked
+ * analytically.
+ */
+class SphereCollisionObject
+{
+public:
+  using Ptr = std::shared_ptr<SphereCollisionObject>;
+  using ConstPtr = std::shared_ptr<const SphereCollisionObject>;
+
+  /**
+   * @brief Constructor
+   * @param name The name of the collision object
+   * @param type_id The type id of the collision object
+   * @param shapes The collision shapes
+   * @param shape_poses The poses of the collision shapes
+   * @param resolution The resolution used to decompose the shapes into spheres
+   */
+  SphereCollisionObject(std::string name,
+                        int type_id,
+                        CollisionShapesConst shapes,
+                        tesseract_common::VectorIsometry3d shape_poses,
+                        double resolution);
+
+  /** @brief Leaf spheres in the link frame, ordered by cluster */
+  SphereArray local_spheres;
+  /** @brief Leaf spheres in the world frame */
+  SphereArray world_spheres;
+  /** @brief The shape index of each leaf sphere */
+  std::vector<int> sphere_shape_ids;
+  /** @brief The index of each leaf sphere within the decomposition of its shape */
+  std::vector<int> sphere_subshape_ids;
+
+  /** @brief Cluster bounding spheres in the link frame */
+  SphereArray local_clusters;
+  /** @brief Cluster bounding spheres in the world frame */
+  SphereArray world_clusters;
+  /** @brief The first leaf sphere of each cluster, the last entry is the number of leaf spheres */
+  std::vector<std::size_t> cluster_offsets;
+  /** @brief The shape index of each cluster */
+  std::vector<int> cluster_shape_ids;
+
+  /** @brief The shape index of each plane */
+  std::vector<int> plane_shape_ids;
+  /** @brief The planes (a, b, c, d) in the link frame */
+  tesseract_common::VectorVector4d local_planes;
+  /** @brief The planes (a, b, c, d) in the world frame */
+  tesseract_common::VectorVector4d world_planes;
+
+  /** @brief The world axis aligned bounding box of the leaf spheres */
+  Eigen::AlignedBox3d aabb;
+
+  bool m_enabled{ true };
+  bool m_active{ true };
+
+  const std::string& getName() const { return name_; }
+  int getTypeID() const { return type_id_; }
+  double getResolution() const { return resolution_; }
+  const CollisionShapesConst& getCollisionGeometries() const { return shapes_; }
+  const tesseract_common::VectorIsometry3d& getCollisionGeometriesTransforms() const { return shape_poses_; }
+
+  /**
+   * @brief Set the world transform of the collision object and update the world spheres
+   * @param pose The world transform
+   */
+  void setCollisionObjectsTransform(const Eigen::Isometry3d& pose);
+  const Eigen::Isometry3d& getCollisionObjectsTransform() const { return world_pose_; }
+
+  /**
+   * @brief Clone the collision object
+   * @details The sphere decomposition is copied because it does not depend on the transform
+   * @return A copy of the collision object
+   */
+  Ptr clone() const;
+
+protected:
+  std::string name_;
+  int type_id_{ -1 };
+  double resolution_{ 0 };
+  CollisionShapesConst shapes_;
+  tesseract_common::VectorIsometry3d shape_poses_;
+  Eigen::Isometry3d world_pose_{ Eigen::Isometry3d::Identity() };
+};
+
+using Link2SCO = std::map<std::string, SphereCollisionObject::Ptr>;
+
+/**
+ * @brief Check if two collision objects need to be checked
+ * @param cdata The contact test data
+ * @param sco1 The first collision object
+ * @param sco2 The second collision object
+ * @return True if the objects are enabled, at least one is active and contact is not allowed
+ */
+bool needsCollisionCheck(const ContactTestData& cdata,
+                         const SphereCollisionObject& sco1,
+                         const SphereCollisionObject& sco2);
+
+/**
+ * @brief Compute the contacts between two collision objects and process them using the contact test data
+ * @details A single contact, the closest leaf sphere pair, is reported for every pair of shapes within the collision
+ * margin.
+ * @param cdata The contact test data
+ * @param sco1 The first collision object
+ * @param sco2 The second collision object
+ * @return True if the contact test is done
+ */
+bool distanceCheck(ContactTestData& cdata, const SphereCollisionObject& sco1, const SphereCollisionObject& sco2);
+
+}  // namespace tesseract_collision::tesseract_collision_spheres
+#endif  // TESSERACT_COLLISION_SPHERES_SPHERE_UTILS_H
@@ -0,0 +1,227 @@
+/**
+ * @file sphere_discrete_manager.cpp
+ * @brief Tesseract sphere tree discrete contact manager
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/spheres/sphere_discrete_manager.h>
+#include <tesseract_common/metrics.h>
+#include <tesseract_collision/core/common.h>
+
+namespace tesseract_collision::tesseract_collision_spheres
+{
+static const CollisionShapesConst EMPTY_COLLISION_SHAPES_CONST;
+static const tesseract_common::VectorIsometry3d EMPTY_COLLISION_SHAPES_TRANSFORMS;
+
+SphereDiscreteManager::SphereDiscreteManager(std::string name, double resolution)
+  : name_(std::move(name)), resolution_(resolution)
+{
+  collision_margin_data_ = CollisionMarginData(0);
+}
+
+std::string SphereDiscreteManager::getName() const { return name_; }
+
+DiscreteContactManager::UPtr SphereDiscreteManager::clone() const
+{
+  auto manager = std::make_unique<SphereDiscreteManager>(name_, resolution_);
+
+  for (const auto& sco : objects_)
+    manager->addCollisionObject(sco->clone());
+
+  manager->setActiveCollisionObjects(active_);
+  manager->setCollisionMarginData(collision_margin_data_);
+  manager->setIsContactAllowedFn(fn_);
+
+  return manager;
+}
+
+bool SphereDiscreteManager::addCollisionObject(const std::string& name,
+                                               const int& mask_id,
+                                               const CollisionShapesConst& shapes,
+                                               const tesseract_common::VectorIsometry3d& shape_poses,
+                                               bool enabled)
+{
+  if (link2sco_.find(name) != link2sco_.end())
+    removeCollisionObject(name);
+
+  if (shapes.empty() || shapes.size() != shape_poses.size())
+    return false;
+
+  auto new_sco = std::make_shared<SphereCollisionObject>(name, mask_id, shapes, shape_poses, resolution_);
+  new_sco->m_enabled = enabled;
+  addCollisionObject(new_sco);
+  return true;
+}
+
+const CollisionShapesConst& SphereDiscreteManager::getCollisionObjectGeometries(const std::string& name) const
+{
+  auto sco = link2sco_.find(name);
+  return (sco != link2sco_.end()) ? sco->second->getCollisionGeometries() : EMPTY_COLLISION_SHAPES_CONST;
+}
+
+const tesseract_common::VectorIsometry3d&
+SphereDiscreteManager::getCollisionObjectGeometriesTransforms(const std::string& name) const
+{
+  auto sco = link2sco_.find(name);
+  return (sco != link2sco_.end()) ? sco->second->getCollisionGeometriesTransforms() :
+                                    EMPTY_COLLISION_SHAPES_TRANSFORMS;
+}
+
+bool SphereDiscreteManager::hasCollisionObject(const std::string& name) const
+{
+  return (link2sco_.find(name) != link2sco_.end());
+}
+
+bool SphereDiscreteManager::removeCollisionObject(const std::string& name)
+{
+  auto it = link2sco_.find(name);
+  if (it != link2sco_.end())
+  {
+    objects_.erase(std::find(objects_.begin(), objects_.end(), it->second));
+    collision_objects_.erase(std::find(collision_objects_.begin(), collision_objects_.end(), name));
+    link2sco_.erase(it);
+    return true;
+  }
+  return false;
+}
+
+bool SphereDiscreteManager::enableCollisionObject(const std::string& name)
+{
+  auto it = link2sco_.find(name);
+  if (it != link2sco_.end())
+  {
+    it->second->m_enabled = true;
+    return true;
+  }
+  return false;
+}
+
+bool SphereDiscreteManager::disableCollisionObject(const std::string& name)
+{
+  auto it = link2sco_.find(name);
+  if (it != link2sco_.end())
+  {
+    it->second->m_enabled = false;
+    return true;
+  }
+  return false;
+}
+
+bool SphereDiscreteManager::isCollisionObjectEnabled(const std::string& name) const
+{
+  auto it = link2sco_.find(name);
+  if (it != link2sco_.end())
+    return it->second->m_enabled;
+
+  return false;
+}
+
+void SphereDiscreteManager::setCollisionObjectsTransform(const std::string& name, const Eigen::Isometry3d& pose)
+{
+  auto it = link2sco_.find(name);
+  if (it != link2sco_.end())
+    it->second->setCollisionObjectsTransform(pose);
+}
+
+void SphereDiscreteManager::setCollisionObjectsTransform(const std::vector<std::string>& names,
+                                                         const tesseract_common::VectorIsometry3d& poses)
+{
+  assert(names.size() == poses.size());
+  for (auto i = 0U; i < names.size(); ++i)
+    setCollisionObjectsTransform(names[i], poses[i]);
+}
+
+void SphereDiscreteManager::setCollisionObjectsTransform(const tesseract_common::TransformMap& transforms)
+{
+  for (const auto& transform : transforms)
+    setCollisionObjectsTransform(transform.first, transform.second);
+}
+
+const std::vector<std::string>& SphereDiscreteManager::getCollisionObjects() const { return collision_objects_; }
+
+void SphereDiscreteManager::setActiveCollisionObjects(const std::vector<std::string>& names)
+{
+  active_ = names;
+
+  for (auto& sco : objects_)
+    sco->m_active = isLinkActive(active_, sco->getName());
+}
+
+const std::vector<std::string>& SphereDiscreteManager::getActiveCollisionObjects() const { return active_; }
+
+void SphereDiscreteManager::setCollisionMarginData(CollisionMarginData collision_margin_data,
+                                                   CollisionMarginOverrideType override_type)
+{
+  collision_margin_data_.apply(collision_margin_data, override_type);
+}
+
+void SphereDiscreteManager::setDefaultCollisionMarginData(double default_collision_margin)
+{
+  collision_margin_data_.setDefaultCollisionMargin(default_collision_margin);
+}
+
+void SphereDiscreteManager::setPairCollisionMarginData(const std::string& name1,
+                                                       const std::string& name2,
+                                                       double collision_margin)
+{
+  collision_margin_data_.setPairCollisionMargin(name1, name2, collision_margin);
+}
+
+const CollisionMarginData& SphereDiscreteManager::getCollisionMarginData() const { return collision_margin_data_; }
+void SphereDiscreteManager::setIsContactAllowedFn(IsContactAllowedFn fn) { fn_ = fn; }
+IsContactAllowedFn SphereDiscreteManager::getIsContactAllowedFn() const { return fn_; }
+
+void SphereDiscreteManager::contactTest(ContactResultMap& collisions, const ContactRequest& request)
+{
+  TESSERACT_COMMON_METRICS_SCOPE("SphereDiscreteManager::contactTest");
+  ContactTestData cdata(active_, collision_margin_data_, fn_, request, collisions);
+
+  // The world spheres are updated when the transforms are set so every pair is only checked once
+  for (std::size_t i = 0; i < objects_.size(); ++i)
+  {
+    for (std::size_t j = i + 1; j < objects_.size(); ++j)
+    {
+      if (!needsCollisionCheck(cdata, *objects_[i], *objects_[j]))
+        continue;
+
+      if (distanceCheck(cdata, *objects_[i], *objects_[j]))
+        return;
+    }
+  }
+}
+
+double SphereDiscreteManager::getResolution() const { return resolution_; }
+
+void SphereDiscreteManager::addCollisionObject(const SphereCollisionObject::Ptr& sco)
+{
+  sco->m_active = isLinkActive(active_, sco->getName());
+  link2sco_[sco->getName()] = sco;
+  collision_objects_.push_back(sco->getName());
+  objects_.push_back(sco);
+}
+}  // namespace tesseract_collision::tesseract_collision_spheres
@@ -0,0 +1,67 @@
+/**
+ * @file sphere_factories.cpp
+ * @brief Factories for loading sphere contact managers as plugins
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <console_bridge/console.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/spheres/sphere_factories.h>
+#include <tesseract_collision/spheres/sphere_discrete_manager.h>
+
+namespace tesseract_collision::tesseract_collision_spheres
+{
+DiscreteContactManager::UPtr SphereDiscreteManagerFactory::create(const std::string& name,
+                                                                  const YAML::Node& config) const
+{
+  double resolution{ 0.05 };
+  try
+  {
+    if (YAML::Node n = config["resolution"])
+      resolution = n.as<double>();
+  }
+  catch (const std::exception& e)
+  {
+    CONSOLE_BRIDGE_logError("SphereDiscreteManagerFactory: Failed to parse yaml config data! Details: %s", e.what());
+    return nullptr;
+  }
+
+  if (resolution <= 0)
+  {
+    CONSOLE_BRIDGE_logError("SphereDiscreteManagerFactory: The resolution must be greater than zero!");
+    return nullptr;
+  }
+
+  return std::make_unique<SphereDiscreteManager>(name, resolution);
+}
+
+TESSERACT_PLUGIN_ANCHOR_IMPL(SphereFactoriesAnchor)  // LCOV_EXCL_LINE
+
+}  // namespace tesseract_collision::tesseract_collision_spheres
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+TESSERACT_ADD_DISCRETE_MANAGER_PLUGIN(tesseract_collision::tesseract_collision_spheres::SphereDiscreteManagerFactory,
+                                      SphereDiscreteManagerFactory);
@@ -0,0 +1,505 @@
+/**
+ * @file sphere_utils.cpp
+ * @brief Tesseract sphere tree collision object and distance kernels
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <numeric>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/spheres/sphere_utils.h>
+#include <tesseract_collision/core/common.h>
+#include <tesseract_collision/core/sphere_decomposition.h>
+#include <tesseract_geometry/impl/plane.h>
+
+namespace tesseract_collision::tesseract_collision_spheres
+{
+/** @brief The edge length of the cells used to cluster leaf spheres relative to the decomposition resolution */
+static const double CLUSTER_CELL_SCALE = 4.0;
+
+/** @brief Get the index of the cell containing a coordinate, non finite coordinates are assigned to the first cell */
+static long getCell(double value, double cell_size)
+{
+  return std::isfinite(value) ? static_cast<long>(std::floor(value / cell_size)) : 0;
+}
+
+void SphereArray::resize(std::size_t n)
+{
+  x.resize(n);
+  y.resize(n);
+  z.resize(n);
+  r.resize(n);
+}
+
+void SphereArray::reserve(std::size_t n)
+{
+  x.reserve(n);
+  y.reserve(n);
+  z.reserve(n);
+  r.reserve(n);
+}
+
+void SphereArray::push_back(const Eigen::Vector4d& sphere)
+{
+  x.push_back(sphere[0]);
+  y.push_back(sphere[1]);
+  z.push_back(sphere[2]);
+  r.push_back(sphere[3]);
+}
+
+void SphereArray::transform(const Eigen::Isometry3d& pose, const SphereArray& local)
+{
+  resize(local.size());
+  const Eigen::Matrix3d& rot = pose.linear();
+  const Eigen::Vector3d& trans = pose.translation();
+  const std::size_t n = local.size();
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    x[i] = rot(0, 0) * local.x[i] + rot(0, 1) * local.y[i] + rot(0, 2) * local.z[i] + trans(0);
+    y[i] = rot(1, 0) * local.x[i] + rot(1, 1) * local.y[i] + rot(1, 2) * local.z[i] + trans(1);
+    z[i] = rot(2, 0) * local.x[i] + rot(2, 1) * local.y[i] + rot(2, 2) * local.z[i] + trans(2);
+  }
+  r = local.r;
+}
+
+SphereCollisionObject::SphereCollisionObject(std::string name,
+                                             int type_id,
+                                             CollisionShapesConst shapes,
+                                             tesseract_common::VectorIsometry3d shape_poses,
+                                             double resolution)
+  : name_(std::move(name))
+  , type_id_(type_id)
+  , resolution_(resolution)
+  , shapes_(std::move(shapes))
+  , shape_poses_(std::move(shape_poses))
+{
+  assert(!shapes_.empty());                       // NOLINT
+  assert(!shape_poses_.empty());                  // NOLINT
+  assert(!name_.empty());                         // NOLINT
+  assert(shapes_.size() == shape_poses_.size());  // NOLINT
+
+  const double cell_size = CLUSTER_CELL_SCALE * resolution_;
+  for (std::size_t i = 0; i < shapes_.size(); ++i)
+  {
+    const auto shape_id = static_cast<int>(i);
+    if (shapes_[i]->getType() == tesseract_geometry::GeometryType::PLANE)
+    {
+      const auto& plane = static_cast<const tesseract_geometry::Plane&>(*shapes_[i]);
+      Eigen::Vector3d n(plane.getA(), plane.getB(), plane.getC());
+      double d = plane.getD() / n.norm();
+      n.normalize();
+
+      // Points on the plane satisfy n.dot(p) + d = 0, stored as (n, offset) where n.dot(p) = offset in the link frame
+      const Eigen::Vector3d normal = shape_poses_[i].linear() * n;
+      const double offset = -d + normal.dot(shape_poses_[i].translation());
+      plane_shape_ids.push_back(shape_id);
+      local_planes.emplace_back(normal.x(), normal.y(), normal.z(), offset);
+      continue;
+    }
+
+    tesseract_common::VectorVector4d spheres = createSphereDecomposition(*shapes_[i], resolution_);
+    if (spheres.empty())
+      continue;
+
+    for (auto& sphere : spheres)
+      sphere.head<3>() = shape_poses_[i] * Eigen::Vector3d(sphere.head<3>());
+
+    // Group the spheres of the shape into clusters by the coarse cell containing their center
+    std::vector<std::array<long, 3>> cells;
+    cells.reserve(spheres.size());
+    for (const auto& sphere : spheres)
+      cells.push_back({ getCell(sphere[0], cell_size), getCell(sphere[1], cell_size), getCell(sphere[2], cell_size) });
+
+    std::vector<std::size_t> order(spheres.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(
+        order.begin(), order.end(), [&cells](std::size_t a, std::size_t b) { return cells[a] < cells[b]; });
+
+    for (std::size_t j = 0; j < order.size(); ++j)
+    {
+      if (j == 0 || cells[order[j]] != cells[order[j - 1]])
+      {
+        cluster_offsets.push_back(local_spheres.size());
+        cluster_shape_ids.push_back(shape_id);
+      }
+
+      local_spheres.push_back(spheres[order[j]]);
+      sphere_shape_ids.push_back(shape_id);
+      sphere_subshape_ids.push_back(static_cast<int>(order[j]));
+    }
+  }
+  cluster_offsets.push_back(local_spheres.size());
+
+  // The bounding sphere of a cluster is centered on the bounding box of its spheres
+  local_clusters.reserve(cluster_shape_ids.size());
+  for (std::size_t c = 0; c < cluster_shape_ids.size(); ++c)
+  {
+    Eigen::AlignedBox3d box;
+    for (std::size_t i = cluster_offsets[c]; i < cluster_offsets[c + 1]; ++i)
+      box.extend(Eigen::Vector3d(local_spheres.x[i], local_spheres.y[i], local_spheres.z[i]));
+
+    const Eigen::Vector3d center = box.center();
+    double radius = 0;
+    for (std::size_t i = cluster_offsets[c]; i < cluster_offsets[c + 1]; ++i)
+    {
+      const Eigen::Vector3d p(local_spheres.x[i], local_spheres.y[i], local_spheres.z[i]);
+      radius = std::max(radius, (p - center).norm() + local_spheres.r[i]);
+    }
+    local_clusters.push_back(Eigen::Vector4d(center.x(), center.y(), center.z(), radius));
+  }
+
+  setCollisionObjectsTransform(world_pose_);
+}
+
+void SphereCollisionObject::setCollisionObjectsTransform(const Eigen::Isometry3d& pose)
+{
+  world_pose_ = pose;
+  world_spheres.transform(pose, local_spheres);
+  world_clusters.transform(pose, local_clusters);
+
+  world_planes.resize(local_planes.size());
+  for (std::size_t i = 0; i < local_planes.size(); ++i)
+  {
+    const Eigen::Vector3d normal = pose.linear() * local_planes[i].head<3>();
+    world_planes[i] << normal, local_planes[i][3] + normal.dot(pose.translation());
+  }
+
+  aabb.setEmpty();
+  for (std::size_t i = 0; i < world_clusters.size(); ++i)
+  {
+    const Eigen::Vector3d center(world_clusters.x[i], world_clusters.y[i], world_clusters.z[i]);
+    aabb.extend(center - Eigen::Vector3d::Constant(world_clusters.r[i]));
+    aabb.extend(center + Eigen::Vector3d::Constant(world_clusters.r[i]));
+  }
+}
+
+SphereCollisionObject::Ptr SphereCollisionObject::clone() const
+{
+  return std::make_shared<SphereCollisionObject>(*this);
+}
+
+bool needsCollisionCheck(const ContactTestData& cdata,
+                         const SphereCollisionObject& sco1,
+                         const SphereCollisionObject& sco2)
+{
+  return sco1.m_enabled && sco2.m_enabled && (sco1.m_active || sco2.m_active) &&
+         !isContactAllowed(sco1.getName(), sco2.getName(), cdata.fn, false);
+}
+
+namespace
+{
+/** @brief The closest pair of primitives found between two shapes */
+struct ShapeContact
+{
+  enum class Type
+  {
+    SPHERE_SPHERE,
+    PLANE_SPHERE,
+    SPHERE_PLANE
+  };
+
+  bool found{ false };
+  double distance{ 0 };
+  Type type{ Type::SPHERE_SPHERE };
+  std::size_t index1{ 0 };
+  std::size_t index2{ 0 };
+};
+
+/**
+ * @brief Compute the squared distance between the centers of a sphere and an array of spheres
+ * @details This loop has no branches so it is vectorized by the compiler
+ */
+void squaredCenterDistances(std::vector<double>& out,
+                            double x,
+                            double y,
+                            double z,
+                            const SphereArray& spheres,
+                            std::size_t begin,
+                            std::size_t end)
+{
+  const std::size_t n = end - begin;
+  const double* sx = spheres.x.data() + begin;
+  const double* sy = spheres.y.data() + begin;
+  const double* sz = spheres.z.data() + begin;
+  double* o = out.data();
+  for (std::size_t k = 0; k < n; ++k)
+  {
+    const double dx = sx[k] - x;
+    const double dy = sy[k] - y;
+    const double dz = sz[k] - z;
+    o[k] = dx * dx + dy * dy + dz * dz;
+  }
+}
+
+/**
+ * @brief Compute the signed distance between a plane and an array of spheres
+ * @details This loop has no branches so it is vectorized by the compiler
+ */
+void planeDistances(std::vector<double>& out,
+                    const Eigen::Vector4d& plane,
+                    const SphereArray& spheres,
+                    std::size_t begin,
+                    std::size_t end)
+{
+  const std::size_t n = end - begin;
+  const double* sx = spheres.x.data() + begin;
+  const double* sy = spheres.y.data() + begin;
+  const double* sz = spheres.z.data() + begin;
+  const double* sr = spheres.r.data() + begin;
+  double* o = out.data();
+  for (std::size_t k = 0; k < n; ++k)
+    o[k] = plane[0] * sx[k] + plane[1] * sy[k] + plane[2] * sz[k] - plane[3] - sr[k];
+}
+
+double aabbDistance(const Eigen::AlignedBox3d& a, const Eigen::AlignedBox3d& b)
+{
+  const Eigen::Vector3d gap = (a.min() - b.max()).cwiseMax(b.min() - a.max()).cwiseMax(0.0);
+  return gap.norm();
+}
+
+Eigen::Vector3d getSphereCenter(const SphereArray& spheres, std::size_t i)
+{
+  return { spheres.x[i], spheres.y[i], spheres.z[i] };
+}
+
+/** @brief Find the closest leaf spheres between the clusters of two objects */
+void checkSpheres(std::vector<ShapeContact>& contacts,
+                  const SphereCollisionObject& sco1,
+                  const SphereCollisionObject& sco2,
+                  std::size_t num_shapes2)
+{
+  const SphereArray& spheres1 = sco1.world_spheres;
+  const SphereArray& spheres2 = sco2.world_spheres;
+  const SphereArray& clusters1 = sco1.world_clusters;
+  const SphereArray& clusters2 = sco2.world_clusters;
+
+  std::size_t max_cluster_size = 0;
+  for (std::size_t c = 0; c < clusters2.size(); ++c)
+    max_cluster_size = std::max(max_cluster_size, sco2.cluster_offsets[c + 1] - sco2.cluster_offsets[c]);
+
+  std::vector<double> dist_sq(max_cluster_size);
+  for (std::size_t c1 = 0; c1 < clusters1.size(); ++c1)
+  {
+    const auto shape1 = static_cast<std::size_t>(sco1.cluster_shape_ids[c1]);
+    for (std::size_t c2 = 0; c2 < clusters2.size(); ++c2)
+    {
+      const auto shape2 = static_cast<std::size_t>(sco2.cluster_shape_ids[c2]);
+      ShapeContact& contact = contacts[(shape1 * num_shapes2) + shape2];
+
+      // The distance between the cluster bounding spheres is a lower bound of the distance between their spheres
+      const double lower_bound = (getSphereCenter(clusters1, c1) - getSphereCenter(clusters2, c2)).norm() -
+                                 clusters1.r[c1] - clusters2.r[c2];
+      if (lower_bound > contact.distance)
+        continue;
+
+      const std::size_t begin2 = sco2.cluster_offsets[c2];
+      const std::size_t end2 = sco2.cluster_offsets[c2 + 1];
+      for (std::size_t i = sco1.cluster_offsets[c1]; i < sco1.cluster_offsets[c1 + 1]; ++i)
+      {
+        squaredCenterDistances(dist_sq, spheres1.x[i], spheres1.y[i], spheres1.z[i], spheres2, begin2, end2);
+
+        // Only compute the square root for sphere pairs which may be closer than the current contact
+        for (std::size_t k = 0; k < end2 - begin2; ++k)
+        {
+          const double radii = spheres1.r[i] + spheres2.r[begin2 + k];
+          const double limit = contact.distance + radii;
+          if (limit < 0 || dist_sq[k] > limit * limit)
+            continue;
+
+          const double distance = std::sqrt(dist_sq[k]) - radii;
+          if (distance <= contact.distance)
+          {
+            contact.found = true;
+            contact.distance = distance;
+            contact.type = ShapeContact::Type::SPHERE_SPHERE;
+            contact.index1 = i;
+            contact.index2 = begin2 + k;
+          }
+        }
+      }
+    }
+  }
+}
+
+/** @brief Find the closest leaf sphere of an object to each plane of another object */
+void checkPlanes(std::vector<ShapeContact>& contacts,
+                 const SphereCollisionObject& plane_sco,
+                 const SphereCollisionObject& sphere_sco,
+                 bool planes_first,
+                 std::size_t num_shapes2)
+{
+  const SphereArray& spheres = sphere_sco.world_spheres;
+  const SphereArray& clusters = sphere_sco.world_clusters;
+
+  std::vector<double> distances(spheres.size());
+  for (std::size_t p = 0; p < plane_sco.world_planes.size(); ++p)
+  {
+    const Eigen::Vector4d& plane = plane_sco.world_planes[p];
+    const auto plane_shape = static_cast<std::size_t>(plane_sco.plane_shape_ids[p]);
+    for (std::size_t c = 0; c < clusters.size(); ++c)
+    {
+      const auto sphere_shape = static_cast<std::size_t>(sphere_sco.cluster_shape_ids[c]);
+      ShapeContact& contact = planes_first ? contacts[(plane_shape * num_shapes2) + sphere_shape] :
+                                             contacts[(sphere_shape * num_shapes2) + plane_shape];
+
+      const double lower_bound = plane.head<3>().dot(getSphereCenter(clusters, c)) - plane[3] - clusters.r[c];
+      if (lower_bound > contact.distance)
+        continue;
+
+      const std::size_t begin = sphere_sco.cluster_offsets[c];
+      const std::size_t end = sphere_sco.cluster_offsets[c + 1];
+      planeDistances(distances, plane, spheres, begin, end);
+      auto it = std::min_element(distances.begin(), distances.begin() + static_cast<long>(end - begin));
+      if (*it <= contact.distance)
+      {
+        contact.found = true;
+        contact.distance = *it;
+        contact.type = planes_first ? ShapeContact::Type::PLANE_SPHERE : ShapeContact::Type::SPHERE_PLANE;
+        contact.index1 = planes_first ? p : begin + static_cast<std::size_t>(it - distances.begin());
+        contact.index2 = planes_first ? begin + static_cast<std::size_t>(it - distances.begin()) : p;
+      }
+    }
+  }
+}
+
+/** @brief Compute the nearest points and normal of a contact between a sphere and a plane */
+void setPlaneContact(ContactResult& result,
+                     const Eigen::Vector4d& plane,
+                     const SphereArray& spheres,
+                     std::size_t sphere_index,
+                     std::size_t plane_result_index)
+{
+  const Eigen::Vector3d n = plane.head<3>();
+  const Eigen::Vector3d center = getSphereCenter(spheres, sphere_index);
+  const std::size_t sphere_result_index = 1 - plane_result_index;
+  result.nearest_points[sphere_result_index] = center - (spheres.r[sphere_index] * n);
+  result.nearest_points[plane_result_index] = center - ((n.dot(center) - plane[3]) * n);
+  result.normal = (plane_result_index == 0) ? n : Eigen::Vector3d(-n);
+}
+}  // namespace
+
+bool distanceCheck(ContactTestData& cdata, const SphereCollisionObject& sco1, const SphereCollisionObject& sco2)
+{
+  const double margin = cdata.collision_margin_data.getPairCollisionMargin(sco1.getName(), sco2.getName());
+  const bool has_planes = !sco1.world_planes.empty() || !sco2.world_planes.empty();
+  const bool has_spheres = !sco1.aabb.isEmpty() && !sco2.aabb.isEmpty();
+  if (!has_planes && (!has_spheres || aabbDistance(sco1.aabb, sco2.aabb) > margin))
+    return false;
+
+  const std::size_t num_shapes2 = sco2.getCollisionGeometries().size();
+  ShapeContact init;
+  init.distance = margin;
+  std::vector<ShapeContact> contacts(sco1.getCollisionGeometries().size() * num_shapes2, init);
+
+  if (has_spheres)
+    checkSpheres(contacts, sco1, sco2, num_shapes2);
+
+  if (!sco1.world_planes.empty())
+    checkPlanes(contacts, sco1, sco2, true, num_shapes2);
+
+  if (!sco2.world_planes.empty())
+    checkPlanes(contacts, sco2, sco1, false, num_shapes2);
+
+  const ObjectPairKey key = tesseract_common::makeOrderedLinkPair(sco1.getName(), sco2.getName());
+  for (const auto& contact : contacts)
+  {
+    if (!contact.found)
+      continue;
+
+    ContactResult result;
+    result.link_names[0] = sco1.getName();
+    result.link_names[1] = sco2.getName();
+    result.type_id[0] = sco1.getTypeID();
+    result.type_id[1] = sco2.getTypeID();
+    result.distance = contact.distance;
+
+    switch (contact.type)
+    {
+      case ShapeContact::Type::SPHERE_SPHERE:
+      {
+        const Eigen::Vector3d c1 = getSphereCenter(sco1.world_spheres, contact.index1);
+        const Eigen::Vector3d c2 = getSphereCenter(sco2.world_spheres, contact.index2);
+        Eigen::Vector3d dir = c2 - c1;
+        const double length = dir.norm();
+        dir = (length > 0) ? Eigen::Vector3d(dir / length) : Eigen::Vector3d::UnitX();
+        result.shape_id[0] = sco1.sphere_shape_ids[contact.index1];
+        result.shape_id[1] = sco2.sphere_shape_ids[contact.index2];
+        result.subshape_id[0] = sco1.sphere_subshape_ids[contact.index1];
+        result.subshape_id[1] = sco2.sphere_subshape_ids[contact.index2];
+        result.nearest_points[0] = c1 + (sco1.world_spheres.r[contact.index1] * dir);
+        result.nearest_points[1] = c2 - (sco2.world_spheres.r[contact.index2] * dir);
+        result.normal = dir;
+        break;
+      }
+      case ShapeContact::Type::PLANE_SPHERE:
+      {
+        result.shape_id[0] = sco1.plane_shape_ids[contact.index1];
+        result.shape_id[1] = sco2.sphere_shape_ids[contact.index2];
+        result.subshape_id[1] = sco2.sphere_subshape_ids[contact.index2];
+        setPlaneContact(result, sco1.world_planes[contact.index1], sco2.world_spheres, contact.index2, 0);
+        break;
+      }
+      case ShapeContact::Type::SPHERE_PLANE:
+      {
+        result.shape_id[0] = sco1.sphere_shape_ids[contact.index1];
+        result.shape_id[1] = sco2.plane_shape_ids[contact.index2];
+        result.subshape_id[0] = sco1.sphere_subshape_ids[contact.index1];
+        setPlaneContact(result, sco2.world_planes[contact.index2], sco1.world_spheres, contact.index1, 1);
+        break;
+      }
+    }
+
+    if (cdata.req.hasResultField(ContactResultFields::NEAREST_POINTS_LOCAL))
+    {
+      result.nearest_points_local[0] = sco1.getCollisionObjectsTransform().inverse() * result.nearest_points[0];
+      result.nearest_points_local[1] = sco2.getCollisionObjectsTransform().inverse() * result.nearest_points[1];
+    }
+
+    if (!cdata.req.hasResultField(ContactResultFields::NEAREST_POINTS))
+    {
+      result.nearest_points[0].setZero();
+      result.nearest_points[1].setZero();
+    }
+
+    if (cdata.req.hasResultField(ContactResultFields::TRANSFORM))
+    {
+      result.transform[0] = sco1.getCollisionObjectsTransform();
+      result.transform[1] = sco2.getCollisionObjectsTransform();
+    }
+
+    const auto it = cdata.res->find(key);
+    bool found = (it != cdata.res->end() && !it->second.empty());
+    processResult(cdata, result, key, found);
+    if (cdata.done)
+      return true;
+  }
+
+  return cdata.done;
+}
+
+}  // namespace tesseract_collision::tesseract_collision_spheres
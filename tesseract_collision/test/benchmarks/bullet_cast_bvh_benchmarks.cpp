@@ -0,0 +1,148 @@
+#include <benchmark/benchmark.h>
+#include <Eigen/Eigen>
+
+#include <tesseract_collision/test_suite/benchmarks/continuous_benchmarks.hpp>
+#include <tesseract_collision/test_suite/benchmarks/benchmark_utils.hpp>
+#include <tesseract_collision/bullet/bullet_cast_bvh_manager.h>
+
+using namespace tesseract_collision;
+using namespace test_suite;
+using namespace tesseract_geometry;
+
+int main(int argc, char** argv)
+{
+  const tesseract_collision_bullet::BulletCastBVHManager::ConstPtr checker =
+      std::make_shared<tesseract_collision_bullet::BulletCastBVHManager>();
+
+  Eigen::Isometry3d start_pose = Eigen::Isometry3d::Identity();
+  start_pose.translation() = Eigen::Vector3d(-2, 0, 0);
+  Eigen::Isometry3d end_pose = Eigen::Isometry3d::Identity();
+  end_pose.translation() = Eigen::Vector3d(2, 0, 0);
+
+  //////////////////////////////////////
+  // Clone
+  //////////////////////////////////////
+  {
+    std::vector<int> num_links = { 0, 2, 4, 8, 16, 32, 64, 128, 256, 512 };
+    std::function<void(benchmark::State&, ContinuousBenchmarkInfo, int)> BM_CAST_CLONE_FUNC = BM_CAST_CLONE;
+    for (const auto& num_link : num_links)
+    {
+      std::string name = "BM_CAST_CLONE_" + checker->getName() + "_ACTIVE_OBJ_" + std::to_string(num_link);
+      benchmark::RegisterBenchmark(name.c_str(),
+                                   BM_CAST_CLONE_FUNC,
+                                   ContinuousBenchmarkInfo(checker,
+                                                           CreateUnitPrimative(GeometryType::BOX),
+                                                           start_pose,
+                                                           end_pose,
+                                                           CreateUnitPrimative(GeometryType::BOX),
+                                                           Eigen::Isometry3d::Identity(),
+                                                           ContactTestType::ALL),
+                                   num_link)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kMicrosecond);
+    }
+  }
+
+  //////////////////////////////////////
+  // contactTest
+  //////////////////////////////////////
+  std::function<void(benchmark::State&, ContinuousBenchmarkInfo)> BM_CAST_CONTACT_TEST_FUNC = BM_CAST_CONTACT_TEST;
+
+  // Make vector of all shapes to try
+  std::vector<tesseract_geometry::GeometryType> geometry_types = {
+    GeometryType::BOX, GeometryType::CONE, GeometryType::SPHERE, GeometryType::CAPSULE, GeometryType::CYLINDER
+  };
+
+  std::vector<ContactTestType> test_types = {
+    ContactTestType::ALL, ContactTestType::FIRST, ContactTestType::CLOSEST, ContactTestType::LIMITED
+  };
+
+  // The offset of the static object from the path of the cast object
+  // 0: The cast object sweeps through the static object
+  // 1: Not in collision. Within contact threshold
+  // 2: Not in collision. Outside contact threshold
+  std::vector<double> offsets = { 0, 1.2, 3 };
+
+  for (std::size_t i = 0; i < offsets.size(); ++i)
+  {
+    for (const auto& test_type : test_types)
+    {
+      // Loop over all primitive combinations
+      for (const auto& type1 : geometry_types)
+      {
+        for (const auto& type2 : geometry_types)
+        {
+          Eigen::Isometry3d tf = Eigen::Isometry3d::Identity();
+          tf.translation() = Eigen::Vector3d(0, offsets[i], 0);
+          std::string name = "BM_CAST_CONTACT_TEST_" + std::to_string(i) + "_" + checker->getName() + "_" +
+                             ContactTestTypeStrings[static_cast<std::size_t>(test_type)] + "_" +
+                             GeometryTypeStrings[type1] + "_" + GeometryTypeStrings[type2];
+          benchmark::RegisterBenchmark(name.c_str(),
+                                       BM_CAST_CONTACT_TEST_FUNC,
+                                       ContinuousBenchmarkInfo(checker,
+                                                               CreateUnitPrimative(type1),
+                                                               start_pose,
+                                                               end_pose,
+                                                               CreateUnitPrimative(type2),
+                                                               tf,
+                                                               test_type))
+              ->UseRealTime()
+              ->Unit(benchmark::TimeUnit::kMicrosecond);
+        }
+      }
+    }
+  }
+
+  //////////////////////////////////////
+  // setCollisionObjectTransform
+  //////////////////////////////////////
+  {
+    std::function<void(benchmark::State&, ContinuousBenchmarkInfo, int)>
+        BM_CAST_SET_COLLISION_OBJECTS_TRANSFORM_SINGLE_FUNC = BM_CAST_SET_COLLISION_OBJECTS_TRANSFORM_SINGLE;
+    std::vector<int> num_links = { 2, 4, 8, 16, 32, 64, 128, 256, 512 };
+
+    for (const auto& num_link : num_links)
+    {
+      std::string name = "BM_CAST_SET_COLLISION_OBJECTS_TRANSFORM_SINGLE_" + checker->getName() + "_ACTIVE_OBJ_" +
+                         std::to_string(num_link);
+      benchmark::RegisterBenchmark(name.c_str(),
+                                   BM_CAST_SET_COLLISION_OBJECTS_TRANSFORM_SINGLE_FUNC,
+                                   ContinuousBenchmarkInfo(checker,
+                                                           CreateUnitPrimative(GeometryType::BOX),
+                                                           start_pose,
+                                                           end_pose,
+                                                           CreateUnitPrimative(GeometryType::BOX),
+                                                           Eigen::Isometry3d::Identity(),
+                                                           ContactTestType::ALL),
+                                   num_link)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kNanosecond);
+    }
+  }
+  {
+    std::function<void(benchmark::State&, ContinuousBenchmarkInfo, int)>
+        BM_CAST_SET_COLLISION_OBJECTS_TRANSFORM_MAP_FUNC = BM_CAST_SET_COLLISION_OBJECTS_TRANSFORM_MAP;
+    std::vector<int> num_links = { 2, 4, 8, 16, 32, 64, 128, 256, 512 };
+
+    for (const auto& num_link : num_links)
+    {
+      std::string name = "BM_CAST_SET_COLLISION_OBJECTS_TRANSFORM_MAP_" + checker->getName() + "_ACTIVE_OBJ_" +
+                         std::to_string(num_link);
+      benchmark::RegisterBenchmark(name.c_str(),
+                                   BM_CAST_SET_COLLISION_OBJECTS_TRANSFORM_MAP_FUNC,
+                                   ContinuousBenchmarkInfo(checker,
+                                                           CreateUnitPrimative(GeometryType::BOX),
+                                                           start_pose,
+                                                           end_pose,
+                                                           CreateUnitPrimative(GeometryType::BOX),
+                                                           Eigen::Isometry3d::Identity(),
+                                                           ContactTestType::ALL),
+                                   num_link)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kMicrosecond);
+    }
+  }
+
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+}
@@ -3,6 +3,7 @@
 
 #include <tesseract_collision/test_suite/benchmarks/primatives_benchmarks.hpp>
 #include <tesseract_collision/test_suite/benchmarks/large_dataset_benchmarks.hpp>
+#include <tesseract_collision/test_suite/benchmarks/scene_benchmarks.hpp>
 #include <tesseract_collision/test_suite/benchmarks/benchmark_utils.hpp>
 #include <tesseract_collision/fcl/fcl_discrete_managers.h>
 
@@ -223,6 +224,101 @@ int main(int argc, char** argv)
           ->Unit(benchmark::TimeUnit::kNanosecond);
     }
   }
+  {
+    std::function<void(benchmark::State&, DiscreteBenchmarkInfo, int)> BM_SET_COLLISION_OBJECTS_TRANSFORM_MAP_ALL_FUNC =
+        BM_SET_COLLISION_OBJECTS_TRANSFORM_MAP_ALL;
+    std::vector<std::size_t> num_links = { 2, 4, 8, 16, 32, 64, 128, 256, 512 };
+
+    for (const auto& num_link : num_links)
+    {
+      auto tf = Eigen::Isometry3d::Identity();
+      std::string name = "BM_SET_COLLISION_OBJECTS_TRANSFORM_MAP_ALL_" + checker->getName() + "_ACTIVE_OBJ_" +
+                         std::to_string(num_link);
+      benchmark::RegisterBenchmark(name.c_str(),
+                                   BM_SET_COLLISION_OBJECTS_TRANSFORM_MAP_ALL_FUNC,
+                                   DiscreteBenchmarkInfo(checker,
+                                                         CreateUnitPrimative(GeometryType::BOX),
+                                                         Eigen::Isometry3d::Identity(),
+                                                         CreateUnitPrimative(GeometryType::BOX),
+                                                         tf.translate(Eigen::Vector3d(2, 0, 0)),
+                                                         ContactTestType::ALL),
+                                   num_link)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kMicrosecond);
+    }
+  }
+
+  //////////////////////////////////////
+  // Multi-threaded contactTest on clones
+  //////////////////////////////////////
+  {
+    std::function<void(benchmark::State&, DiscreteContactManager::ConstPtr)> BM_CONTACT_TEST_MULTI_THREADED_FUNC =
+        BM_CONTACT_TEST_MULTI_THREADED;
+    std::vector<int> edge_sizes = { 2, 4, 6 };
+
+    for (const auto& edge_size : edge_sizes)
+    {
+      DiscreteContactManager::Ptr scene = checker->clone();
+      addSphereGrid(*scene, edge_size);
+      std::string name =
+          "BM_CONTACT_TEST_MULTI_THREADED_" + checker->getName() + "_PRIMATIVE_EDGE_SIZE_" + std::to_string(edge_size);
+      benchmark::RegisterBenchmark(name.c_str(), BM_CONTACT_TEST_MULTI_THREADED_FUNC, scene)
+          ->ThreadRange(1, 8)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kMicrosecond);
+    }
+  }
+
+  //////////////////////////////////////
+  // Mesh and Octomap contactTest
+  //////////////////////////////////////
+  if (std::string(BENCHMARK_ARGS) != "CI_ONLY")
+  {
+    std::function<void(
+        benchmark::State&, DiscreteContactManager::ConstPtr, std::string, std::string, double, ContactTestType)>
+        BM_MESH_MESH_FUNC = BM_MESH_MESH;
+
+    // 0: In collision, 1: Not in collision. Within contact threshold, 2: Not in collision. Outside contact threshold
+    std::vector<double> offsets = { 0, 0.3, 1 };
+    std::vector<std::string> resolutions = { "collision", "visual" };
+    for (const auto& resolution : resolutions)
+    {
+      for (std::size_t i = 0; i < offsets.size(); ++i)
+      {
+        std::string name = "BM_MESH_MESH_" + std::to_string(i) + "_" + checker->getName() + "_IIWA7_" + resolution;
+        benchmark::RegisterBenchmark(name.c_str(),
+                                     BM_MESH_MESH_FUNC,
+                                     checker,
+                                     "meshes/iiwa7/" + resolution + "/link_2.stl",
+                                     "meshes/iiwa7/" + resolution + "/link_4.stl",
+                                     offsets[i],
+                                     ContactTestType::ALL)
+            ->UseRealTime()
+            ->Unit(benchmark::TimeUnit::kMicrosecond);
+      }
+    }
+
+    std::function<void(benchmark::State&, DiscreteContactManager::ConstPtr, tesseract_geometry::Octree::SubType, int)>
+        BM_OCTOMAP_ROBOT_FUNC = BM_OCTOMAP_ROBOT;
+    std::vector<int> num_links = { 1, 2, 4, 8 };
+    for (const auto& num_link : num_links)
+    {
+      std::string name = "BM_OCTOMAP_ROBOT_" + checker->getName() + "_BOX_LINKS_" + std::to_string(num_link);
+      benchmark::RegisterBenchmark(
+          name.c_str(), BM_OCTOMAP_ROBOT_FUNC, checker, tesseract_geometry::Octree::SubType::BOX, num_link)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kMicrosecond);
+    }
+    for (const auto& num_link : num_links)
+    {
+      std::string name = "BM_OCTOMAP_ROBOT_" + checker->getName() + "_SPHERE_INSIDE_LINKS_" + std::to_string(num_link);
+      benchmark::RegisterBenchmark(
+          name.c_str(), BM_OCTOMAP_ROBOT_FUNC, checker, tesseract_geometry::Octree::SubType::SPHERE_INSIDE, num_link)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kMicrosecond);
+    }
+  }
+
   //////////////////////////////////////
   // Large Dataset contactTest
   //////////////////////////////////////
@@ -0,0 +1,59 @@
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <gtest/gtest.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/test_suite/collision_compact_mesh_unit.hpp>
+#include <tesseract_collision/bullet/bullet_discrete_simple_manager.h>
+#include <tesseract_collision/bullet/bullet_discrete_bvh_manager.h>
+#include <tesseract_collision/bullet/bullet_utils.h>
+#include <tesseract_collision/fcl/fcl_discrete_managers.h>
+
+using namespace tesseract_collision;
+
+TEST(TesseractCollisionUnit, BulletDiscreteSimpleCollisionCompactMeshUnit)  // NOLINT
+{
+  tesseract_collision_bullet::BulletDiscreteSimpleManager checker;
+  test_suite::runTest(checker);
+}
+
+TEST(TesseractCollisionUnit, BulletDiscreteBVHCollisionCompactMeshUnit)  // NOLINT
+{
+  tesseract_collision_bullet::BulletDiscreteBVHManager checker;
+  test_suite::runTest(checker);
+}
+
+TEST(TesseractCollisionUnit, BulletDiscreteSimpleCollisionCompactMeshBVHUnit)  // NOLINT
+{
+  tesseract_collision_bullet::TesseractCollisionConfigurationInfo config_info;
+  config_info.mesh_bvh_cache = std::make_shared<tesseract_collision_bullet::BulletMeshBVHCache>();
+  tesseract_collision_bullet::BulletDiscreteSimpleManager checker("BulletDiscreteSimpleManager", config_info);
+  test_suite::runTest(checker);
+
+  // The compact meshes share their buffers so a single hierarchy is shared by both objects
+  EXPECT_EQ(config_info.mesh_bvh_cache->size(), 1);
+}
+
+TEST(TesseractCollisionUnit, BulletDiscreteBVHCollisionCompactMeshBVHUnit)  // NOLINT
+{
+  tesseract_collision_bullet::TesseractCollisionConfigurationInfo config_info;
+  config_info.mesh_bvh_cache = std::make_shared<tesseract_collision_bullet::BulletMeshBVHCache>();
+  tesseract_collision_bullet::BulletDiscreteBVHManager checker("BulletDiscreteBVHManager", config_info);
+  test_suite::runTest(checker);
+
+  // The compact meshes share their buffers so a single hierarchy is shared by both objects
+  EXPECT_EQ(config_info.mesh_bvh_cache->size(), 1);
+}
+
+TEST(TesseractCollisionUnit, FCLDiscreteBVHCollisionCompactMeshUnit)  // NOLINT
+{
+  tesseract_collision_fcl::FCLDiscreteBVHManager checker;
+  test_suite::runTest(checker);
+}
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+
+  return RUN_ALL_TESTS();
+}
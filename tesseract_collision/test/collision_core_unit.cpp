@@ -1,11 +1,14 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <gtest/gtest.h>
+#include <atomic>
 #include <vector>
 #include <string>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_collision/core/common.h>
+#include <tesseract_collision/core/convex_decomposition_cache.h>
+#include <tesseract_geometry/impl/mesh.h>
 #include <tesseract_common/utils.h>
 
 TEST(TesseractCoreUnit, getCollisionObjectPairsUnit)  // NOLINT
@@ -704,6 +707,173 @@ TEST(TesseractCoreUnit, CollisionCheckConfigUnit)  // NOLINT
   EXPECT_NEAR(config.longest_valid_segment_length, 0.5, 1e-6);
 }
 
+TEST(TesseractCoreUnit, ContactRequestResultFieldsUnit)  // NOLINT
+{
+  using tesseract_collision::ContactResultFields;
+
+  tesseract_collision::ContactRequest request;
+  EXPECT_TRUE(request.result_fields == ContactResultFields::ALL);
+  EXPECT_TRUE(request.hasResultField(ContactResultFields::NEAREST_POINTS));
+  EXPECT_TRUE(request.hasResultField(ContactResultFields::NEAREST_POINTS_LOCAL));
+  EXPECT_TRUE(request.hasResultField(ContactResultFields::TRANSFORM));
+  EXPECT_TRUE(request.hasResultField(ContactResultFields::CONTINUOUS_DATA));
+
+  request.result_fields = ContactResultFields::NEAREST_POINTS | ContactResultFields::TRANSFORM;
+  EXPECT_TRUE(request.hasResultField(ContactResultFields::NEAREST_POINTS));
+  EXPECT_FALSE(request.hasResultField(ContactResultFields::NEAREST_POINTS_LOCAL));
+  EXPECT_TRUE(request.hasResultField(ContactResultFields::TRANSFORM));
+  EXPECT_FALSE(request.hasResultField(ContactResultFields::CONTINUOUS_DATA));
+  EXPECT_FALSE(request.hasResultField(ContactResultFields::NEAREST_POINTS | ContactResultFields::CONTINUOUS_DATA));
+
+  auto distance_request =
+      tesseract_collision::ContactRequest::makeDistanceOnly(tesseract_collision::ContactTestType::FIRST);
+  EXPECT_EQ(distance_request.type, tesseract_collision::ContactTestType::FIRST);
+  EXPECT_TRUE(distance_request.result_fields == ContactResultFields::NONE);
+  EXPECT_FALSE(distance_request.hasResultField(ContactResultFields::NEAREST_POINTS));
+  EXPECT_FALSE(distance_request.hasResultField(ContactResultFields::NEAREST_POINTS_LOCAL));
+  EXPECT_FALSE(distance_request.hasResultField(ContactResultFields::TRANSFORM));
+  EXPECT_FALSE(distance_request.hasResultField(ContactResultFields::CONTINUOUS_DATA));
+}
+
+/** @brief A convex decomposition returning the convex hull of a tetrahedron and counting the number of calls */
+class TestConvexDecomposition : public tesseract_collision::ConvexDecomposition
+{
+public:
+  TestConvexDecomposition(std::string key) : key_(std::move(key)) {}
+
+  std::vector<tesseract_geometry::ConvexMesh::Ptr> compute(const tesseract_common::VectorVector3d& vertices,
+                                                           const Eigen::VectorXi& faces) const override
+  {
+    ++calls;
+    if (faces.size() == 0)
+      throw std::runtime_error("Mesh has no faces");
+
+    auto ch_vertices = std::make_shared<tesseract_common::VectorVector3d>(vertices);
+    auto ch_faces = std::make_shared<Eigen::VectorXi>(faces);
+    return { std::make_shared<tesseract_geometry::ConvexMesh>(ch_vertices, ch_faces) };
+  }
+
+  std::string getParametersKey() const override { return key_; }
+
+  mutable std::atomic<int> calls{ 0 };
+
+private:
+  std::string key_;
+};
+
+tesseract_geometry::Mesh::Ptr createTetrahedron(double size)
+{
+  auto vertices = std::make_shared<tesseract_common::VectorVector3d>();
+  vertices->emplace_back(0, 0, 0);
+  vertices->emplace_back(size, 0, 0);
+  vertices->emplace_back(0, size, 0);
+  vertices->emplace_back(0, 0, size);
+
+  auto faces = std::make_shared<Eigen::VectorXi>(16);
+  *faces << 3, 0, 2, 1, 3, 0, 1, 3, 3, 0, 3, 2, 3, 1, 2, 3;
+  return std::make_shared<tesseract_geometry::Mesh>(vertices, faces);
+}
+
+TEST(TesseractCoreUnit, ConvexDecompositionBatchUnit)  // NOLINT
+{
+  TestConvexDecomposition decomposition("test");
+
+  std::vector<tesseract_geometry::PolygonMesh::ConstPtr> meshes;
+  for (int i = 1; i <= 20; ++i)
+    meshes.push_back(createTetrahedron(i));
+
+  for (std::size_t num_threads : { 0UL, 1UL, 4UL, 100UL })
+  {
+    decomposition.calls = 0;
+    auto results = decomposition.computeBatch(meshes, num_threads);
+    EXPECT_EQ(decomposition.calls, 20);
+    ASSERT_EQ(results.size(), meshes.size());
+    for (std::size_t i = 0; i < results.size(); ++i)
+    {
+      ASSERT_EQ(results[i].size(), 1);
+      EXPECT_TRUE(results[i][0]->getVertices()->at(1).isApprox(meshes[i]->getVertices()->at(1)));
+    }
+  }
+
+  EXPECT_TRUE(decomposition.computeBatch({}).empty());
+
+  // Errors are propagated to the caller
+  auto empty_mesh = std::make_shared<tesseract_geometry::Mesh>(
+      std::make_shared<tesseract_common::VectorVector3d>(), std::make_shared<Eigen::VectorXi>());
+  meshes.push_back(empty_mesh);
+  EXPECT_ANY_THROW(decomposition.computeBatch(meshes, 4));  // NOLINT
+}
+
+TEST(TesseractCoreUnit, ConvexDecompositionCacheUnit)  // NOLINT
+{
+  using tesseract_collision::ConvexMeshCache;
+
+  const tesseract_common::fs::path cache_path =
+      tesseract_common::fs::temp_directory_path() / tesseract_common::fs::unique_path("convex_mesh_cache_%%%%-%%%%");
+  auto cache = std::make_shared<ConvexMeshCache>(cache_path.string());
+  EXPECT_EQ(cache->getDirectory(), cache_path.string());
+  EXPECT_TRUE(tesseract_common::fs::is_directory(cache_path));
+
+  auto mesh1 = createTetrahedron(1);
+  auto mesh2 = createTetrahedron(2);
+
+  // The key depends on the mesh content and the parameters
+  const std::string key = ConvexMeshCache::createKey(*mesh1->getVertices(), *mesh1->getFaces(), "test");
+  EXPECT_EQ(key, ConvexMeshCache::createKey(*createTetrahedron(1)->getVertices(), *mesh1->getFaces(), "test"));
+  EXPECT_NE(key, ConvexMeshCache::createKey(*mesh2->getVertices(), *mesh2->getFaces(), "test"));
+  EXPECT_NE(key, ConvexMeshCache::createKey(*mesh1->getVertices(), *mesh1->getFaces(), "other"));
+
+  std::vector<tesseract_geometry::ConvexMesh::Ptr> loaded;
+  EXPECT_FALSE(cache->load(loaded, key));
+
+  auto decomposition = std::make_shared<TestConvexDecomposition>("test");
+  tesseract_collision::CachedConvexDecomposition cached(decomposition, cache);
+  EXPECT_EQ(cached.getParametersKey(), "test");
+
+  std::vector<tesseract_geometry::PolygonMesh::ConstPtr> meshes{ mesh1, mesh2, mesh1, mesh2 };
+  auto results = cached.computeBatch(meshes, 1);
+  EXPECT_EQ(decomposition->calls, 2);
+  ASSERT_EQ(results.size(), 4);
+  for (std::size_t i = 0; i < results.size(); ++i)
+  {
+    ASSERT_EQ(results[i].size(), 1);
+    EXPECT_EQ(results[i][0]->getVertexCount(), 4);
+    EXPECT_EQ(results[i][0]->getFaceCount(), 4);
+    EXPECT_TRUE(results[i][0]->getVertices()->at(1).isApprox(meshes[i]->getVertices()->at(1)));
+  }
+
+  // A new cache using the same directory loads the results from disk
+  auto decomposition2 = std::make_shared<TestConvexDecomposition>("test");
+  tesseract_collision::CachedConvexDecomposition cached2(decomposition2,
+                                                         std::make_shared<ConvexMeshCache>(cache_path.string()));
+  results = cached2.computeBatch(meshes, 4);
+  EXPECT_EQ(decomposition2->calls, 0);
+  ASSERT_EQ(results.size(), 4);
+  EXPECT_TRUE(results[3][0]->getVertices()->at(3).isApprox(Eigen::Vector3d(0, 0, 2)));
+
+  EXPECT_TRUE(cache->load(loaded, key));
+  ASSERT_EQ(loaded.size(), 1);
+  EXPECT_EQ(loaded[0]->getFaces()->size(), 16);
+
+  // Different parameters are not loaded from the cache
+  auto decomposition3 = std::make_shared<TestConvexDecomposition>("other");
+  tesseract_collision::CachedConvexDecomposition cached3(decomposition3, cache);
+  cached3.compute(*mesh1->getVertices(), *mesh1->getFaces());
+  EXPECT_EQ(decomposition3->calls, 1);
+
+  // Decompositions without a parameters key are not cached
+  auto decomposition4 = std::make_shared<TestConvexDecomposition>("");
+  tesseract_collision::CachedConvexDecomposition cached4(decomposition4, cache);
+  cached4.compute(*mesh1->getVertices(), *mesh1->getFaces());
+  cached4.compute(*mesh1->getVertices(), *mesh1->getFaces());
+  EXPECT_EQ(decomposition4->calls, 2);
+
+  EXPECT_ANY_THROW(tesseract_collision::CachedConvexDecomposition(nullptr, cache));          // NOLINT
+  EXPECT_ANY_THROW(tesseract_collision::CachedConvexDecomposition(decomposition, nullptr));  // NOLINT
+
+  tesseract_common::fs::remove_all(cache_path);
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,161 @@
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <gtest/gtest.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/test_suite/collision_box_box_unit.hpp>
+#include <tesseract_collision/core/lod_discrete_manager.h>
+#include <tesseract_collision/bullet/convex_hull_utils.h>
+#include <tesseract_collision/bullet/bullet_discrete_simple_manager.h>
+#include <tesseract_collision/bullet/bullet_discrete_bvh_manager.h>
+#include <tesseract_collision/fcl/fcl_discrete_managers.h>
+#include <tesseract_geometry/geometries.h>
+
+using namespace tesseract_collision;
+
+/** @brief Create a manager with a bounding sphere level followed by a convex hull level */
+template <typename ManagerType>
+LODDiscreteManager createLODManager()
+{
+  LODGeometryFn convex_hull_fn = [](CollisionShapesConst& lod_shapes,
+                                    tesseract_common::VectorIsometry3d& lod_shape_poses,
+                                    const CollisionShapesConst& shapes,
+                                    const tesseract_common::VectorIsometry3d& shape_poses) {
+    lod_shapes.clear();
+    for (const auto& shape : shapes)
+    {
+      if (shape->getType() == tesseract_geometry::GeometryType::MESH)
+        lod_shapes.push_back(makeConvexMesh(static_cast<const tesseract_geometry::Mesh&>(*shape)));
+      else
+        lod_shapes.push_back(shape);
+    }
+    lod_shape_poses = shape_poses;
+  };
+
+  std::vector<LODLevel> levels;
+  levels.push_back(LODLevel{ std::make_unique<ManagerType>(), createBoundingSpheres });
+  levels.push_back(LODLevel{ std::make_unique<ManagerType>(), convex_hull_fn });
+  return LODDiscreteManager(std::make_unique<ManagerType>(), std::move(levels));
+}
+
+TEST(TesseractCollisionUnit, CreateBoundingSpheresUnit)  // NOLINT
+{
+  auto vertices = std::make_shared<tesseract_common::VectorVector3d>();
+  vertices->emplace_back(1, 1, 1);
+  vertices->emplace_back(3, 1, 1);
+  vertices->emplace_back(1, 3, 1);
+  vertices->emplace_back(1, 1, 3);
+  auto faces = std::make_shared<Eigen::VectorXi>(4);
+  *faces << 3, 0, 1, 2;
+
+  CollisionShapesConst shapes;
+  tesseract_common::VectorIsometry3d shape_poses;
+  shapes.push_back(std::make_shared<tesseract_geometry::Box>(1, 2, 2));
+  shape_poses.push_back(Eigen::Isometry3d::Identity());
+  shapes.push_back(std::make_shared<tesseract_geometry::Capsule>(0.5, 2));
+  shape_poses.push_back(Eigen::Isometry3d::Identity());
+  shapes.push_back(std::make_shared<tesseract_geometry::Mesh>(vertices, faces));
+  shape_poses.push_back(Eigen::Isometry3d(Eigen::Translation3d(0, 0, 1)));
+  shapes.push_back(std::make_shared<tesseract_geometry::Plane>(0, 0, 1, 0));
+  shape_poses.push_back(Eigen::Isometry3d::Identity());
+
+  CollisionShapesConst lod_shapes;
+  tesseract_common::VectorIsometry3d lod_shape_poses;
+  createBoundingSpheres(lod_shapes, lod_shape_poses, shapes, shape_poses);
+  ASSERT_EQ(lod_shapes.size(), 4);
+  ASSERT_EQ(lod_shape_poses.size(), 4);
+
+  ASSERT_EQ(lod_shapes[0]->getType(), tesseract_geometry::GeometryType::SPHERE);
+  EXPECT_NEAR(static_cast<const tesseract_geometry::Sphere&>(*lod_shapes[0]).getRadius(), 1.5, 1e-6);
+  EXPECT_TRUE(lod_shape_poses[0].isApprox(shape_poses[0]));
+
+  ASSERT_EQ(lod_shapes[1]->getType(), tesseract_geometry::GeometryType::SPHERE);
+  EXPECT_NEAR(static_cast<const tesseract_geometry::Sphere&>(*lod_shapes[1]).getRadius(), 1.5, 1e-6);
+
+  // The sphere is centered on the bounding box of the vertices and encloses all of them
+  ASSERT_EQ(lod_shapes[2]->getType(), tesseract_geometry::GeometryType::SPHERE);
+  double radius = static_cast<const tesseract_geometry::Sphere&>(*lod_shapes[2]).getRadius();
+  EXPECT_TRUE(lod_shape_poses[2].translation().isApprox(Eigen::Vector3d(2, 2, 3)));
+  for (const auto& v : *vertices)
+    EXPECT_LE(((shape_poses[2] * v) - lod_shape_poses[2].translation()).norm(), radius + 1e-6);
+
+  // Planes can not be bounded so they are kept
+  EXPECT_TRUE(lod_shapes[3] == shapes[3]);
+}
+
+TEST(TesseractCollisionUnit, BulletDiscreteBVHLODCollisionBoxBoxUnit)  // NOLINT
+{
+  LODDiscreteManager checker = createLODManager<tesseract_collision_bullet::BulletDiscreteBVHManager>();
+  test_suite::runTest(checker);
+}
+
+TEST(TesseractCollisionUnit, BulletDiscreteBVHLODCollisionBoxBoxConvexHullUnit)  // NOLINT
+{
+  LODDiscreteManager checker = createLODManager<tesseract_collision_bullet::BulletDiscreteBVHManager>();
+  test_suite::runTest(checker, true);
+}
+
+TEST(TesseractCollisionUnit, FCLDiscreteBVHLODCollisionBoxBoxUnit)  // NOLINT
+{
+  LODDiscreteManager checker = createLODManager<tesseract_collision_fcl::FCLDiscreteBVHManager>();
+  test_suite::runTest(checker);
+}
+
+TEST(TesseractCollisionUnit, LODDiscreteManagerUnit)  // NOLINT
+{
+  LODDiscreteManager checker = createLODManager<tesseract_collision_bullet::BulletDiscreteSimpleManager>();
+  EXPECT_EQ(checker.getLevelCount(), 2);
+
+  CollisionShapesConst shapes{ std::make_shared<tesseract_geometry::Box>(1, 1, 1) };
+  tesseract_common::VectorIsometry3d shape_poses{ Eigen::Isometry3d::Identity() };
+  EXPECT_TRUE(checker.addCollisionObject("box_link", 0, shapes, shape_poses));
+  EXPECT_TRUE(checker.addCollisionObject("box2_link", 0, shapes, shape_poses));
+  EXPECT_TRUE(checker.getLevelManager(0).hasCollisionObject("box_link"));
+  EXPECT_EQ(checker.getLevelManager(0).getCollisionObjectGeometries("box_link").front()->getType(),
+            tesseract_geometry::GeometryType::SPHERE);
+  EXPECT_EQ(checker.getCollisionObjectGeometries("box_link").front()->getType(),
+            tesseract_geometry::GeometryType::BOX);
+
+  checker.setActiveCollisionObjects({ "box_link" });
+  checker.setDefaultCollisionMarginData(0.1);
+
+  // The bounding spheres are within the margin at the corners but the boxes are not
+  Eigen::Isometry3d pose = Eigen::Isometry3d::Identity();
+  pose.translation() = Eigen::Vector3d(1.15, 0.9, 0);
+  checker.setCollisionObjectsTransform("box_link", pose);
+
+  ContactResultMap result;
+  checker.contactTest(result, ContactRequest(ContactTestType::ALL));
+  EXPECT_TRUE(result.empty());
+
+  pose.translation() = Eigen::Vector3d(1.05, 0, 0);
+  checker.setCollisionObjectsTransform("box_link", pose);
+  checker.contactTest(result, ContactRequest(ContactTestType::ALL));
+  ASSERT_EQ(result.size(), 1);
+  EXPECT_NEAR(result.begin()->second.front().distance, 0.05, 1e-5);
+
+  // The allowed collision function is applied to every level
+  checker.setIsContactAllowedFn([](const std::string&, const std::string&) { return true; });
+  result.clear();
+  checker.contactTest(result, ContactRequest(ContactTestType::ALL));
+  EXPECT_TRUE(result.empty());
+  EXPECT_TRUE(checker.getIsContactAllowedFn()("box_link", "box2_link"));
+
+  // Clones check the same levels of detail
+  checker.setIsContactAllowedFn(nullptr);
+  DiscreteContactManager::UPtr clone = checker.clone();
+  clone->contactTest(result, ContactRequest(ContactTestType::ALL));
+  EXPECT_EQ(result.size(), 1);
+
+  EXPECT_TRUE(checker.removeCollisionObject("box2_link"));
+  EXPECT_FALSE(checker.getLevelManager(0).hasCollisionObject("box2_link"));
+  EXPECT_FALSE(checker.getLevelManager(1).hasCollisionObject("box2_link"));
+  EXPECT_TRUE(clone->hasCollisionObject("box2_link"));
+}
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+
+  return RUN_ALL_TESTS();
+}
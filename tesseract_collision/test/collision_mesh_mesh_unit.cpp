@@ -1,11 +1,13 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <gtest/gtest.h>
+#include <thread>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_collision/test_suite/collision_mesh_mesh_unit.hpp>
 #include <tesseract_collision/bullet/bullet_discrete_simple_manager.h>
 #include <tesseract_collision/bullet/bullet_discrete_bvh_manager.h>
+#include <tesseract_collision/bullet/bullet_utils.h>
 #include <tesseract_collision/fcl/fcl_discrete_managers.h>
 
 using namespace tesseract_collision;
@@ -22,6 +24,121 @@ TEST(TesseractCollisionUnit, BulletDiscreteBVHCollisionMeshMeshUnit)  // NOLINT
   test_suite::runTest(checker);
 }
 
+TEST(TesseractCollisionUnit, BulletDiscreteSimpleCollisionMeshBVHMeshBVHUnit)  // NOLINT
+{
+  tesseract_collision_bullet::TesseractCollisionConfigurationInfo config_info;
+  config_info.mesh_bvh_cache = std::make_shared<tesseract_collision_bullet::BulletMeshBVHCache>();
+  tesseract_collision_bullet::BulletDiscreteSimpleManager checker("BulletDiscreteSimpleManager", config_info);
+  test_suite::runTest(checker);
+}
+
+TEST(TesseractCollisionUnit, BulletDiscreteBVHCollisionMeshBVHMeshBVHUnit)  // NOLINT
+{
+  tesseract_collision_bullet::TesseractCollisionConfigurationInfo config_info;
+  config_info.mesh_bvh_cache = std::make_shared<tesseract_collision_bullet::BulletMeshBVHCache>();
+  tesseract_collision_bullet::BulletDiscreteBVHManager checker("BulletDiscreteBVHManager", config_info);
+  test_suite::runTest(checker);
+
+  // The meshes share their buffers so a single hierarchy is shared by both objects and by clones
+  EXPECT_EQ(config_info.mesh_bvh_cache->size(), 1);
+  DiscreteContactManager::UPtr clone = checker.clone();
+  EXPECT_EQ(config_info.mesh_bvh_cache->size(), 1);
+}
+
+TEST(TesseractCollisionUnit, BulletMeshBVHCacheUnit)  // NOLINT
+{
+  using tesseract_collision_bullet::BulletMeshBVH;
+  using tesseract_collision_bullet::BulletMeshBVHCache;
+
+  auto vertices = std::make_shared<tesseract_common::VectorVector3d>();
+  auto faces = std::make_shared<Eigen::VectorXi>();
+  loadSimplePlyFile(std::string(TESSERACT_SUPPORT_DIR) + "/meshes/sphere_p25m.ply", *vertices, *faces, true);
+  auto mesh = std::make_shared<tesseract_geometry::Mesh>(vertices, faces);
+
+  const tesseract_common::fs::path cache_path =
+      tesseract_common::fs::temp_directory_path() / tesseract_common::fs::unique_path("mesh_bvh_cache_%%%%-%%%%");
+  auto cache = std::make_shared<BulletMeshBVHCache>(cache_path.string());
+  EXPECT_EQ(cache->getDirectory(), cache_path.string());
+  EXPECT_EQ(cache->size(), 0);
+
+  BulletMeshBVH::ConstPtr bvh = cache->get(mesh);
+  EXPECT_FALSE(bvh->isLoaded());
+  EXPECT_EQ(&bvh->getGeometry(), mesh.get());
+  EXPECT_TRUE(cache->get(mesh) == bvh);
+  EXPECT_EQ(cache->size(), 1);
+
+  // A new cache using the same directory loads the hierarchy from disk
+  auto cache2 = std::make_shared<BulletMeshBVHCache>(cache_path.string());
+  BulletMeshBVH::ConstPtr loaded_bvh = cache2->get(mesh);
+  EXPECT_TRUE(loaded_bvh->isLoaded());
+  EXPECT_EQ(loaded_bvh->getBVH()->getQuantizedNodeArray().size(), bvh->getBVH()->getQuantizedNodeArray().size());
+
+  // A different mesh does not use the stored hierarchy
+  auto scaled_vertices = std::make_shared<tesseract_common::VectorVector3d>(*vertices);
+  for (auto& v : *scaled_vertices)
+    v *= 2;
+  EXPECT_FALSE(cache2->get(std::make_shared<tesseract_geometry::Mesh>(scaled_vertices, faces))->isLoaded());
+
+  // A compact mesh with the same triangles shares the cache but never the stored hierarchy of the mesh
+  auto compact_mesh = std::make_shared<tesseract_geometry::CompactMesh>(*mesh);
+  BulletMeshBVH::ConstPtr compact_bvh = cache->get(compact_mesh);
+  EXPECT_FALSE(compact_bvh->isLoaded());
+  EXPECT_EQ(&compact_bvh->getGeometry(), compact_mesh.get());
+  EXPECT_NE(compact_bvh->getKey(), bvh->getKey());
+  EXPECT_TRUE(cache->get(compact_mesh) == compact_bvh);
+  EXPECT_EQ(cache->size(), 2);
+  EXPECT_TRUE(cache2->get(compact_mesh)->isLoaded());
+
+  // The hierarchy is released once it is no longer referenced
+  bvh = nullptr;
+  compact_bvh = nullptr;
+  EXPECT_EQ(cache->size(), 0);
+
+  tesseract_common::fs::remove_all(cache_path);
+}
+
+TEST(TesseractCollisionUnit, BulletMeshBVHCacheConcurrentUnit)  // NOLINT
+{
+  using tesseract_collision_bullet::BulletMeshBVH;
+  using tesseract_collision_bullet::BulletMeshBVHCache;
+
+  auto vertices = std::make_shared<tesseract_common::VectorVector3d>();
+  auto faces = std::make_shared<Eigen::VectorXi>();
+  loadSimplePlyFile(std::string(TESSERACT_SUPPORT_DIR) + "/meshes/sphere_p25m.ply", *vertices, *faces, true);
+  auto mesh = std::make_shared<tesseract_geometry::Mesh>(vertices, faces);
+  auto compact_mesh = std::make_shared<tesseract_geometry::CompactMesh>(*mesh);
+
+  // Threads requesting the same geometry share a single hierarchy while different geometry is built in parallel
+  BulletMeshBVHCache cache;
+  const std::size_t num_threads = 8;
+  std::vector<BulletMeshBVH::ConstPtr> bvhs(num_threads);
+  std::vector<std::thread> threads;
+  threads.reserve(num_threads);
+  for (std::size_t i = 0; i < num_threads; ++i)
+  {
+    threads.emplace_back([&, i]() {
+      if (i % 2 == 0)
+        bvhs[i] = cache.get(mesh);
+      else
+        bvhs[i] = cache.get(compact_mesh);
+    });
+  }
+
+  for (auto& thread : threads)
+    thread.join();
+
+  for (std::size_t i = 0; i < num_threads; ++i)
+  {
+    ASSERT_TRUE(bvhs[i] != nullptr);
+    EXPECT_TRUE(bvhs[i] == bvhs[i % 2]);
+  }
+  EXPECT_TRUE(bvhs[0] != bvhs[1]);
+  EXPECT_EQ(cache.size(), 2);
+
+  bvhs.clear();
+  EXPECT_EQ(cache.size(), 0);
+}
+
 TEST(TesseractCollisionUnit, FCLDiscreteBVHCollisionMeshMeshUnit)  // NOLINT
 {
   tesseract_collision_fcl::FCLDiscreteBVHManager checker;
@@ -0,0 +1,196 @@
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <gtest/gtest.h>
+#include <yaml-cpp/yaml.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/test_suite/collision_sphere_sphere_unit.hpp>
+#include <tesseract_collision/core/sphere_decomposition.h>
+#include <tesseract_collision/spheres/sphere_discrete_manager.h>
+#include <tesseract_collision/spheres/sphere_factories.h>
+#include <tesseract_geometry/geometries.h>
+
+using namespace tesseract_collision;
+
+/** @brief Check that every point is inside at least one of the spheres */
+void checkPointsEnclosed(const tesseract_common::VectorVector4d& spheres,
+                         const tesseract_common::VectorVector3d& points)
+{
+  for (const auto& p : points)
+  {
+    bool enclosed = std::any_of(spheres.begin(), spheres.end(), [&p](const Eigen::Vector4d& sphere) {
+      return (p - sphere.head<3>()).norm() <= sphere[3] + 1e-9;
+    });
+    EXPECT_TRUE(enclosed) << "Point is not enclosed: " << p.transpose();
+  }
+}
+
+TEST(TesseractCollisionUnit, SphereDecompositionUnit)  // NOLINT
+{
+  const double resolution = 0.1;
+  const double radius = 0.5 * std::sqrt(3.0) * resolution;
+
+  {  // Sphere
+    auto spheres = createSphereDecomposition(tesseract_geometry::Sphere(0.25), resolution);
+    ASSERT_EQ(spheres.size(), 1);
+    EXPECT_TRUE(spheres[0].isApprox(Eigen::Vector4d(0, 0, 0, 0.25)));
+  }
+
+  {  // Box corners, edges and center are enclosed and every sphere is close to the box
+    auto spheres = createSphereDecomposition(tesseract_geometry::Box(1, 0.5, 0.25), resolution);
+    EXPECT_FALSE(spheres.empty());
+    tesseract_common::VectorVector3d points;
+    for (double x : { -0.5, 0.0, 0.5 })
+      for (double y : { -0.25, 0.0, 0.25 })
+        for (double z : { -0.125, 0.0, 0.125 })
+          points.emplace_back(x, y, z);
+    checkPointsEnclosed(spheres, points);
+
+    for (const auto& sphere : spheres)
+    {
+      EXPECT_LE(std::abs(sphere.x()), 0.5 + radius);
+      EXPECT_LE(std::abs(sphere.y()), 0.25 + radius);
+      EXPECT_LE(std::abs(sphere.z()), 0.125 + radius);
+      EXPECT_NEAR(sphere[3], radius, 1e-9);
+    }
+  }
+
+  {  // Cylinder, capsule and cone
+    tesseract_common::VectorVector3d cylinder_points{ { 0.2, 0, 0.5 }, { 0, -0.2, -0.5 }, { 0, 0, 0 } };
+    checkPointsEnclosed(createSphereDecomposition(tesseract_geometry::Cylinder(0.2, 1), resolution), cylinder_points);
+
+    tesseract_common::VectorVector3d capsule_points{ { 0.2, 0, 0.5 }, { 0, 0, -0.7 }, { 0, 0, 0.7 } };
+    checkPointsEnclosed(createSphereDecomposition(tesseract_geometry::Capsule(0.2, 1), resolution), capsule_points);
+
+    tesseract_common::VectorVector3d cone_points{ { 0.2, 0, -0.5 }, { 0, 0, 0.5 }, { 0, 0.1, 0 } };
+    checkPointsEnclosed(createSphereDecomposition(tesseract_geometry::Cone(0.2, 1), resolution), cone_points);
+  }
+
+  {  // Mesh vertices are enclosed
+    auto vertices = std::make_shared<tesseract_common::VectorVector3d>();
+    for (double x : { -0.5, 0.5 })
+      for (double y : { -0.5, 0.5 })
+        for (double z : { -0.5, 0.5 })
+          vertices->emplace_back(x, y, z);
+
+    // The faces of a cube with edge length one
+    auto faces = std::make_shared<Eigen::VectorXi>(48);
+    *faces << 3, 0, 1, 3, 3, 0, 3, 2, 3, 4, 5, 7, 3, 4, 7, 6, 3, 0, 1, 5, 3, 0, 5, 4, 3, 2, 3, 7, 3, 2, 7, 6, 3, 0, 2,
+        6, 3, 0, 6, 4, 3, 1, 3, 7, 3, 1, 7, 5;
+    tesseract_geometry::Mesh mesh(vertices, faces, 12);
+    auto spheres = createSphereDecomposition(mesh, resolution);
+    checkPointsEnclosed(spheres, *vertices);
+    checkPointsEnclosed(spheres, { Eigen::Vector3d(0.5, 0, 0), Eigen::Vector3d(0.1, -0.5, 0.2) });
+
+    // A mesh is not required to be closed so only the surface is approximated
+    for (const auto& sphere : spheres)
+      EXPECT_GE(sphere.head<3>().cwiseAbs().maxCoeff(), 0.5 - radius);
+
+    // A convex mesh is filled
+    tesseract_geometry::ConvexMesh convex_mesh(vertices, faces, 12);
+    auto convex_spheres = createSphereDecomposition(convex_mesh, resolution);
+    EXPECT_GT(convex_spheres.size(), spheres.size());
+    checkPointsEnclosed(convex_spheres, *vertices);
+    checkPointsEnclosed(convex_spheres, { Eigen::Vector3d(0, 0, 0), Eigen::Vector3d(0.2, -0.1, 0.3) });
+
+    // A compact mesh approximates the same surface as the mesh
+    auto compact_spheres = createSphereDecomposition(tesseract_geometry::CompactMesh(mesh), resolution);
+    EXPECT_EQ(compact_spheres.size(), spheres.size());
+    checkPointsEnclosed(compact_spheres, *vertices);
+  }
+
+  {  // Planes can not be approximated
+    EXPECT_TRUE(createSphereDecomposition(tesseract_geometry::Plane(0, 0, 1, 0), resolution).empty());
+  }
+
+  EXPECT_ANY_THROW(createSphereDecomposition(tesseract_geometry::Box(1, 1, 1), 0));  // NOLINT
+}
+
+TEST(TesseractCollisionUnit, SphereDiscreteManagerCollisionSphereSphereUnit)  // NOLINT
+{
+  tesseract_collision_spheres::SphereDiscreteManager checker;
+  test_suite::detail::addCollisionObjects(checker, false);
+  test_suite::detail::runTestPrimitive(checker);
+}
+
+TEST(TesseractCollisionUnit, SphereDiscreteManagerBoxPlaneUnit)  // NOLINT
+{
+  const double resolution = 0.02;
+  const double radius = 0.5 * std::sqrt(3.0) * resolution;
+  tesseract_collision_spheres::SphereDiscreteManager checker("SphereDiscreteManager", resolution);
+  EXPECT_NEAR(checker.getResolution(), resolution, 1e-9);
+
+  CollisionShapesConst plane_shapes{ std::make_shared<tesseract_geometry::Plane>(0, 0, 1, 0) };
+  tesseract_common::VectorIsometry3d plane_poses{ Eigen::Isometry3d::Identity() };
+  EXPECT_TRUE(checker.addCollisionObject("plane_link", 0, plane_shapes, plane_poses));
+
+  CollisionShapesConst box_shapes{ std::make_shared<tesseract_geometry::Box>(0.2, 0.2, 0.2) };
+  tesseract_common::VectorIsometry3d box_poses{ Eigen::Isometry3d::Identity() };
+  EXPECT_TRUE(checker.addCollisionObject("box_link", 0, box_shapes, box_poses));
+
+  checker.setActiveCollisionObjects({ "box_link" });
+  checker.setDefaultCollisionMarginData(0.5);
+
+  Eigen::Isometry3d pose = Eigen::Isometry3d::Identity();
+  pose.translation() = Eigen::Vector3d(1, 2, 0.5);
+  checker.setCollisionObjectsTransform("box_link", pose);
+
+  ContactResultMap result;
+  checker.contactTest(result, ContactRequest(ContactTestType::CLOSEST));
+  ContactResultVector result_vector;
+  result.flattenMoveResults(result_vector);
+  ASSERT_EQ(result_vector.size(), 1);
+
+  // The spheres enclose the box so the distance is underestimated by at most the sphere radius
+  EXPECT_LE(result_vector[0].distance, 0.4 + 1e-9);
+  EXPECT_GE(result_vector[0].distance, 0.4 - radius);
+
+  const double sign = (result_vector[0].link_names[0] == "plane_link") ? 1 : -1;
+  EXPECT_TRUE(result_vector[0].normal.isApprox(sign * Eigen::Vector3d::UnitZ()));
+  const std::size_t plane_idx = (result_vector[0].link_names[0] == "plane_link") ? 0 : 1;
+  EXPECT_NEAR(result_vector[0].nearest_points[plane_idx].z(), 0, 1e-9);
+  EXPECT_NEAR(result_vector[0].nearest_points[1 - plane_idx].z(), 0.5 - 0.1, radius);
+
+  // The box is below the plane
+  pose.translation() = Eigen::Vector3d(0, 0, -0.2);
+  checker.setCollisionObjectsTransform("box_link", pose);
+  result.clear();
+  result_vector.clear();
+  checker.contactTest(result, ContactRequest(ContactTestType::CLOSEST));
+  result.flattenMoveResults(result_vector);
+  ASSERT_EQ(result_vector.size(), 1);
+  EXPECT_LE(result_vector[0].distance, -0.3 + 1e-9);
+
+  // Static objects are not checked against each other
+  checker.setActiveCollisionObjects({ "other_link" });
+  result.clear();
+  checker.contactTest(result, ContactRequest(ContactTestType::CLOSEST));
+  EXPECT_TRUE(result.empty());
+}
+
+TEST(TesseractCollisionUnit, SphereDiscreteManagerFactoryUnit)  // NOLINT
+{
+  tesseract_collision_spheres::SphereDiscreteManagerFactory factory;
+
+  DiscreteContactManager::UPtr manager = factory.create("sphere_manager", YAML::Load("resolution: 0.1"));
+  ASSERT_TRUE(manager != nullptr);
+  EXPECT_EQ(manager->getName(), "sphere_manager");
+  auto* sphere_manager = dynamic_cast<tesseract_collision_spheres::SphereDiscreteManager*>(manager.get());
+  ASSERT_TRUE(sphere_manager != nullptr);
+  EXPECT_NEAR(sphere_manager->getResolution(), 0.1, 1e-9);
+
+  // The clone uses the same resolution
+  DiscreteContactManager::UPtr clone = manager->clone();
+  EXPECT_NEAR(dynamic_cast<tesseract_collision_spheres::SphereDiscreteManager&>(*clone).getResolution(), 0.1, 1e-9);
+
+  EXPECT_TRUE(factory.create("sphere_manager", YAML::Node()) != nullptr);
+  EXPECT_TRUE(factory.create("sphere_manager", YAML::Load("resolution: -0.1")) == nullptr);
+  EXPECT_TRUE(factory.create("sphere_manager", YAML::Load("resolution: abc")) == nullptr);
+}
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+
+  return RUN_ALL_TESTS();
+}
@@ -147,6 +147,74 @@ TEST(TesseractCollisionUnit, CombineContactAllowedFnUnit)  // NOLINT
   }
 }
 
+TEST(TesseractCollisionUnit, ReplaceIsContactAllowedFnOverrideUnit)  // NOLINT
+{
+  tesseract_collision_bullet::BulletDiscreteSimpleManager checker;
+  checker.setIsContactAllowedFn([](const std::string& link_name1, const std::string& link_name2) {
+    return (link_name1 == "link_1" && link_name2 == "link_2");
+  });
+
+  tesseract_common::AllowedCollisionMatrix acm1;
+  acm1.addAllowedCollision("link_1", "link_3", "Adjacent");
+
+  tesseract_common::AllowedCollisionMatrix acm2;
+  acm2.addAllowedCollision("link_4", "link_3", "Adjacent");
+
+  {  // tesseract_collision::ACMOverrideType::OR
+    replaceIsContactAllowedFnOverride(checker, acm1, ACMOverrideType::OR);
+    EXPECT_TRUE(checker.getIsContactAllowedFn()("link_1", "link_2"));
+    EXPECT_TRUE(checker.getIsContactAllowedFn()("link_1", "link_3"));
+    EXPECT_TRUE(checker.getIsContactAllowedFn()("link_3", "link_1"));
+    EXPECT_FALSE(checker.getIsContactAllowedFn()("link_3", "link_4"));
+
+    // The second override replaces the first instead of being combined with it
+    replaceIsContactAllowedFnOverride(checker, acm2, ACMOverrideType::OR);
+    EXPECT_TRUE(checker.getIsContactAllowedFn()("link_1", "link_2"));
+    EXPECT_FALSE(checker.getIsContactAllowedFn()("link_1", "link_3"));
+    EXPECT_TRUE(checker.getIsContactAllowedFn()("link_3", "link_4"));
+
+    // Applying the same override many times does not nest the IsContactAllowedFn
+    for (int i = 0; i < 10; ++i)
+      replaceIsContactAllowedFnOverride(checker, acm2, ACMOverrideType::OR);
+
+    const auto* override = checker.getIsContactAllowedFn().target<ContactAllowedFnOverride>();
+    ASSERT_TRUE(override != nullptr);
+    EXPECT_TRUE(override->getBase().target<ContactAllowedFnOverride>() == nullptr);
+    EXPECT_EQ(override->getType(), ACMOverrideType::OR);
+  }
+
+  {  // tesseract_collision::ACMOverrideType::AND
+    replaceIsContactAllowedFnOverride(checker, acm1, ACMOverrideType::AND);
+    EXPECT_FALSE(checker.getIsContactAllowedFn()("link_1", "link_2"));
+    EXPECT_FALSE(checker.getIsContactAllowedFn()("link_1", "link_3"));
+  }
+
+  {  // tesseract_collision::ACMOverrideType::ASSIGN
+    replaceIsContactAllowedFnOverride(checker, acm1, ACMOverrideType::ASSIGN);
+    EXPECT_FALSE(checker.getIsContactAllowedFn()("link_1", "link_2"));
+    EXPECT_TRUE(checker.getIsContactAllowedFn()("link_1", "link_3"));
+  }
+
+  {  // tesseract_collision::ACMOverrideType::NONE
+    replaceIsContactAllowedFnOverride(checker, acm1, ACMOverrideType::NONE);
+    EXPECT_TRUE(checker.getIsContactAllowedFn().target<ContactAllowedFnOverride>() == nullptr);
+    EXPECT_TRUE(checker.getIsContactAllowedFn()("link_1", "link_2"));
+    EXPECT_FALSE(checker.getIsContactAllowedFn()("link_1", "link_3"));
+  }
+
+  {  // Restore
+    ContactManagerConfig config;
+    config.acm = acm1;
+    checker.applyContactManagerConfig(config);
+    EXPECT_TRUE(checker.getIsContactAllowedFn()("link_1", "link_3"));
+
+    restoreIsContactAllowedFn(checker);
+    EXPECT_TRUE(checker.getIsContactAllowedFn().target<ContactAllowedFnOverride>() == nullptr);
+    EXPECT_TRUE(checker.getIsContactAllowedFn()("link_1", "link_2"));
+    EXPECT_FALSE(checker.getIsContactAllowedFn()("link_1", "link_3"));
+  }
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
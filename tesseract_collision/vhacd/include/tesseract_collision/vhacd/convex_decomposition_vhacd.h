@@ -61,6 +61,9 @@ struct VHACDParameters
   bool find_best_plane{ false };
 
   void print() const;
+
+  /** @brief Get a string uniquely identifying the parameters, used to key cached results */
+  std::string getKey() const;
 };
 
 class ConvexDecompositionVHACD : public ConvexDecomposition
@@ -75,6 +78,8 @@ public:
   std::vector<tesseract_geometry::ConvexMesh::Ptr> compute(const tesseract_common::VectorVector3d& vertices,
                                                            const Eigen::VectorXi& faces) const override;
 
+  std::string getParametersKey() const override;
+
 private:
   VHACDParameters params_;
 };
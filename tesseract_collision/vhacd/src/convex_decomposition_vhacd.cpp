@@ -115,6 +115,8 @@ ConvexDecompositionVHACD::compute(const tesseract_common::VectorVector3d& vertic
   return output;
 }
 
+std::string ConvexDecompositionVHACD::getParametersKey() const { return "VHACD;" + params_.getKey(); }
+
 void VHACDParameters::print() const
 {
   std::stringstream msg;
@@ -146,4 +148,14 @@ void VHACDParameters::print() const
   std::cout << msg.str();
 }
 
+std::string VHACDParameters::getKey() const
+{
+  std::stringstream key;
+  key.precision(17);
+  key << max_convex_hulls << ";" << resolution << ";" << minimum_volume_percent_error_allowed << ";"
+      << max_recursion_depth << ";" << shrinkwrap << ";" << static_cast<int>(fill_mode) << ";"
+      << max_num_vertices_per_ch << ";" << async_ACD << ";" << min_edge_length << ";" << find_best_plane;
+  return key.str();
+}
+
 }  // namespace tesseract_collision
@@ -0,0 +1,193 @@
+/**
+ * @file metrics.h
+ * @brief Lightweight performance counters and tracing hooks
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_COMMON_METRICS_H
+#define TESSERACT_COMMON_METRICS_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+namespace tesseract_common
+{
+/** @brief The aggregated statistics of a metric */
+struct MetricStatistics
+{
+  /** @brief The name of the metric */
+  std::string name;
+
+  /** @brief The number of recorded scopes or the sum of the recorded counts */
+  std::uint64_t count{ 0 };
+
+  /** @brief The total duration of the recorded scopes in milliseconds */
+  double total_milliseconds{ 0 };
+
+  /** @brief The longest duration of a recorded scope in milliseconds */
+  double max_milliseconds{ 0 };
+
+  /** @brief Get the mean duration of the recorded scopes in milliseconds */
+  double getMeanMilliseconds() const;
+};
+
+/**
+ * @brief Process wide performance counters and tracing
+ * @details Every thread records into its own counters so recording does not contend between threads, the counters of
+ * all threads are aggregated on demand by getStatistics. The counters of a thread are folded into the totals when it
+ * exits.
+ *
+ * If tracing is enabled every recorded scope is also stored as an event which can be written in the Chrome trace
+ * event format, which is loaded by chrome://tracing and https://ui.perfetto.dev.
+ *
+ * The library is instrumented with the TESSERACT_COMMON_METRICS_SCOPE and TESSERACT_COMMON_METRICS_COUNT macros which
+ * only record when TESSERACT_ENABLE_METRICS is defined, enabled with the CMake option of the same name. The functions
+ * below are always available.
+ */
+struct Metrics
+{
+  using Clock = std::chrono::steady_clock;
+
+  /** @brief The maximum number of metrics, recordings of metrics registered after this are ignored */
+  static constexpr std::size_t MAX_METRIC_COUNT = 256;
+
+  /**
+   * @brief Get the id of a metric, registering it if it does not exist
+   * @details This takes a lock so the id should be stored, the macros store it in a static variable
+   * @param name The name of the metric
+   * @return The id of the metric
+   */
+  static std::size_t registerMetric(const std::string& name);
+
+  /**
+   * @brief Add to the count of a metric on the calling thread
+   * @param id The id of the metric
+   * @param value The value to add
+   */
+  static void addCount(std::size_t id, std::uint64_t value = 1);
+
+  /**
+   * @brief Record a scope of a metric on the calling thread
+   * @details This increments the count and adds the duration. If tracing is enabled it is also stored as an event.
+   * @param id The id of the metric
+   * @param start The start time of the scope
+   * @param end The end time of the scope
+   */
+  static void addScope(std::size_t id, Clock::time_point start, Clock::time_point end);
+
+  /**
+   * @brief Get the statistics of all registered metrics aggregated over all threads
+   * @return The statistics ordered by name
+   */
+  static std::vector<MetricStatistics> getStatistics();
+
+  /**
+   * @brief Get the statistics of a metric aggregated over all threads
+   * @param name The name of the metric
+   * @return The statistics, zero if the metric is not registered
+   */
+  static MetricStatistics getStatistics(const std::string& name);
+
+  /** @brief Reset the statistics of all metrics to zero */
+  static void reset();
+
+  /**
+   * @brief Enable or disable storing trace events
+   * @param enabled True to store an event for every recorded scope
+   * @param max_events_per_thread The maximum number of events stored per thread, further events are dropped
+   */
+  static void setTracingEnabled(bool enabled, std::size_t max_events_per_thread = 1000000);
+
+  /** @brief Check if trace events are stored */
+  static bool isTracingEnabled();
+
+  /** @brief Get the number of stored trace events */
+  static std::size_t getTraceEventCount();
+
+  /** @brief Remove all stored trace events */
+  static void clearTrace();
+
+  /**
+   * @brief Write the stored trace events in the Chrome trace event JSON format
+   * @param os The stream to write to
+   */
+  static void writeChromeTrace(std::ostream& os);
+
+  /**
+   * @brief Save the stored trace events to a file in the Chrome trace event JSON format
+   * @param file_path The file path
+   * @return True if successful, otherwise false
+   */
+  static bool saveChromeTrace(const std::string& file_path);
+};
+
+/** @brief Records the duration of its lifetime to a metric */
+class MetricsScope
+{
+public:
+  /**
+   * @brief Start recording
+   * @param id The id of the metric returned by Metrics::registerMetric
+   */
+  explicit MetricsScope(std::size_t id) : id_(id), start_(Metrics::Clock::now()) {}
+  ~MetricsScope() { Metrics::addScope(id_, start_, Metrics::Clock::now()); }
+  MetricsScope(const MetricsScope&) = delete;
+  MetricsScope& operator=(const MetricsScope&) = delete;
+  MetricsScope(MetricsScope&&) = delete;
+  MetricsScope& operator=(MetricsScope&&) = delete;
+
+private:
+  std::size_t id_;
+  Metrics::Clock::time_point start_;
+};
+}  // namespace tesseract_common
+
+#define TESSERACT_COMMON_METRICS_CONCAT_IMPL(a, b) a##b
+#define TESSERACT_COMMON_METRICS_CONCAT(a, b) TESSERACT_COMMON_METRICS_CONCAT_IMPL(a, b)
+
+#ifdef TESSERACT_ENABLE_METRICS
+/** @brief Record the duration of the enclosing scope to the metric with the provided name */
+#define TESSERACT_COMMON_METRICS_SCOPE(name)                                                                           \
+  static const std::size_t TESSERACT_COMMON_METRICS_CONCAT(tesseract_metric_id_, __LINE__) =                           \
+      tesseract_common::Metrics::registerMetric(name);                                                                 \
+  const tesseract_common::MetricsScope TESSERACT_COMMON_METRICS_CONCAT(tesseract_metric_scope_, __LINE__)(             \
+      TESSERACT_COMMON_METRICS_CONCAT(tesseract_metric_id_, __LINE__))
+
+/** @brief Add the value to the count of the metric with the provided name */
+#define TESSERACT_COMMON_METRICS_COUNT(name, value)                                                                    \
+  do                                                                                                                   \
+  {                                                                                                                    \
+    static const std::size_t tesseract_metric_id = tesseract_common::Metrics::registerMetric(name);                    \
+    tesseract_common::Metrics::addCount(tesseract_metric_id, static_cast<std::uint64_t>(value));                       \
+  } while (false)
+#else
+#define TESSERACT_COMMON_METRICS_SCOPE(name) static_cast<void>(0)
+#define TESSERACT_COMMON_METRICS_COUNT(name, value) static_cast<void>(0)
+#endif
+
+#endif  // TESSERACT_COMMON_METRICS_H
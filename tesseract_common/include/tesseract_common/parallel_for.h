@@ -0,0 +1,63 @@
+/**
+ * @file parallel_for.h
+ * @brief A parallel for loop using a pool of threads
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_COMMON_PARALLEL_FOR_H
+#define TESSERACT_COMMON_PARALLEL_FOR_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <cstddef>
+#include <functional>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+namespace tesseract_common
+{
+/**
+ * @brief Get the number of threads used to process a number of items
+ * @param num_threads The requested number of threads, zero uses the number of hardware threads
+ * @param count The number of items
+ * @return The number of threads, at least one and at most the number of items
+ */
+std::size_t getParallelThreadCount(std::size_t num_threads, std::size_t count);
+
+/**
+ * @brief Call a function for every index in [0, count) using multiple threads
+ * @details The indices are handed out one at a time so the load is balanced between the threads. The thread index
+ * passed to the function is in [0, getParallelThreadCount(num_threads, count)) and can be used to access per thread
+ * data, for example a clone of an object which is not thread safe. If a single thread is used the function is called
+ * on the calling thread.
+ *
+ * If the function throws the remaining indices are skipped and the first exception is rethrown once all threads
+ * finished.
+ * @param count The number of indices
+ * @param num_threads The requested number of threads, zero uses the number of hardware threads
+ * @param func The function called with the index and the thread index
+ */
+void parallelFor(std::size_t count,
+                 std::size_t num_threads,
+                 const std::function<void(std::size_t index, std::size_t thread_index)>& func);
+}  // namespace tesseract_common
+
+#endif  // TESSERACT_COMMON_PARALLEL_FOR_H
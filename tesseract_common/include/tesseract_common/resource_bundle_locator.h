@@ -0,0 +1,196 @@
+/**
+ * @file resource_bundle_locator.h
+ * @brief A resource locator serving resources from a memory mapped bundle file
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_COMMON_RESOURCE_BUNDLE_LOCATOR_H
+#define TESSERACT_COMMON_RESOURCE_BUNDLE_LOCATOR_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/resource_locator.h>
+#include <tesseract_common/types.h>
+
+namespace boost::interprocess
+{
+class mapped_region;
+}
+
+namespace tesseract_common
+{
+/**
+ * @brief Create a resource bundle file from package directories
+ * @details Every regular file below a package directory is stored under the url package://<package name>/<relative
+ * path>. The file is written in the byte order of the machine to a temporary path and renamed, so a reader never maps
+ * a partially written bundle.
+ * @param bundle_path The file path of the bundle
+ * @param package_paths The directory of each package by package name
+ * @return True if successful, otherwise false
+ */
+bool createResourceBundle(const fs::path& bundle_path, const std::map<std::string, fs::path>& package_paths);
+
+/**
+ * @brief A resource locator serving package:// urls from a memory mapped bundle file created by createResourceBundle
+ * @details The bundle is mapped once on construction and contains an index sorted by url, so locating a resource is a
+ * binary search without any file system access. The located resources reference the mapping directly and keep it alive.
+ * Urls not found in the bundle are passed to the fallback locator if provided.
+ */
+class ResourceBundleLocator : public ResourceLocator
+{
+public:
+  using Ptr = std::shared_ptr<ResourceBundleLocator>;
+  using ConstPtr = std::shared_ptr<const ResourceBundleLocator>;
+
+  /** @brief This is for boost serialization do not use directly */
+  ResourceBundleLocator() = default;
+
+  /**
+   * @brief Map a resource bundle
+   * @details This throws if the file can not be mapped or is not a valid bundle
+   * @param bundle_path The file path of the bundle
+   * @param fallback The locator used for urls which are not in the bundle
+   */
+  explicit ResourceBundleLocator(fs::path bundle_path, ResourceLocator::ConstPtr fallback = nullptr);
+  ~ResourceBundleLocator() override = default;
+  ResourceBundleLocator(const ResourceBundleLocator&) = default;
+  ResourceBundleLocator& operator=(const ResourceBundleLocator&) = default;
+  ResourceBundleLocator(ResourceBundleLocator&&) = default;
+  ResourceBundleLocator& operator=(ResourceBundleLocator&&) = default;
+
+  std::shared_ptr<Resource> locateResource(const std::string& url) const override;
+
+  /** @brief Get the file path of the bundle */
+  const fs::path& getBundlePath() const;
+
+  /** @brief Get the urls of all resources in the bundle */
+  std::vector<std::string> getUrls() const;
+
+  bool operator==(const ResourceBundleLocator& rhs) const;
+  bool operator!=(const ResourceBundleLocator& rhs) const;
+
+private:
+  fs::path bundle_path_;
+  ResourceLocator::ConstPtr fallback_;
+  std::shared_ptr<const boost::interprocess::mapped_region> region_;
+
+  /** @brief Map the bundle and validate its index */
+  void mapBundle();
+
+  friend class boost::serialization::access;
+  template <class Archive>
+  void save(Archive& ar, const unsigned int version) const;  // NOLINT
+
+  template <class Archive>
+  void load(Archive& ar, const unsigned int version);  // NOLINT
+
+  template <class Archive>
+  void serialize(Archive& ar, const unsigned int version);  // NOLINT
+};
+
+/** @brief Resource referencing the data of a memory mapped resource bundle */
+class ResourceBundleResource : public Resource
+{
+public:
+  using Ptr = std::shared_ptr<ResourceBundleResource>;
+  using ConstPtr = std::shared_ptr<const ResourceBundleResource>;
+
+  /** @brief This is for boost serialization do not use directly */
+  ResourceBundleResource() = default;
+
+  /**
+   * @brief A resource in a bundle
+   * @param url The url of the resource
+   * @param region The mapping of the bundle, kept alive by the resource
+   * @param data The first byte of the resource within the mapping
+   * @param size The number of bytes of the resource
+   * @param parent The locator used to locate the resource
+   */
+  ResourceBundleResource(std::string url,
+                         std::shared_ptr<const boost::interprocess::mapped_region> region,
+                         const std::uint8_t* data,
+                         std::size_t size,
+                         ResourceLocator::ConstPtr parent);
+  ~ResourceBundleResource() override = default;
+  ResourceBundleResource(const ResourceBundleResource&) = default;
+  ResourceBundleResource& operator=(const ResourceBundleResource&) = default;
+  ResourceBundleResource(ResourceBundleResource&&) = default;
+  ResourceBundleResource& operator=(ResourceBundleResource&&) = default;
+
+  bool isFile() const override final;
+  std::string getUrl() const override final;
+  std::string getFilePath() const override final;
+  std::vector<uint8_t> getResourceContents() const override final;
+
+  /** @brief The returned stream reads directly from the mapping without copying */
+  std::shared_ptr<std::istream> getResourceContentStream() const override final;
+
+  /** @brief The returned span points directly into the mapping and keeps the mapping alive */
+  ResourceSpan getResourceSpan() const override final;
+  Resource::Ptr locateResource(const std::string& url) const override final;
+
+  /**
+   * @brief Get the resource bytes without copying
+   * @details The bytes are valid for the lifetime of the resource
+   * @return A pointer to the first byte of the resource
+   */
+  const std::uint8_t* getResourceData() const;
+
+  /** @brief Get the number of bytes of the resource */
+  std::size_t getResourceSize() const;
+
+  bool operator==(const ResourceBundleResource& rhs) const;
+  bool operator!=(const ResourceBundleResource& rhs) const;
+
+private:
+  std::string url_;
+  std::shared_ptr<const boost::interprocess::mapped_region> region_;
+  const std::uint8_t* data_{ nullptr };
+  std::size_t size_{ 0 };
+  ResourceLocator::ConstPtr parent_;
+
+  friend class boost::serialization::access;
+  template <class Archive>
+  void save(Archive& ar, const unsigned int version) const;  // NOLINT
+
+  template <class Archive>
+  void load(Archive& ar, const unsigned int version);  // NOLINT
+
+  template <class Archive>
+  void serialize(Archive& ar, const unsigned int version);  // NOLINT
+};
+
+}  // namespace tesseract_common
+
+#include <boost/serialization/export.hpp>
+#include <boost/serialization/tracking.hpp>
+BOOST_CLASS_EXPORT_KEY2(tesseract_common::ResourceBundleLocator, "ResourceBundleLocator")
+BOOST_CLASS_EXPORT_KEY2(tesseract_common::ResourceBundleResource, "ResourceBundleResource")
+
+#endif  // TESSERACT_COMMON_RESOURCE_BUNDLE_LOCATOR_H
@@ -29,8 +29,11 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <boost/serialization/access.hpp>
+#include <cstdint>
 #include <functional>
 #include <memory>
+#include <string>
+#include <vector>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 namespace tesseract_common
@@ -96,6 +99,22 @@ private:
   void processToken(const std::string& token);
 };
 
+/** @brief A read only view of the contiguous bytes of a resource */
+struct ResourceSpan
+{
+  /** @brief The first byte of the resource */
+  const std::uint8_t* data{ nullptr };
+
+  /** @brief The number of bytes of the resource */
+  std::size_t size{ 0 };
+
+  /** @brief Keeps the bytes alive for the lifetime of the span */
+  std::shared_ptr<const void> owner;
+
+  /** @brief Check if the span does not contain any bytes */
+  bool empty() const { return size == 0; }
+};
+
 /**  @brief Represents resource data available from a file or url */
 class Resource : public ResourceLocator
 {
@@ -138,6 +157,14 @@ public:
    */
   virtual std::shared_ptr<std::istream> getResourceContentStream() const = 0;
 
+  /**
+   * @brief Get a read only view of the resource bytes. This function may block
+   * @details The default implementation copies the bytes returned by getResourceContents() into storage owned by the
+   * span. Resources which already hold their bytes in memory override this to avoid the copy.
+   * @return The resource bytes, valid for the lifetime of the returned span
+   */
+  virtual ResourceSpan getResourceSpan() const;
+
   bool operator==(const Resource& rhs) const;
   bool operator!=(const Resource& rhs) const;
 
@@ -231,6 +258,16 @@ private:
   void serialize(Archive& ar, const unsigned int version);  // NOLINT
 };
 
+/**
+ * @brief Get the path of a local file containing the resource, for libraries which can only load files
+ * @details If the resource is a file its file path is returned. Otherwise, for example a resource in a resource
+ * bundle, the contents are written to a file in the temporary directory named after a hash of the url and contents
+ * which keeps the extension of the url. An existing file with the same name is reused.
+ * @param resource The resource
+ * @return The file path, empty if the contents could not be written
+ */
+std::string getResourceLocalFilePath(const Resource& resource);
+
 }  // namespace tesseract_common
 
 #include <boost/serialization/export.hpp>
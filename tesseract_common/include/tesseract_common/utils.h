@@ -29,6 +29,7 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <array>
+#include <cstdint>
 #include <vector>
 #include <string>
 #include <sstream>
@@ -165,6 +166,16 @@ void printNestedException(const std::exception& e, int level = 0);
  */
 std::string getTempPath();
 
+/**
+ * @brief Compute the 64 bit FNV-1a hash of a sequence of bytes
+ * @details Unlike std::hash the result is stable across platforms and runs, so it may be used to name files
+ * @param data The first byte
+ * @param size The number of bytes
+ * @param hash The hash to continue from, used to hash multiple sequences of bytes
+ * @return The hash
+ */
+std::uint64_t hashBytes(const void* data, std::size_t size, std::uint64_t hash = 14695981039346656037ULL);
+
 /**
  * @brief Determine if a string is a number
  * @param s The string to evaluate
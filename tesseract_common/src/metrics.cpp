@@ -0,0 +1,368 @@
+/**
+ * @file metrics.cpp
+ * @brief Lightweight performance counters and tracing hooks
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <console_bridge/console.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/metrics.h>
+
+namespace tesseract_common
+{
+namespace
+{
+/** @brief The counters of a metric, only written by the owning thread but read and reset by others */
+struct Counter
+{
+  std::atomic<std::uint64_t> count{ 0 };
+  std::atomic<std::uint64_t> total_ns{ 0 };
+  std::atomic<std::uint64_t> max_ns{ 0 };
+};
+
+struct TraceEvent
+{
+  std::size_t id;
+  std::size_t thread_index;
+  Metrics::Clock::time_point start;
+  Metrics::Clock::duration duration;
+};
+
+struct ThreadData
+{
+  std::size_t thread_index{ 0 };
+  std::array<Counter, Metrics::MAX_METRIC_COUNT> counters;
+
+  std::mutex trace_mutex;
+  std::vector<TraceEvent> trace_events;
+};
+
+struct Registry
+{
+  std::mutex mutex;
+  std::vector<std::string> names;
+  std::unordered_map<std::string, std::size_t> ids;
+  std::vector<ThreadData*> threads;
+  std::size_t next_thread_index{ 0 };
+
+  /** @brief The counters of the threads which exited */
+  std::array<Counter, Metrics::MAX_METRIC_COUNT> retired_counters;
+
+  /** @brief The trace events of the threads which exited */
+  std::vector<TraceEvent> retired_trace_events;
+
+  std::atomic<bool> tracing_enabled{ false };
+  std::atomic<std::size_t> max_events_per_thread{ 0 };
+  const Metrics::Clock::time_point epoch{ Metrics::Clock::now() };
+};
+
+Registry& getRegistry()
+{
+  static Registry registry;
+  return registry;
+}
+
+void addTo(Counter& counter, std::uint64_t count, std::uint64_t total_ns, std::uint64_t max_ns)
+{
+  counter.count.fetch_add(count, std::memory_order_relaxed);
+  counter.total_ns.fetch_add(total_ns, std::memory_order_relaxed);
+  std::uint64_t current = counter.max_ns.load(std::memory_order_relaxed);
+  while (current < max_ns && !counter.max_ns.compare_exchange_weak(current, max_ns, std::memory_order_relaxed))
+    ;
+}
+
+/** @brief Registers the data of a thread on creation and folds it into the retired data on exit */
+struct ThreadDataHolder
+{
+  ThreadDataHolder()
+  {
+    Registry& registry = getRegistry();
+    std::scoped_lock lock(registry.mutex);
+    data.thread_index = registry.next_thread_index++;
+    registry.threads.push_back(&data);
+  }
+
+  ~ThreadDataHolder()
+  {
+    Registry& registry = getRegistry();
+    std::scoped_lock lock(registry.mutex, data.trace_mutex);
+    registry.threads.erase(std::find(registry.threads.begin(), registry.threads.end(), &data));
+    for (std::size_t i = 0; i < Metrics::MAX_METRIC_COUNT; ++i)
+    {
+      const Counter& counter = data.counters[i];
+      addTo(registry.retired_counters[i],
+            counter.count.load(std::memory_order_relaxed),
+            counter.total_ns.load(std::memory_order_relaxed),
+            counter.max_ns.load(std::memory_order_relaxed));
+    }
+    registry.retired_trace_events.insert(
+        registry.retired_trace_events.end(), data.trace_events.begin(), data.trace_events.end());
+  }
+  ThreadDataHolder(const ThreadDataHolder&) = delete;
+  ThreadDataHolder& operator=(const ThreadDataHolder&) = delete;
+  ThreadDataHolder(ThreadDataHolder&&) = delete;
+  ThreadDataHolder& operator=(ThreadDataHolder&&) = delete;
+
+  ThreadData data;
+};
+
+ThreadData& getThreadData()
+{
+  thread_local ThreadDataHolder holder;
+  return holder.data;
+}
+
+void resetCounter(Counter& counter)
+{
+  counter.count.store(0, std::memory_order_relaxed);
+  counter.total_ns.store(0, std::memory_order_relaxed);
+  counter.max_ns.store(0, std::memory_order_relaxed);
+}
+
+/** @brief Write a string as a JSON string */
+void writeJSONString(std::ostream& os, const std::string& str)
+{
+  os << '"';
+  for (const char c : str)
+  {
+    if (c == '"' || c == '\\')
+      os << '\\' << c;
+    else if (static_cast<unsigned char>(c) < 0x20)
+    {
+      // Formatted into a local buffer so the fill and base of the caller's stream are not changed
+      std::array<char, 7> escaped{};
+      std::snprintf(escaped.data(), escaped.size(), "\\u%04x", static_cast<unsigned>(static_cast<unsigned char>(c)));
+      os << escaped.data();
+    }
+    else
+      os << c;
+  }
+  os << '"';
+}
+}  // namespace
+
+double MetricStatistics::getMeanMilliseconds() const
+{
+  return (count == 0) ? 0 : total_milliseconds / static_cast<double>(count);
+}
+
+std::size_t Metrics::registerMetric(const std::string& name)
+{
+  Registry& registry = getRegistry();
+  std::scoped_lock lock(registry.mutex);
+  auto it = registry.ids.find(name);
+  if (it != registry.ids.end())
+    return it->second;
+
+  const std::size_t id = registry.names.size();
+  if (id == MAX_METRIC_COUNT)
+    CONSOLE_BRIDGE_logWarn("Metrics, the maximum number of metrics was reached, '%s' will not be recorded!",
+                           name.c_str());
+
+  registry.names.push_back(name);
+  registry.ids[name] = id;
+  return id;
+}
+
+void Metrics::addCount(std::size_t id, std::uint64_t value)
+{
+  if (id >= MAX_METRIC_COUNT)
+    return;
+
+  getThreadData().counters[id].count.fetch_add(value, std::memory_order_relaxed);
+}
+
+void Metrics::addScope(std::size_t id, Clock::time_point start, Clock::time_point end)
+{
+  if (id >= MAX_METRIC_COUNT)
+    return;
+
+  ThreadData& data = getThreadData();
+  const auto duration = end - start;
+  const auto duration_ns = static_cast<std::uint64_t>(
+      std::max<std::int64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count(), 0));
+  addTo(data.counters[id], 1, duration_ns, duration_ns);
+
+  Registry& registry = getRegistry();
+  if (!registry.tracing_enabled.load(std::memory_order_relaxed))
+    return;
+
+  std::scoped_lock lock(data.trace_mutex);
+  if (data.trace_events.size() < registry.max_events_per_thread.load(std::memory_order_relaxed))
+    data.trace_events.push_back(TraceEvent{ id, data.thread_index, start, duration });
+}
+
+std::vector<MetricStatistics> Metrics::getStatistics()
+{
+  Registry& registry = getRegistry();
+  std::scoped_lock lock(registry.mutex);
+
+  std::vector<MetricStatistics> statistics;
+  statistics.reserve(registry.names.size());
+  for (std::size_t id = 0; id < std::min(registry.names.size(), MAX_METRIC_COUNT); ++id)
+  {
+    std::uint64_t count = registry.retired_counters[id].count.load(std::memory_order_relaxed);
+    std::uint64_t total_ns = registry.retired_counters[id].total_ns.load(std::memory_order_relaxed);
+    std::uint64_t max_ns = registry.retired_counters[id].max_ns.load(std::memory_order_relaxed);
+    for (const ThreadData* data : registry.threads)
+    {
+      count += data->counters[id].count.load(std::memory_order_relaxed);
+      total_ns += data->counters[id].total_ns.load(std::memory_order_relaxed);
+      max_ns = std::max(max_ns, data->counters[id].max_ns.load(std::memory_order_relaxed));
+    }
+
+    MetricStatistics s;
+    s.name = registry.names[id];
+    s.count = count;
+    s.total_milliseconds = static_cast<double>(total_ns) / 1e6;
+    s.max_milliseconds = static_cast<double>(max_ns) / 1e6;
+    statistics.push_back(s);
+  }
+
+  std::sort(statistics.begin(), statistics.end(), [](const MetricStatistics& a, const MetricStatistics& b) {
+    return a.name < b.name;
+  });
+  return statistics;
+}
+
+MetricStatistics Metrics::getStatistics(const std::string& name)
+{
+  for (auto& s : getStatistics())
+  {
+    if (s.name == name)
+      return s;
+  }
+
+  MetricStatistics s;
+  s.name = name;
+  return s;
+}
+
+void Metrics::reset()
+{
+  Registry& registry = getRegistry();
+  std::scoped_lock lock(registry.mutex);
+  for (auto& counter : registry.retired_counters)
+    resetCounter(counter);
+
+  for (ThreadData* data : registry.threads)
+  {
+    for (auto& counter : data->counters)
+      resetCounter(counter);
+  }
+}
+
+void Metrics::setTracingEnabled(bool enabled, std::size_t max_events_per_thread)
+{
+  Registry& registry = getRegistry();
+  registry.max_events_per_thread = max_events_per_thread;
+  registry.tracing_enabled = enabled;
+}
+
+bool Metrics::isTracingEnabled() { return getRegistry().tracing_enabled; }
+
+std::size_t Metrics::getTraceEventCount()
+{
+  Registry& registry = getRegistry();
+  std::scoped_lock lock(registry.mutex);
+  std::size_t count = registry.retired_trace_events.size();
+  for (ThreadData* data : registry.threads)
+  {
+    std::scoped_lock trace_lock(data->trace_mutex);
+    count += data->trace_events.size();
+  }
+  return count;
+}
+
+void Metrics::clearTrace()
+{
+  Registry& registry = getRegistry();
+  std::scoped_lock lock(registry.mutex);
+  registry.retired_trace_events.clear();
+  for (ThreadData* data : registry.threads)
+  {
+    std::scoped_lock trace_lock(data->trace_mutex);
+    data->trace_events.clear();
+  }
+}
+
+void Metrics::writeChromeTrace(std::ostream& os)
+{
+  Registry& registry = getRegistry();
+  std::scoped_lock lock(registry.mutex);
+
+  // Copy the events so the recording threads are only blocked for the copy
+  std::vector<TraceEvent> events = registry.retired_trace_events;
+  for (ThreadData* data : registry.threads)
+  {
+    std::scoped_lock trace_lock(data->trace_mutex);
+    events.insert(events.end(), data->trace_events.begin(), data->trace_events.end());
+  }
+
+  std::sort(events.begin(), events.end(), [](const TraceEvent& a, const TraceEvent& b) { return a.start < b.start; });
+
+  const auto flags = os.flags();
+  const auto precision = os.precision();
+  os << std::fixed << std::setprecision(3);
+  os << "{\"traceEvents\":[";
+  for (std::size_t i = 0; i < events.size(); ++i)
+  {
+    const TraceEvent& event = events[i];
+    const double ts = std::chrono::duration<double, std::micro>(event.start - registry.epoch).count();
+    const double dur = std::chrono::duration<double, std::micro>(event.duration).count();
+
+    os << ((i == 0) ? "\n" : ",\n") << "{\"name\":";
+    writeJSONString(os, registry.names[event.id]);
+    os << ",\"cat\":\"tesseract\",\"ph\":\"X\",\"ts\":" << ts << ",\"dur\":" << dur << ",\"pid\":0,\"tid\":"
+       << event.thread_index << "}";
+  }
+  os << "\n],\"displayTimeUnit\":\"ms\"}\n";
+  os.flags(flags);
+  os.precision(precision);
+}
+
+bool Metrics::saveChromeTrace(const std::string& file_path)
+{
+  std::ofstream file(file_path);
+  if (!file)
+  {
+    CONSOLE_BRIDGE_logError("Metrics, failed to open file '%s' to save the trace!", file_path.c_str());
+    return false;
+  }
+
+  writeChromeTrace(file);
+  return static_cast<bool>(file);
+}
+
+}  // namespace tesseract_common
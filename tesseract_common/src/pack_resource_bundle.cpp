@@ -0,0 +1,105 @@
+/**
+ * @file pack_resource_bundle.cpp
+ * @brief This takes package directories and packs them into a resource bundle file
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <iostream>
+#include <console_bridge/console.h>
+#include <boost/program_options.hpp>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/resource_bundle_locator.h>
+
+namespace
+{
+const size_t ERROR_IN_COMMAND_LINE = 1;
+const size_t SUCCESS = 0;
+const size_t ERROR_UNHANDLED_EXCEPTION = 2;
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  std::vector<std::string> packages;
+  std::string output;
+
+  namespace po = boost::program_options;
+  po::options_description desc("Options");
+  desc.add_options()("help,h", "Print help messages")(
+      "package,p",
+      po::value<std::vector<std::string>>(&packages)->required(),
+      "Directory of a package to add to the bundle, the package name is the name of the directory. This may be "
+      "provided multiple times.")(
+      "output,o", po::value<std::string>(&output)->required(), "File path to save the generated resource bundle.");
+
+  po::positional_options_description positional;
+  positional.add("package", -1);
+
+  po::variables_map vm;
+  try
+  {
+    po::store(po::command_line_parser(argc, argv).options(desc).positional(positional).run(), vm);  // can throw
+
+    /** --help option */
+    if (vm.count("help") != 0U)
+    {
+      std::cout << "Basic Command Line Parameter App" << std::endl << desc << std::endl;
+      return SUCCESS;
+    }
+
+    po::notify(vm);  // throws on error, so do after help in case
+                     // there are any problems
+  }
+  catch (po::error& e)
+  {
+    std::cerr << "ERROR: " << e.what() << std::endl << std::endl;
+    std::cerr << desc << std::endl;
+    return ERROR_IN_COMMAND_LINE;
+  }
+
+  std::map<std::string, tesseract_common::fs::path> package_paths;
+  for (const auto& package : packages)
+  {
+    // Remove a trailing separator so the filename is the name of the directory
+    tesseract_common::fs::path package_path = tesseract_common::fs::path(package).lexically_normal();
+    if (package_path.filename() == ".")
+      package_path = package_path.parent_path();
+
+    const std::string package_name = package_path.filename().string();
+    if (!package_paths.emplace(package_name, package_path).second)
+    {
+      CONSOLE_BRIDGE_logError("The package '%s' was provided multiple times!", package_name.c_str());
+      return ERROR_IN_COMMAND_LINE;
+    }
+  }
+
+  if (!tesseract_common::createResourceBundle(output, package_paths))
+  {
+    CONSOLE_BRIDGE_logError("Failed to create resource bundle!");
+    return ERROR_UNHANDLED_EXCEPTION;
+  }
+
+  return 0;
+}
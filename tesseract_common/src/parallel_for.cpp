@@ -0,0 +1,96 @@
+/**
+ * @file parallel_for.cpp
+ * @brief A parallel for loop using a pool of threads
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/parallel_for.h>
+
+namespace tesseract_common
+{
+std::size_t getParallelThreadCount(std::size_t num_threads, std::size_t count)
+{
+  if (num_threads == 0)
+    num_threads = std::thread::hardware_concurrency();
+
+  return std::max<std::size_t>(std::min(num_threads, count), 1);
+}
+
+void parallelFor(std::size_t count,
+                 std::size_t num_threads,
+                 const std::function<void(std::size_t index, std::size_t thread_index)>& func)
+{
+  num_threads = getParallelThreadCount(num_threads, count);
+  if (num_threads == 1)
+  {
+    for (std::size_t i = 0; i < count; ++i)
+      func(i, 0);
+
+    return;
+  }
+
+  std::exception_ptr error;
+  std::mutex error_mutex;
+  std::atomic<std::size_t> next_index{ 0 };
+
+  auto worker = [&](std::size_t thread_index) {
+    for (std::size_t i = next_index++; i < count; i = next_index++)
+    {
+      try
+      {
+        func(i, thread_index);
+      }
+      catch (...)
+      {
+        std::scoped_lock lock(error_mutex);
+        if (!error)
+          error = std::current_exception();
+
+        // Stop the remaining work
+        next_index = count;
+      }
+    }
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(num_threads);
+  for (std::size_t t = 0; t < num_threads; ++t)
+    threads.emplace_back(worker, t);
+
+  for (auto& thread : threads)
+    thread.join();
+
+  if (error)
+    std::rethrow_exception(error);
+}
+
+}  // namespace tesseract_common
@@ -0,0 +1,536 @@
+/**
+ * @file resource_bundle_locator.cpp
+ * @brief A resource locator serving resources from a memory mapped bundle file
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string_view>
+#include <console_bridge/console.h>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <boost/iostreams/device/array.hpp>
+#include <boost/iostreams/stream.hpp>
+#include <boost/serialization/nvp.hpp>
+#include <boost/serialization/shared_ptr.hpp>
+#include <boost/serialization/split_member.hpp>
+#include <boost/serialization/string.hpp>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/resource_bundle_locator.h>
+#include <tesseract_common/utils.h>
+
+namespace tesseract_common
+{
+namespace
+{
+/*
+ * A bundle is laid out as the header, the index entries sorted by name, the names and then the data of every
+ * resource aligned to BUNDLE_DATA_ALIGNMENT. The name of a resource is its url without the package:// prefix.
+ */
+const std::array<char, 8> BUNDLE_MAGIC{ 'T', 'E', 'S', 'S', 'R', 'B', 'N', 'D' };
+const std::uint64_t BUNDLE_VERSION{ 1 };
+const std::uint64_t BUNDLE_DATA_ALIGNMENT{ 64 };
+const std::string PACKAGE_PREFIX{ "package://" };
+
+struct BundleHeader
+{
+  std::array<char, 8> magic;
+  std::uint64_t version;
+  std::uint64_t entry_count;
+  std::uint64_t names_offset;
+  std::uint64_t names_size;
+};
+
+struct BundleEntry
+{
+  std::uint64_t name_offset;  // Relative to the names offset
+  std::uint64_t name_size;
+  std::uint64_t data_offset;
+  std::uint64_t data_size;
+};
+
+/** @brief A read only view of the index of a mapped bundle */
+class BundleIndex
+{
+public:
+  explicit BundleIndex(const boost::interprocess::mapped_region& region)
+    : data_(static_cast<const char*>(region.get_address())), size_(region.get_size())
+  {
+    if (size_ >= sizeof(BundleHeader))
+      std::memcpy(&header_, data_, sizeof(BundleHeader));
+  }
+
+  std::uint64_t size() const { return header_.entry_count; }
+
+  BundleEntry getEntry(std::uint64_t i) const
+  {
+    BundleEntry entry{};
+    std::memcpy(&entry, data_ + sizeof(BundleHeader) + (i * sizeof(BundleEntry)), sizeof(BundleEntry));  // NOLINT
+    return entry;
+  }
+
+  std::string_view getName(const BundleEntry& entry) const
+  {
+    return { data_ + header_.names_offset + entry.name_offset, entry.name_size };  // NOLINT
+  }
+
+  const std::uint8_t* getData(const BundleEntry& entry) const
+  {
+    return reinterpret_cast<const std::uint8_t*>(data_ + entry.data_offset);  // NOLINT
+  }
+
+  /** @brief Find the entry with the name using a binary search */
+  bool find(BundleEntry& entry, std::string_view name) const
+  {
+    std::uint64_t first = 0;
+    std::uint64_t count = size();
+    while (count > 0)
+    {
+      const std::uint64_t step = count / 2;
+      BundleEntry mid = getEntry(first + step);
+      if (getName(mid) < name)
+      {
+        first += step + 1;
+        count -= step + 1;
+      }
+      else
+      {
+        count = step;
+      }
+    }
+
+    if (first == size())
+      return false;
+
+    entry = getEntry(first);
+    return getName(entry) == name;
+  }
+
+  /** @brief Throws if the bundle is not valid, this checks every range so later lookups do not need to */
+  void validate() const
+  {
+    if (size_ < sizeof(BundleHeader) || header_.magic != BUNDLE_MAGIC)
+      throw std::runtime_error("not a resource bundle");
+
+    if (header_.version != BUNDLE_VERSION)
+      throw std::runtime_error("unsupported resource bundle version " + std::to_string(header_.version));
+
+    const std::uint64_t max_entries = (size_ - sizeof(BundleHeader)) / sizeof(BundleEntry);
+    if (header_.entry_count > max_entries || !inRange(header_.names_offset, header_.names_size, size_))
+      throw std::runtime_error("the index is truncated");
+
+    std::string_view previous_name;
+    for (std::uint64_t i = 0; i < size(); ++i)
+    {
+      const BundleEntry entry = getEntry(i);
+      if (!inRange(entry.name_offset, entry.name_size, header_.names_size) ||
+          !inRange(entry.data_offset, entry.data_size, size_))
+        throw std::runtime_error("the index is truncated");
+
+      const std::string_view name = getName(entry);
+      if (i > 0 && !(previous_name < name))
+        throw std::runtime_error("the index is not sorted");
+
+      previous_name = name;
+    }
+  }
+
+private:
+  const char* data_;
+  std::size_t size_;
+  BundleHeader header_{};
+
+  static bool inRange(std::uint64_t offset, std::uint64_t size, std::uint64_t limit)
+  {
+    return offset <= limit && size <= limit - offset;
+  }
+};
+
+/** @brief A stream reading from a mapped bundle which keeps the mapping alive */
+class BundleStream : public boost::iostreams::stream<boost::iostreams::array_source>
+{
+public:
+  BundleStream(std::shared_ptr<const boost::interprocess::mapped_region> region, const char* data, std::size_t size)
+    : boost::iostreams::stream<boost::iostreams::array_source>(data, size), region_(std::move(region))
+  {
+  }
+
+private:
+  std::shared_ptr<const boost::interprocess::mapped_region> region_;
+};
+
+std::uint64_t alignOffset(std::uint64_t offset)
+{
+  return ((offset + BUNDLE_DATA_ALIGNMENT - 1) / BUNDLE_DATA_ALIGNMENT) * BUNDLE_DATA_ALIGNMENT;
+}
+
+template <typename T>
+void writeValue(std::ofstream& os, const T& value)
+{
+  os.write(reinterpret_cast<const char*>(&value), sizeof(T));  // NOLINT
+}
+
+void writePadding(std::ofstream& os, std::uint64_t size)
+{
+  static const std::array<char, BUNDLE_DATA_ALIGNMENT> zeros{};
+  os.write(zeros.data(), static_cast<std::streamsize>(size));
+}
+
+/** @brief Resolve a url relative to the url of a resource, the same as the other resources */
+Resource::Ptr locateRelativeResource(const ResourceLocator::ConstPtr& parent,
+                                     const std::string& resource_url,
+                                     const std::string& url)
+{
+  if (parent == nullptr || url.empty())
+    return nullptr;
+
+  tesseract_common::Resource::Ptr resource = parent->locateResource(url);
+  if (resource != nullptr)
+    return resource;
+
+  tesseract_common::fs::path path(url);
+  if (!path.is_relative())
+    return nullptr;
+
+  auto last_slash = resource_url.find_last_of('/');
+  if (last_slash == std::string::npos)
+    return nullptr;
+
+  std::string url_base_path = resource_url.substr(0, last_slash);
+  std::string new_url = url_base_path + "/" + path.filename().string();
+  return parent->locateResource(new_url);
+}
+}  // namespace
+
+bool createResourceBundle(const fs::path& bundle_path, const std::map<std::string, fs::path>& package_paths)
+{
+  struct File
+  {
+    std::string name;
+    fs::path path;
+    std::uint64_t size;
+  };
+
+  std::vector<File> files;
+  try
+  {
+    for (const auto& package : package_paths)
+    {
+      if (package.first.empty() || package.first.find('/') != std::string::npos)
+      {
+        CONSOLE_BRIDGE_logError("createResourceBundle, invalid package name '%s'!", package.first.c_str());
+        return false;
+      }
+
+      if (!fs::is_directory(package.second))
+      {
+        CONSOLE_BRIDGE_logError("createResourceBundle, package directory '%s' does not exist!",
+                                package.second.string().c_str());
+        return false;
+      }
+
+      for (fs::recursive_directory_iterator it(package.second), end; it != end; ++it)
+      {
+        if (!fs::is_regular_file(it->path()))
+          continue;
+
+        const std::string relative_path = it->path().lexically_relative(package.second).generic_string();
+        files.push_back(File{ package.first + "/" + relative_path, it->path(), fs::file_size(it->path()) });
+      }
+    }
+  }
+  catch (const fs::filesystem_error& e)
+  {
+    CONSOLE_BRIDGE_logError("createResourceBundle, %s", e.what());
+    return false;
+  }
+
+  std::sort(files.begin(), files.end(), [](const File& a, const File& b) { return a.name < b.name; });
+
+  // Compute the layout
+  BundleHeader header{ BUNDLE_MAGIC, BUNDLE_VERSION, files.size(), 0, 0 };
+  header.names_offset = sizeof(BundleHeader) + (files.size() * sizeof(BundleEntry));
+
+  std::vector<BundleEntry> entries;
+  entries.reserve(files.size());
+  for (const auto& file : files)
+  {
+    entries.push_back(BundleEntry{ header.names_size, file.name.size(), 0, file.size });
+    header.names_size += file.name.size();
+  }
+
+  std::uint64_t data_offset = header.names_offset + header.names_size;
+  for (auto& entry : entries)
+  {
+    entry.data_offset = alignOffset(data_offset);
+    data_offset = entry.data_offset + entry.data_size;
+  }
+
+  // Write to a temporary file first so a partially written bundle is never mapped
+  const fs::path tmp_path = bundle_path.string() + ".tmp";
+  {
+    std::ofstream os(tmp_path.string(), std::ios::binary | std::ios::trunc);
+    if (!os)
+    {
+      CONSOLE_BRIDGE_logError("createResourceBundle, failed to open '%s'!", tmp_path.string().c_str());
+      return false;
+    }
+
+    writeValue(os, header);
+    for (const auto& entry : entries)
+      writeValue(os, entry);
+
+    for (const auto& file : files)
+      os.write(file.name.data(), static_cast<std::streamsize>(file.name.size()));
+
+    std::uint64_t offset = header.names_offset + header.names_size;
+    for (std::size_t i = 0; i < files.size(); ++i)
+    {
+      writePadding(os, entries[i].data_offset - offset);
+
+      std::ifstream is(files[i].path.string(), std::ios::binary);
+      if (files[i].size > 0 && !(os << is.rdbuf()))
+      {
+        CONSOLE_BRIDGE_logError("createResourceBundle, failed to copy '%s'!", files[i].path.string().c_str());
+        return false;
+      }
+
+      offset = entries[i].data_offset + entries[i].data_size;
+      if (static_cast<std::uint64_t>(os.tellp()) != offset)
+      {
+        CONSOLE_BRIDGE_logError("createResourceBundle, '%s' changed while creating the bundle!",
+                                files[i].path.string().c_str());
+        return false;
+      }
+    }
+
+    if (!os.flush())
+    {
+      CONSOLE_BRIDGE_logError("createResourceBundle, failed to write '%s'!", tmp_path.string().c_str());
+      return false;
+    }
+  }
+
+  boost::system::error_code ec;
+  fs::rename(tmp_path, bundle_path, ec);
+  if (ec)
+  {
+    CONSOLE_BRIDGE_logError("createResourceBundle, failed to rename '%s' to '%s'!",
+                            tmp_path.string().c_str(),
+                            bundle_path.string().c_str());
+    return false;
+  }
+
+  return true;
+}
+
+ResourceBundleLocator::ResourceBundleLocator(fs::path bundle_path, ResourceLocator::ConstPtr fallback)
+  : bundle_path_(std::move(bundle_path)), fallback_(std::move(fallback))
+{
+  mapBundle();
+}
+
+void ResourceBundleLocator::mapBundle()
+{
+  try
+  {
+    boost::interprocess::file_mapping mapping(bundle_path_.string().c_str(), boost::interprocess::read_only);
+    auto region = std::make_shared<boost::interprocess::mapped_region>(mapping, boost::interprocess::read_only);
+    BundleIndex(*region).validate();
+    region_ = std::move(region);
+  }
+  catch (const std::exception& e)
+  {
+    throw std::runtime_error("ResourceBundleLocator, failed to load '" + bundle_path_.string() + "': " + e.what());
+  }
+}
+
+std::shared_ptr<Resource> ResourceBundleLocator::locateResource(const std::string& url) const
+{
+  if (region_ != nullptr && url.compare(0, PACKAGE_PREFIX.size(), PACKAGE_PREFIX) == 0)
+  {
+    const BundleIndex index(*region_);
+    BundleEntry entry{};
+    if (index.find(entry, std::string_view(url).substr(PACKAGE_PREFIX.size())))
+    {
+      return std::make_shared<ResourceBundleResource>(url,
+                                                      region_,
+                                                      index.getData(entry),
+                                                      static_cast<std::size_t>(entry.data_size),
+                                                      std::make_shared<ResourceBundleLocator>(*this));
+    }
+  }
+
+  if (fallback_ != nullptr)
+    return fallback_->locateResource(url);
+
+  return nullptr;
+}
+
+const fs::path& ResourceBundleLocator::getBundlePath() const { return bundle_path_; }
+
+std::vector<std::string> ResourceBundleLocator::getUrls() const
+{
+  if (region_ == nullptr)
+    return {};
+
+  const BundleIndex index(*region_);
+  std::vector<std::string> urls;
+  urls.reserve(index.size());
+  for (std::uint64_t i = 0; i < index.size(); ++i)
+    urls.push_back(PACKAGE_PREFIX + std::string(index.getName(index.getEntry(i))));
+
+  return urls;
+}
+
+bool ResourceBundleLocator::operator==(const ResourceBundleLocator& rhs) const
+{
+  bool equal = true;
+  equal &= ResourceLocator::operator==(rhs);
+  equal &= bundle_path_ == rhs.bundle_path_;
+  equal &= tesseract_common::pointersEqual(fallback_, rhs.fallback_);
+  return equal;
+}
+
+bool ResourceBundleLocator::operator!=(const ResourceBundleLocator& rhs) const { return !operator==(rhs); }
+
+template <class Archive>
+void ResourceBundleLocator::save(Archive& ar, const unsigned int /*version*/) const
+{
+  ar& BOOST_SERIALIZATION_BASE_OBJECT_NVP(ResourceLocator);
+  std::string bundle_path = bundle_path_.string();
+  ar& boost::serialization::make_nvp("bundle_path", bundle_path);
+  ar& BOOST_SERIALIZATION_NVP(fallback_);
+}
+
+template <class Archive>
+void ResourceBundleLocator::load(Archive& ar, const unsigned int /*version*/)
+{
+  ar& BOOST_SERIALIZATION_BASE_OBJECT_NVP(ResourceLocator);
+  std::string bundle_path;
+  ar& boost::serialization::make_nvp("bundle_path", bundle_path);
+  ar& BOOST_SERIALIZATION_NVP(fallback_);
+  bundle_path_ = bundle_path;
+  mapBundle();
+}
+
+template <class Archive>
+void ResourceBundleLocator::serialize(Archive& ar, const unsigned int version)
+{
+  boost::serialization::split_member(ar, *this, version);
+}
+
+ResourceBundleResource::ResourceBundleResource(std::string url,
+                                               std::shared_ptr<const boost::interprocess::mapped_region> region,
+                                               const std::uint8_t* data,
+                                               std::size_t size,
+                                               ResourceLocator::ConstPtr parent)
+  : url_(std::move(url)), region_(std::move(region)), data_(data), size_(size), parent_(std::move(parent))
+{
+}
+
+bool ResourceBundleResource::isFile() const { return false; }
+
+std::string ResourceBundleResource::getUrl() const { return url_; }
+
+std::string ResourceBundleResource::getFilePath() const { return ""; }
+
+std::vector<uint8_t> ResourceBundleResource::getResourceContents() const
+{
+  return std::vector<uint8_t>(data_, data_ + size_);  // NOLINT
+}
+
+std::shared_ptr<std::istream> ResourceBundleResource::getResourceContentStream() const
+{
+  return std::make_shared<BundleStream>(region_, reinterpret_cast<const char*>(data_), size_);  // NOLINT
+}
+
+ResourceSpan ResourceBundleResource::getResourceSpan() const { return ResourceSpan{ data_, size_, region_ }; }
+
+Resource::Ptr ResourceBundleResource::locateResource(const std::string& url) const
+{
+  return locateRelativeResource(parent_, url_, url);
+}
+
+const std::uint8_t* ResourceBundleResource::getResourceData() const { return data_; }
+
+std::size_t ResourceBundleResource::getResourceSize() const { return size_; }
+
+bool ResourceBundleResource::operator==(const ResourceBundleResource& rhs) const
+{
+  bool equal = true;
+  equal &= Resource::operator==(rhs);
+  equal &= url_ == rhs.url_;
+  equal &= size_ == rhs.size_;
+  equal &= (data_ == rhs.data_ || (size_ == rhs.size_ && std::equal(data_, data_ + size_, rhs.data_)));  // NOLINT
+  equal &= tesseract_common::pointersEqual(parent_, rhs.parent_);
+  return equal;
+}
+
+bool ResourceBundleResource::operator!=(const ResourceBundleResource& rhs) const { return !operator==(rhs); }
+
+template <class Archive>
+void ResourceBundleResource::save(Archive& ar, const unsigned int /*version*/) const
+{
+  ar& BOOST_SERIALIZATION_BASE_OBJECT_NVP(Resource);
+  ar& BOOST_SERIALIZATION_NVP(url_);
+  ar& BOOST_SERIALIZATION_NVP(parent_);
+}
+
+template <class Archive>
+void ResourceBundleResource::load(Archive& ar, const unsigned int /*version*/)
+{
+  ar& BOOST_SERIALIZATION_BASE_OBJECT_NVP(Resource);
+  ar& BOOST_SERIALIZATION_NVP(url_);
+  ar& BOOST_SERIALIZATION_NVP(parent_);
+
+  // The data is not stored, it is located again in the bundle of the parent
+  auto resource = std::dynamic_pointer_cast<ResourceBundleResource>(
+      (parent_ != nullptr) ? parent_->locateResource(url_) : nullptr);
+  if (resource == nullptr)
+    throw std::runtime_error("ResourceBundleResource, failed to locate '" + url_ + "' in the resource bundle!");
+
+  region_ = resource->region_;
+  data_ = resource->data_;
+  size_ = resource->size_;
+}
+
+template <class Archive>
+void ResourceBundleResource::serialize(Archive& ar, const unsigned int version)
+{
+  boost::serialization::split_member(ar, *this, version);
+}
+
+}  // namespace tesseract_common
+
+#include <tesseract_common/serialization.h>
+TESSERACT_SERIALIZE_SAVE_LOAD_ARCHIVES_INSTANTIATE(tesseract_common::ResourceBundleLocator)
+TESSERACT_SERIALIZE_SAVE_LOAD_ARCHIVES_INSTANTIATE(tesseract_common::ResourceBundleResource)
+BOOST_CLASS_EXPORT_IMPLEMENT(tesseract_common::ResourceBundleLocator)
+BOOST_CLASS_EXPORT_IMPLEMENT(tesseract_common::ResourceBundleResource)
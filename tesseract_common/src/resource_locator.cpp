@@ -31,6 +31,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <cassert>
 #include <iostream>
 #include <mutex>
+#include <sstream>
 #include <boost/serialization/nvp.hpp>
 #include <boost/serialization/shared_ptr.hpp>
 #include <boost/serialization/vector.hpp>
@@ -172,6 +173,12 @@ void GeneralResourceLocator::serialize(Archive& ar, const unsigned int /*version
   ar& BOOST_SERIALIZATION_BASE_OBJECT_NVP(ResourceLocator);
 }
 
+ResourceSpan Resource::getResourceSpan() const
+{
+  auto bytes = std::make_shared<const std::vector<uint8_t>>(getResourceContents());
+  return ResourceSpan{ bytes->data(), bytes->size(), bytes };
+}
+
 bool Resource::operator==(const Resource& /*rhs*/) const { return true; }
 bool Resource::operator!=(const Resource& /*rhs*/) const { return false; }
 
@@ -332,6 +339,57 @@ void BytesResource::serialize(Archive& ar, const unsigned int /*version*/)
   ar& BOOST_SERIALIZATION_NVP(parent_);
 }
 
+std::string getResourceLocalFilePath(const Resource& resource)
+{
+  if (resource.isFile())
+    return resource.getFilePath();
+
+  const std::string url = resource.getUrl();
+  const ResourceSpan data = resource.getResourceSpan();
+
+  // The url and contents are hashed so different resources never share a file
+  const std::uint64_t hash = hashBytes(data.data, data.size, hashBytes(url.data(), url.size()));
+
+  std::stringstream file_name;
+  file_name << "tesseract_resource_" << std::hex << hash << fs::path(url).extension().string();
+
+  boost::system::error_code ec;
+  const fs::path file_path = fs::temp_directory_path(ec) / file_name.str();
+  if (ec)
+  {
+    CONSOLE_BRIDGE_logError("Failed to get the temporary directory for resource '%s'!", url.c_str());
+    return "";
+  }
+
+  if (fs::exists(file_path, ec) && fs::file_size(file_path, ec) == data.size && !ec)
+    return file_path.string();
+
+  // Write to a temporary file and rename it so other processes never read a partially written file
+  fs::path tmp_path = file_path;
+  tmp_path += fs::unique_path(".%%%%-%%%%-%%%%.tmp");
+  {
+    std::ofstream os(tmp_path.string(), std::ios_base::binary);
+    os.write(reinterpret_cast<const char*>(data.data), static_cast<std::streamsize>(data.size));  // NOLINT
+    if (!os.good())
+    {
+      CONSOLE_BRIDGE_logError("Failed to write resource '%s' to file '%s'!", url.c_str(), tmp_path.string().c_str());
+      os.close();
+      fs::remove(tmp_path, ec);
+      return "";
+    }
+  }
+
+  fs::rename(tmp_path, file_path, ec);
+  if (ec)
+  {
+    CONSOLE_BRIDGE_logError("Failed to write resource '%s' to file '%s'!", url.c_str(), file_path.string().c_str());
+    fs::remove(tmp_path, ec);
+    return "";
+  }
+
+  return file_path.string();
+}
+
 }  // namespace tesseract_common
 
 #include <tesseract_common/serialization.h>
@@ -208,6 +208,17 @@ void printNestedException(const std::exception& e, int level)  // NOLINT(misc-no
 
 std::string getTempPath() { return fs::temp_directory_path().string() + std::string(1, fs::path::preferred_separator); }
 
+std::uint64_t hashBytes(const void* data, std::size_t size, std::uint64_t hash)
+{
+  const auto* bytes = static_cast<const unsigned char*>(data);
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    hash ^= bytes[i];  // NOLINT
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
 bool isNumeric(const std::string& s)
 {
   if (s.empty())
@@ -3,9 +3,11 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <gtest/gtest.h>
 #include <iostream>
 #include <fstream>
+#include <iterator>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_common/resource_locator.h>
+#include <tesseract_common/resource_bundle_locator.h>
 #include <tesseract_common/types.h>
 #include <tesseract_common/unit_test_utils.h>
 
@@ -223,6 +225,121 @@ TEST(ResourceLocatorUnit, BytesResourceSerializUnit)  // NOLINT
   tesseract_common::testSerialization<BytesResource>(resource, "BytesResource");
 }
 
+TEST(ResourceLocatorUnit, ResourceBundleLocatorUnit)  // NOLINT
+{
+  using namespace tesseract_common;
+  fs::path package_path = fs::path(getTempPath()) / "resource_bundle_unit" / "test_package";
+  fs::remove_all(package_path.parent_path());
+  fs::create_directories(package_path / "meshes");
+
+  std::vector<uint8_t> mesh_data(1000);
+  for (std::size_t i = 0; i < mesh_data.size(); ++i)
+    mesh_data[i] = static_cast<uint8_t>(i % 256);
+
+  {
+    std::ofstream((package_path / "meshes" / "mesh.stl").string(), std::ios::binary)
+        .write(reinterpret_cast<const char*>(mesh_data.data()), static_cast<std::streamsize>(mesh_data.size()));
+    std::ofstream((package_path / "robot.urdf").string()) << "<robot/>";
+    std::ofstream((package_path / "empty.txt").string());
+  }
+
+  fs::path bundle_path = package_path.parent_path() / "test.bundle";
+  EXPECT_FALSE(createResourceBundle(bundle_path, { { "test_package", package_path / "does_not_exist" } }));
+  EXPECT_FALSE(createResourceBundle(bundle_path, { { "test/package", package_path } }));
+  EXPECT_TRUE(createResourceBundle(bundle_path, { { "test_package", package_path } }));
+
+  // The fallback is used for urls which are not in the bundle
+  auto locator = std::make_shared<ResourceBundleLocator>(bundle_path, std::make_shared<TestResourceLocator>());
+  EXPECT_EQ(locator->getBundlePath(), bundle_path);
+
+  std::vector<std::string> urls{ "package://test_package/empty.txt",
+                                 "package://test_package/meshes/mesh.stl",
+                                 "package://test_package/robot.urdf" };
+  EXPECT_EQ(locator->getUrls(), urls);
+
+  Resource::Ptr resource = locator->locateResource("package://test_package/meshes/mesh.stl");
+  auto bundle_resource = std::dynamic_pointer_cast<ResourceBundleResource>(resource);
+  ASSERT_TRUE(bundle_resource != nullptr);
+  EXPECT_FALSE(bundle_resource->isFile());
+  EXPECT_EQ(bundle_resource->getUrl(), "package://test_package/meshes/mesh.stl");
+  EXPECT_TRUE(bundle_resource->getFilePath().empty());
+  EXPECT_EQ(bundle_resource->getResourceContents(), mesh_data);
+  EXPECT_EQ(bundle_resource->getResourceSize(), mesh_data.size());
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(bundle_resource->getResourceData()) % 64, 0);
+  EXPECT_TRUE(std::equal(mesh_data.begin(), mesh_data.end(), bundle_resource->getResourceData()));
+
+  std::shared_ptr<std::istream> stream = bundle_resource->getResourceContentStream();
+  ASSERT_TRUE(stream != nullptr);
+  std::vector<uint8_t> stream_data((std::istreambuf_iterator<char>(*stream)), std::istreambuf_iterator<char>());
+  EXPECT_EQ(stream_data, mesh_data);
+
+  // The span points directly into the mapping
+  ResourceSpan span = bundle_resource->getResourceSpan();
+  EXPECT_EQ(span.data, bundle_resource->getResourceData());
+  EXPECT_EQ(span.size, mesh_data.size());
+
+  // Resources which are not in memory return a copy
+  Resource::Ptr bytes_resource = std::make_shared<BytesResource>("package://test_package/mesh.stl", mesh_data);
+  ResourceSpan bytes_span = bytes_resource->getResourceSpan();
+  bytes_resource = nullptr;
+  ASSERT_EQ(bytes_span.size, mesh_data.size());
+  EXPECT_TRUE(std::equal(mesh_data.begin(), mesh_data.end(), bytes_span.data));
+
+  // Resources which are not files are written to a temporary file keeping the extension of the url
+  std::string local_path = getResourceLocalFilePath(*bundle_resource);
+  ASSERT_FALSE(local_path.empty());
+  EXPECT_EQ(fs::path(local_path).extension().string(), ".stl");
+  {
+    std::ifstream is(local_path, std::ios::binary);
+    std::vector<uint8_t> local_data((std::istreambuf_iterator<char>(is)), std::istreambuf_iterator<char>());
+    EXPECT_EQ(local_data, mesh_data);
+  }
+  EXPECT_EQ(getResourceLocalFilePath(*bundle_resource), local_path);
+  EXPECT_NE(getResourceLocalFilePath(BytesResource("package://test_package/meshes/mesh.stl", { 1, 2, 3 })),
+            local_path);
+
+  // The resource keeps the mapping alive
+  locator = nullptr;
+  EXPECT_EQ(bundle_resource->getResourceContents(), mesh_data);
+
+  // The span keeps the mapping alive
+  bundle_resource = nullptr;
+  resource = nullptr;
+  EXPECT_TRUE(std::equal(mesh_data.begin(), mesh_data.end(), span.data));
+  locator = std::make_shared<ResourceBundleLocator>(bundle_path, std::make_shared<TestResourceLocator>());
+
+  Resource::Ptr empty_resource = locator->locateResource("package://test_package/empty.txt");
+  ASSERT_TRUE(empty_resource != nullptr);
+  EXPECT_TRUE(empty_resource->getResourceContents().empty());
+
+  Resource::Ptr urdf_resource = locator->locateResource("package://test_package/robot.urdf");
+  ASSERT_TRUE(urdf_resource != nullptr);
+  Resource::Ptr sub_resource = urdf_resource->locateResource("empty.txt");
+  ASSERT_TRUE(sub_resource != nullptr);
+  EXPECT_EQ(sub_resource->getUrl(), "package://test_package/empty.txt");
+
+  Resource::Ptr fallback_resource = locator->locateResource("package://tesseract_common/package.xml");
+  ASSERT_TRUE(fallback_resource != nullptr);
+  EXPECT_TRUE(fallback_resource->isFile());
+  EXPECT_EQ(getResourceLocalFilePath(*fallback_resource), fallback_resource->getFilePath());
+
+  EXPECT_TRUE(locator->locateResource("package://test_package/does_not_exist.txt") == nullptr);
+  EXPECT_TRUE(ResourceBundleLocator(bundle_path).locateResource("package://tesseract_common/package.xml") == nullptr);
+
+  // Files which are not bundles are rejected
+  EXPECT_ANY_THROW(ResourceBundleLocator(package_path / "robot.urdf"));             // NOLINT
+  EXPECT_ANY_THROW(ResourceBundleLocator(package_path / "does_not_exist.bundle"));  // NOLINT
+
+  // The data is not serialized, the bundle is mapped again on load
+  ResourceBundleLocator serialize_locator(bundle_path);
+  tesseract_common::testSerialization<ResourceBundleLocator>(serialize_locator, "ResourceBundleLocator");
+
+  auto serialize_resource = std::dynamic_pointer_cast<ResourceBundleResource>(
+      serialize_locator.locateResource("package://test_package/meshes/mesh.stl"));
+  ASSERT_TRUE(serialize_resource != nullptr);
+  tesseract_common::testSerialization<ResourceBundleResource>(*serialize_resource, "ResourceBundleResource");
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
@@ -2,6 +2,10 @@
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <gtest/gtest.h>
 #include <type_traits>
+#include <atomic>
+#include <iomanip>
+#include <sstream>
+#include <thread>
 #include <boost/archive/xml_oarchive.hpp>
 #include <boost/archive/xml_iarchive.hpp>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
@@ -16,6 +20,8 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract_common/kinematic_limits.h>
 #include <tesseract_common/yaml_utils.h>
 #include <tesseract_common/collision_margin_data.h>
+#include <tesseract_common/metrics.h>
+#include <tesseract_common/parallel_for.h>
 
 /** @brief Resource locator implementation using a provided function to locate file resources */
 class TestResourceLocator : public tesseract_common::ResourceLocator
@@ -637,6 +643,19 @@ TEST(TesseractCommonUnit, reorder)  // NOLINT
   }
 }
 
+TEST(TesseractCommonUnit, hashBytesUnit)  // NOLINT
+{
+  // Reference values of the 64 bit FNV-1a hash
+  EXPECT_EQ(tesseract_common::hashBytes(nullptr, 0), 0xcbf29ce484222325ULL);
+  EXPECT_EQ(tesseract_common::hashBytes("a", 1), 0xaf63dc4c8601ec8cULL);
+  EXPECT_EQ(tesseract_common::hashBytes("foobar", 6), 0x85944171f73967e8ULL);
+
+  // Hashing multiple sequences of bytes is the same as hashing their concatenation
+  EXPECT_EQ(tesseract_common::hashBytes("bar", 3, tesseract_common::hashBytes("foo", 3)),
+            tesseract_common::hashBytes("foobar", 6));
+  EXPECT_NE(tesseract_common::hashBytes("foo", 3), tesseract_common::hashBytes("bar", 3));
+}
+
 TEST(TesseractCommonUnit, getTempPathUnit)  // NOLINT
 {
   std::string s1 = tesseract_common::getTempPath();
@@ -2246,6 +2265,144 @@ TEST(TesseractCommonUnit, CollisionMarginDataCompare)  // NOLINT
   }
 }
 
+TEST(TesseractCommonUnit, parallelForUnit)  // NOLINT
+{
+  EXPECT_EQ(tesseract_common::getParallelThreadCount(4, 2), 2);
+  EXPECT_EQ(tesseract_common::getParallelThreadCount(4, 0), 1);
+  EXPECT_EQ(tesseract_common::getParallelThreadCount(2, 10), 2);
+  EXPECT_GE(tesseract_common::getParallelThreadCount(0, 10), 1);
+
+  for (std::size_t num_threads : { 0UL, 1UL, 4UL })
+  {
+    // Every index is processed exactly once and the thread index is in range
+    std::vector<int> counts(1000, 0);
+    const std::size_t thread_count = tesseract_common::getParallelThreadCount(num_threads, counts.size());
+    std::atomic<bool> thread_index_valid{ true };
+    tesseract_common::parallelFor(counts.size(), num_threads, [&](std::size_t i, std::size_t thread_index) {
+      ++counts[i];
+      if (thread_index >= thread_count)
+        thread_index_valid = false;
+    });
+    EXPECT_TRUE(std::all_of(counts.begin(), counts.end(), [](int count) { return count == 1; }));
+    EXPECT_TRUE(thread_index_valid);
+
+    // The first exception is rethrown and the remaining work is skipped
+    std::atomic<std::size_t> processed{ 0 };
+    EXPECT_THROW(tesseract_common::parallelFor(counts.size(),  // NOLINT
+                                               num_threads,
+                                               [&](std::size_t i, std::size_t /*thread_index*/) {
+                                                 ++processed;
+                                                 if (i == 10)
+                                                   throw std::runtime_error("parallelForUnit");
+                                               }),
+                 std::runtime_error);
+    EXPECT_LT(processed, counts.size());
+  }
+
+  tesseract_common::parallelFor(0, 4, [](std::size_t /*i*/, std::size_t /*thread_index*/) { FAIL(); });
+}
+
+TEST(TesseractCommonUnit, metricsUnit)  // NOLINT
+{
+  using tesseract_common::Metrics;
+  using tesseract_common::MetricsScope;
+
+  const std::size_t count_id = Metrics::registerMetric("metrics_unit::count");
+  const std::size_t scope_id = Metrics::registerMetric("metrics_unit::scope");
+  EXPECT_EQ(Metrics::registerMetric("metrics_unit::count"), count_id);
+  EXPECT_NE(count_id, scope_id);
+
+  Metrics::reset();
+  Metrics::clearTrace();
+  Metrics::setTracingEnabled(true);
+  EXPECT_TRUE(Metrics::isTracingEnabled());
+
+  // Record on this thread and on threads which exit before the statistics are requested
+  Metrics::addCount(count_id, 3);
+  {
+    MetricsScope scope(scope_id);
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+  }
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i)
+  {
+    threads.emplace_back([count_id, scope_id]() {
+      for (int j = 0; j < 100; ++j)
+      {
+        MetricsScope scope(scope_id);
+        Metrics::addCount(count_id);
+      }
+    });
+  }
+
+  for (auto& thread : threads)
+    thread.join();
+
+  tesseract_common::MetricStatistics count_stats = Metrics::getStatistics("metrics_unit::count");
+  EXPECT_EQ(count_stats.count, 403);
+  EXPECT_NEAR(count_stats.total_milliseconds, 0, 1e-12);
+
+  tesseract_common::MetricStatistics scope_stats = Metrics::getStatistics("metrics_unit::scope");
+  EXPECT_EQ(scope_stats.count, 401);
+  EXPECT_GE(scope_stats.max_milliseconds, 2);
+  EXPECT_GE(scope_stats.total_milliseconds, scope_stats.max_milliseconds);
+  EXPECT_NEAR(scope_stats.getMeanMilliseconds(), scope_stats.total_milliseconds / 401, 1e-12);
+
+  std::vector<tesseract_common::MetricStatistics> stats = Metrics::getStatistics();
+  EXPECT_TRUE(std::is_sorted(stats.begin(), stats.end(), [](const auto& a, const auto& b) { return a.name < b.name; }));
+
+  EXPECT_EQ(Metrics::getStatistics("metrics_unit::unknown").count, 0);
+
+  // Only scopes are traced
+  EXPECT_EQ(Metrics::getTraceEventCount(), 401);
+  std::stringstream ss;
+  Metrics::writeChromeTrace(ss);
+  std::string trace = ss.str();
+  EXPECT_EQ(trace.find("{\"traceEvents\":["), 0);
+  EXPECT_NE(trace.find("\"name\":\"metrics_unit::scope\""), std::string::npos);
+  EXPECT_EQ(trace.find("metrics_unit::count"), std::string::npos);
+
+  Metrics::setTracingEnabled(false);
+  {
+    MetricsScope scope(scope_id);
+  }
+  EXPECT_EQ(Metrics::getTraceEventCount(), 401);
+
+  // The number of trace events per thread is limited
+  Metrics::clearTrace();
+  Metrics::setTracingEnabled(true, 2);
+  for (int i = 0; i < 5; ++i)
+  {
+    MetricsScope scope(scope_id);
+  }
+  EXPECT_EQ(Metrics::getTraceEventCount(), 2);
+  Metrics::setTracingEnabled(false);
+  Metrics::clearTrace();
+  EXPECT_EQ(Metrics::getTraceEventCount(), 0);
+
+  // Control characters are escaped without changing the formatting of the stream
+  Metrics::setTracingEnabled(true);
+  {
+    MetricsScope scope(Metrics::registerMetric("metrics_unit::\x01"
+                                               "escaped"));
+  }
+  Metrics::setTracingEnabled(false);
+  ss.str("");
+  Metrics::writeChromeTrace(ss);
+  EXPECT_NE(ss.str().find("\"name\":\"metrics_unit::\\u0001escaped\""), std::string::npos);
+  EXPECT_EQ(ss.fill(), ' ');
+  EXPECT_EQ(ss.flags(), std::stringstream().flags());
+  ss.str("");
+  ss << std::setw(3) << 7;
+  EXPECT_EQ(ss.str(), "  7");
+  Metrics::clearTrace();
+
+  Metrics::reset();
+  EXPECT_EQ(Metrics::getStatistics("metrics_unit::count").count, 0);
+  EXPECT_EQ(Metrics::getStatistics("metrics_unit::scope").count, 0);
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
@@ -120,6 +120,32 @@ public:
    */
   Environment::UPtr clone() const;
 
+  /**
+   * @brief Save a replay-free binary snapshot of the environment to a file
+   * @details Unlike serialization, which stores the command history and replays it when loaded, the snapshot also
+   * stores the resolved scene graph, kinematics information, contact managers plugin information, collision margin data
+   * and current state so it can be loaded without applying any commands. Geometry shared between links and commands is
+   * only stored once. The file uses the native binary format so it is intended for handing an environment to another
+   * process on the same host and not for long term storage.
+   * @note The snapshot is read into memory when loaded, it is not memory mapped. Geometry is copied into the loading
+   * process and contact manager collision structures are not stored, they are rebuilt when the snapshot is loaded.
+   * @param file_path The path of the snapshot file
+   * @return True if successful, otherwise false
+   */
+  bool saveSnapshot(const tesseract_common::fs::path& file_path) const;
+
+  /**
+   * @brief Initialize the environment from a replay-free binary snapshot created by saveSnapshot
+   * @details The command history and revision are restored without applying the commands, the state solver is
+   * created from the resolved scene graph and the active contact managers are created from the stored geometry. Bullet
+   * mesh hierarchies are only reused across processes if the mesh_bvh_directory contact manager option is set.
+   * @note The joint order of the state solver follows the resolved scene graph so it may differ from the environment
+   * which was saved if joints were added after it was initialized.
+   * @param file_path The path of the snapshot file
+   * @return True if successful, otherwise false
+   */
+  bool initFromSnapshot(const tesseract_common::fs::path& file_path);
+
   /**
    * @brief reset to initialized state
    * @details If the environment has not been initialized then this returns false
@@ -200,6 +226,20 @@ public:
   tesseract_kinematics::KinematicGroup::UPtr getKinematicGroup(const std::string& group_name,
                                                                std::string ik_solver_name = "") const;
 
+  /**
+   * @brief Set the inverse kinematics cache used by the kinematic groups returned by getKinematicGroup
+   * @details The cache is invalidated whenever the environment or its current state changes and kinematic groups
+   * created before a change no longer use it. A cache should only be used by a single environment.
+   * @param cache The cache, if nullptr caching is disabled
+   */
+  void setIKCache(tesseract_kinematics::IKCache::Ptr cache);
+
+  /**
+   * @brief Get the inverse kinematics cache used by the kinematic groups returned by getKinematicGroup
+   * @return The cache, nullptr if caching is disabled
+   */
+  tesseract_kinematics::IKCache::Ptr getIKCache() const;
+
   /**
    * @brief Find tool center point provided in the manipulator info
    *
@@ -650,6 +690,18 @@ protected:
       kinematic_group_cache_{};
   mutable std::shared_mutex kinematic_group_cache_mutex_;
 
+  /**
+   * @brief The inverse kinematics cache assigned to the kinematic groups
+   * @note This is intentionally not serialized and a clone gets an empty cache with the same configuration
+   */
+  tesseract_kinematics::IKCache::Ptr ik_cache_{ nullptr };
+
+  /**
+   * @brief The revision of the inverse kinematics cache
+   * @details This is incremented whenever the environment or its current state changes
+   */
+  int ik_cache_revision_{ 0 };
+
   /** @brief The environment can be accessed from multiple threads, need use mutex throughout */
   mutable std::shared_mutex mutex_;
 
@@ -716,6 +768,18 @@ private:
   bool applySetActiveDiscreteContactManagerCommand(const SetActiveDiscreteContactManagerCommand::ConstPtr& cmd);
   bool applyAddTrajectoryLinkCommand(const AddTrajectoryLinkCommand::ConstPtr& cmd);
 
+  /**
+   * @brief Add the kinematics plugin information to the kinematics factory
+   * @note This does not take a lock
+   */
+  void addKinematicsPluginInfoHelper(const tesseract_common::KinematicsPluginInfo& info);
+
+  /**
+   * @brief Add the contact managers plugin information and activate the default contact managers
+   * @note This does not take a lock
+   */
+  void addContactManagersPluginInfoHelper(const tesseract_common::ContactManagersPluginInfo& info);
+
   bool applyAddLinkCommandHelper(const tesseract_scene_graph::Link::ConstPtr& link,
                                  const tesseract_scene_graph::Joint::ConstPtr& joint,
                                  bool replace_allowed);
@@ -35,6 +35,37 @@
 
 namespace tesseract_environment
 {
+/** @brief Settings used by generateAllowedCollisionMatrix */
+struct AllowedCollisionMatrixGeneratorConfig
+{
+  /** @brief The number of random states sampled */
+  std::size_t num_samples{ 1000 };
+
+  /** @brief The number of threads used to check the sampled states, if zero hardware concurrency is used */
+  std::size_t num_threads{ 0 };
+};
+
+/**
+ * @brief Generate the allowed collision matrix of an environment by sampling random states
+ * @details This ignores the allowed collision matrix currently assigned to the environment. Every collision object is
+ * checked against every other collision object with a collision margin of zero and the pairs are disabled with the
+ * following reasons:
+ *   - Adjacent: The links are connected by a joint, skipping over links without collision geometry
+ *   - Default: The links are in collision in the current state of the environment
+ *   - Always: The links are in collision in every sampled state
+ *   - Never: The links are never in collision in the sampled states
+ *
+ * The random states are generated using StateSolver::getRandomState and are checked in parallel where each thread
+ * uses its own clone of the discrete contact manager. The result may be written to an SRDF using
+ * tesseract_srdf::writeDisabledCollisions.
+ * @param env The environment
+ * @param config The generator settings
+ * @return The generated allowed collision matrix
+ */
+tesseract_common::AllowedCollisionMatrix generateAllowedCollisionMatrix(
+    const Environment& env,
+    const AllowedCollisionMatrixGeneratorConfig& config = AllowedCollisionMatrixGeneratorConfig());
+
 /**
  * @brief Get the active Link Names Recursively
  *
@@ -184,5 +215,24 @@ bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>& contact
                      const tesseract_common::TrajArray& traj,
                      const tesseract_collision::CollisionCheckConfig& config);
 
+/**
+ * @brief Filter inverse kinematics solutions keeping only the ones which are not in collision
+ * @details The config is applied to the manager and then forward kinematics and a discrete collision check are
+ * evaluated for every solution. The contact test of a solution always stops at the first contact found, regardless of
+ * the contact test type in the config. When using more than one thread the solutions are split between the threads and
+ * each thread uses its own clone of the contact manager.
+ * @param solutions The inverse kinematics solutions, the joint values must be in the same order as the manip joints
+ * @param manager A discrete contact manager
+ * @param manip The kinematic joint group the solutions belong to
+ * @param config CollisionCheckConfig used to specify collision check settings
+ * @param num_threads The number of threads used to check the solutions, if zero hardware concurrency is used
+ * @return The solutions which are not in collision, in the same order as the input
+ */
+tesseract_kinematics::IKSolutions filterCollisionFreeSolutions(const tesseract_kinematics::IKSolutions& solutions,
+                                                               tesseract_collision::DiscreteContactManager& manager,
+                                                               const tesseract_kinematics::JointGroup& manip,
+                                                               const tesseract_collision::CollisionCheckConfig& config,
+                                                               std::size_t num_threads = 1);
+
 }  // namespace tesseract_environment
 #endif  // TESSERACT_ENVIRONMENT_CORE_UTILS_H
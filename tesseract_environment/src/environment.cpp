@@ -30,9 +30,13 @@
 #include <tesseract_srdf/utils.h>
 #include <tesseract_state_solver/ofkt/ofkt_state_solver.h>
 #include <tesseract_kinematics/core/validate.h>
+#include <tesseract_common/metrics.h>
 
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <queue>
+#include <fstream>
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
 #include <boost/serialization/nvp.hpp>
 #include <boost/serialization/shared_ptr.hpp>
 #include <boost/serialization/binary_object.hpp>
@@ -41,6 +45,15 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 namespace tesseract_environment
 {
+namespace
+{
+/**
+ * @brief The header stored at the beginning of a replay-free binary environment snapshot
+ * @details The version at the end must be incremented when the content of the snapshot changes
+ */
+const std::string ENVIRONMENT_SNAPSHOT_HEADER = "tesseract_environment_snapshot_1\n";
+}  // namespace
+
 bool Environment::initHelper(const Commands& commands)
 {
   if (commands.empty())
@@ -312,6 +325,7 @@ Commands Environment::getCommandHistory() const
 
 bool Environment::applyCommands(const Commands& commands)
 {
+  TESSERACT_COMMON_METRICS_SCOPE("Environment::applyCommands");
   bool success{ false };
   {
     std::unique_lock<std::shared_mutex> lock(mutex_);
@@ -413,7 +427,9 @@ tesseract_kinematics::KinematicGroup::UPtr Environment::getKinematicGroup(const
   {
     CONSOLE_BRIDGE_logDebug(
         "Environment, getKinematicGroup(%s, %s) cache hit!", group_name.c_str(), ik_solver_name.c_str());
-    return std::make_unique<tesseract_kinematics::KinematicGroup>(*it->second);
+    auto kg = std::make_unique<tesseract_kinematics::KinematicGroup>(*it->second);
+    kg->setIKCache(ik_cache_, ik_cache_revision_);
+    return kg;
   }
 
   CONSOLE_BRIDGE_logDebug(
@@ -435,6 +451,7 @@ tesseract_kinematics::KinematicGroup::UPtr Environment::getKinematicGroup(const
       group_name, joint_names, std::move(inv_kin), *scene_graph_, current_state_);
 
   kinematic_group_cache_[key] = std::make_unique<tesseract_kinematics::KinematicGroup>(*kg);
+  kg->setIKCache(ik_cache_, ik_cache_revision_);
 
 #ifndef NDEBUG
   if (!tesseract_kinematics::checkKinematics(*kg))
@@ -447,6 +464,20 @@ tesseract_kinematics::KinematicGroup::UPtr Environment::getKinematicGroup(const
   return kg;
 }
 
+void Environment::setIKCache(tesseract_kinematics::IKCache::Ptr cache)
+{
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  ik_cache_ = std::move(cache);
+  if (ik_cache_ != nullptr)
+    ik_cache_->setRevision(ik_cache_revision_);
+}
+
+tesseract_kinematics::IKCache::Ptr Environment::getIKCache() const
+{
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  return ik_cache_;
+}
+
 // NOLINTNEXTLINE
 Eigen::Isometry3d Environment::findTCPOffset(const tesseract_common::ManipulatorInfo& manip_info) const
 {
@@ -1065,6 +1096,11 @@ void Environment::currentStateChanged()
     joint_group_cache_.clear();
     kinematic_group_cache_.clear();
   }
+
+  // Kinematic groups created before this change stop using the inverse kinematics cache
+  ++ik_cache_revision_;
+  if (ik_cache_ != nullptr)
+    ik_cache_->setRevision(ik_cache_revision_);
 }
 
 void Environment::environmentChanged()
@@ -1147,6 +1183,7 @@ bool Environment::removeLinkHelper(const std::string& name)
 
 Environment::UPtr Environment::clone() const
 {
+  TESSERACT_COMMON_METRICS_SCOPE("Environment::clone");
   auto cloned_env = std::make_unique<Environment>();
 
   std::shared_lock<std::shared_mutex> lock(mutex_);
@@ -1190,6 +1227,9 @@ Environment::UPtr Environment::clone() const
 
   cloned_env->group_joint_names_cache_ = group_joint_names_cache_;
 
+  if (ik_cache_ != nullptr)
+    cloned_env->ik_cache_ = std::make_shared<tesseract_kinematics::IKCache>(ik_cache_->getConfig());
+
   // NOLINTNEXTLINE
   cloned_env->is_contact_allowed_fn_ = std::bind(&tesseract_scene_graph::SceneGraph::isCollisionAllowed,
                                                  cloned_env->scene_graph_,
@@ -1213,6 +1253,168 @@ Environment::UPtr Environment::clone() const
   return cloned_env;
 }
 
+bool Environment::saveSnapshot(const tesseract_common::fs::path& file_path) const
+{
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  if (!initialized_)
+  {
+    CONSOLE_BRIDGE_logError("Environment, unable to save a snapshot of an environment which is not initialized!");
+    return false;
+  }
+
+  // Write to a temporary file and rename it so other processes never read a partially written snapshot
+  tesseract_common::fs::path tmp_path = file_path;
+  tmp_path += tesseract_common::fs::unique_path(".%%%%-%%%%-%%%%.tmp");
+  try
+  {
+    {
+      std::ofstream os(tmp_path.string(), std::ios_base::binary);
+      if (!os.good())
+      {
+        CONSOLE_BRIDGE_logError("Environment, failed to open snapshot file '%s'!", tmp_path.string().c_str());
+        return false;
+      }
+
+      os.write(ENVIRONMENT_SNAPSHOT_HEADER.data(), static_cast<std::streamsize>(ENVIRONMENT_SNAPSHOT_HEADER.size()));
+
+      // Must be scoped because all data is not written until the archive goes out of scope
+      boost::archive::binary_oarchive oa(os);
+      oa << resource_locator_;
+      oa << commands_;
+      oa << revision_;
+      oa << init_revision_;
+      oa << scene_graph_;
+      oa << kinematics_information_;
+      oa << contact_managers_plugin_info_;
+      oa << collision_margin_data_;
+      oa << current_state_;
+      oa << boost::serialization::make_binary_object(&timestamp_, sizeof(timestamp_));
+      oa << boost::serialization::make_binary_object(&current_state_timestamp_, sizeof(current_state_timestamp_));
+    }
+
+    tesseract_common::fs::rename(tmp_path, file_path);
+  }
+  catch (const std::exception& e)
+  {
+    CONSOLE_BRIDGE_logError("Environment, failed to save snapshot '%s'!", file_path.string().c_str());
+    tesseract_common::printNestedException(e);
+    boost::system::error_code ec;
+    tesseract_common::fs::remove(tmp_path, ec);
+    return false;
+  }
+
+  return true;
+}
+
+bool Environment::initFromSnapshot(const tesseract_common::fs::path& file_path)
+{
+  tesseract_common::ResourceLocator::ConstPtr resource_locator;
+  Commands commands;
+  int revision{ 0 };
+  int init_revision{ 0 };
+  tesseract_scene_graph::SceneGraph::Ptr scene_graph;
+  tesseract_srdf::KinematicsInformation kinematics_information;
+  tesseract_common::ContactManagersPluginInfo contact_managers_plugin_info;
+  tesseract_collision::CollisionMarginData collision_margin_data;
+  tesseract_scene_graph::SceneState current_state;
+  std::chrono::system_clock::time_point timestamp;
+  std::chrono::system_clock::time_point current_state_timestamp;
+
+  try
+  {
+    std::ifstream is(file_path.string(), std::ios_base::binary);
+    if (!is.good())
+    {
+      CONSOLE_BRIDGE_logError("Environment, failed to open snapshot file '%s'!", file_path.string().c_str());
+      return false;
+    }
+
+    std::string header(ENVIRONMENT_SNAPSHOT_HEADER.size(), '\0');
+    is.read(header.data(), static_cast<std::streamsize>(header.size()));
+    if (!is.good() || header != ENVIRONMENT_SNAPSHOT_HEADER)
+    {
+      CONSOLE_BRIDGE_logError("Environment, '%s' is not an environment snapshot!", file_path.string().c_str());
+      return false;
+    }
+
+    // The snapshot is deserialized from the stream, geometry is copied and collision structures are rebuilt below
+    boost::archive::binary_iarchive ia(is);
+
+    ia >> resource_locator;
+    ia >> commands;
+    ia >> revision;
+    ia >> init_revision;
+    ia >> scene_graph;
+    ia >> kinematics_information;
+    ia >> contact_managers_plugin_info;
+    ia >> collision_margin_data;
+    ia >> current_state;
+    ia >> boost::serialization::make_binary_object(&timestamp, sizeof(timestamp));
+    ia >> boost::serialization::make_binary_object(&current_state_timestamp, sizeof(current_state_timestamp));
+  }
+  catch (const std::exception& e)
+  {
+    CONSOLE_BRIDGE_logError("Environment, failed to load snapshot '%s'!", file_path.string().c_str());
+    tesseract_common::printNestedException(e);
+    return false;
+  }
+
+  if (scene_graph == nullptr || commands.empty())
+  {
+    CONSOLE_BRIDGE_logError("Environment, snapshot '%s' does not contain a scene graph!", file_path.string().c_str());
+    return false;
+  }
+
+  {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    clear();
+
+    resource_locator_ = std::move(resource_locator);
+    commands_ = std::move(commands);
+    revision_ = revision;
+    init_revision_ = init_revision;
+    scene_graph_ = std::move(scene_graph);
+
+    is_contact_allowed_fn_ = [this](const std::string& l1, const std::string& l2) {
+      return scene_graph_->isCollisionAllowed(l1, l2);
+    };
+
+    state_solver_ = std::make_unique<tesseract_scene_graph::OFKTStateSolver>(*scene_graph_);
+    state_solver_->setState(current_state.joints);
+    current_state_ = state_solver_->getState();
+
+    kinematics_information_ = std::move(kinematics_information);
+    kinematics_factory_ = tesseract_kinematics::KinematicsPluginFactory();
+    addKinematicsPluginInfoHelper(kinematics_information_.kinematics_plugin_info);
+
+    collision_margin_data_ = collision_margin_data;
+
+    // The contact managers are always recreated because they may contain objects from a previous initialization
+    {
+      std::unique_lock<std::shared_mutex> discrete_lock(discrete_manager_mutex_);
+      std::unique_lock<std::shared_mutex> continuous_lock(continuous_manager_mutex_);
+      discrete_manager_ = nullptr;
+      continuous_manager_ = nullptr;
+    }
+    contact_managers_plugin_info_.clear();
+    contact_managers_factory_ = tesseract_collision::ContactManagersPluginFactory();
+    addContactManagersPluginInfoHelper(contact_managers_plugin_info);
+
+    initialized_ = true;
+    environmentChanged();
+
+    timestamp_ = timestamp;
+    current_state_timestamp_ = current_state_timestamp;
+  }
+
+  // Call the event callbacks
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  triggerEnvironmentChangedCallbacks();
+  triggerCurrentStateChangedCallbacks();
+
+  return true;
+}
+
 bool Environment::applyCommandsHelper(const Commands& commands)
 {
   bool success = true;
@@ -2031,10 +2233,18 @@ bool Environment::applyChangeJointAccelerationLimitsCommand(const ChangeJointAcc
 bool Environment::applyAddKinematicsInformationCommand(const AddKinematicsInformationCommand::ConstPtr& cmd)
 {
   kinematics_information_.insert(cmd->getKinematicsInformation());
+  addKinematicsPluginInfoHelper(cmd->getKinematicsInformation().kinematics_plugin_info);
+
+  ++revision_;
+  commands_.push_back(cmd);
+
+  return true;
+}
 
-  if (!cmd->getKinematicsInformation().kinematics_plugin_info.empty())
+void Environment::addKinematicsPluginInfoHelper(const tesseract_common::KinematicsPluginInfo& info)
+{
+  if (!info.empty())
   {
-    const auto& info = cmd->getKinematicsInformation().kinematics_plugin_info;
     for (const auto& search_path : info.search_paths)
       kinematics_factory_.addSearchPath(search_path);
 
@@ -2059,6 +2269,11 @@ bool Environment::applyAddKinematicsInformationCommand(const AddKinematicsInform
         kinematics_factory_.setDefaultInvKinPlugin(group.first, group.second.default_plugin);
     }
   }
+}
+
+bool Environment::applyAddContactManagersPluginInfoCommand(const AddContactManagersPluginInfoCommand::ConstPtr& cmd)
+{
+  addContactManagersPluginInfoHelper(cmd->getContactManagersPluginInfo());
 
   ++revision_;
   commands_.push_back(cmd);
@@ -2066,10 +2281,8 @@ bool Environment::applyAddKinematicsInformationCommand(const AddKinematicsInform
   return true;
 }
 
-bool Environment::applyAddContactManagersPluginInfoCommand(const AddContactManagersPluginInfoCommand::ConstPtr& cmd)
+void Environment::addContactManagersPluginInfoHelper(const tesseract_common::ContactManagersPluginInfo& info)
 {
-  const auto& info = cmd->getContactManagersPluginInfo();
-
   if (!info.empty())
   {
     contact_managers_plugin_info_.insert(info);
@@ -2116,11 +2329,6 @@ bool Environment::applyAddContactManagersPluginInfoCommand(const AddContactManag
   {
     CONSOLE_BRIDGE_logDebug("Environment, No continuous contact manager plugins were provided");
   }
-
-  ++revision_;
-  commands_.push_back(cmd);
-
-  return true;
 }
 
 bool Environment::applySetActiveContinuousContactManagerCommand(
@@ -24,6 +24,15 @@
  * limitations under the License.
  */
 
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <functional>
+#include <mutex>
+#include <unordered_set>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/parallel_for.h>
 #include <tesseract_collision/core/utils.h>
 #include <tesseract_environment/utils.h>
 
@@ -891,4 +900,172 @@ bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>& contact
   return checkTrajectory(contacts, manager, state_fn, joint_names, traj, config);
 }
 
+tesseract_kinematics::IKSolutions filterCollisionFreeSolutions(const tesseract_kinematics::IKSolutions& solutions,
+                                                               tesseract_collision::DiscreteContactManager& manager,
+                                                               const tesseract_kinematics::JointGroup& manip,
+                                                               const tesseract_collision::CollisionCheckConfig& config,
+                                                               std::size_t num_threads)
+{
+  manager.applyContactManagerConfig(config.contact_manager_config);
+
+  // Only whether a solution is in collision is of interest so stop at the first contact
+  tesseract_collision::ContactRequest request = config.contact_request;
+  request.type = tesseract_collision::ContactTestType::FIRST;
+
+  const std::size_t thread_count = tesseract_common::getParallelThreadCount(num_threads, solutions.size());
+
+  // The contact managers are not thread safe so every thread uses its own clone
+  std::vector<tesseract_collision::DiscreteContactManager::UPtr> managers;
+  if (thread_count > 1)
+  {
+    managers.reserve(thread_count);
+    for (std::size_t i = 0; i < thread_count; ++i)
+      managers.push_back(manager.clone());
+  }
+
+  std::vector<char> collision_free(solutions.size(), 0);
+  std::vector<tesseract_collision::ContactResultMap> contacts(thread_count);
+  tesseract_common::parallelFor(solutions.size(), num_threads, [&](std::size_t i, std::size_t thread_index) {
+    tesseract_collision::DiscreteContactManager& local_manager =
+        (managers.empty()) ? manager : *managers[thread_index];
+    tesseract_collision::ContactResultMap& local_contacts = contacts[thread_index];
+    local_contacts.clear();
+    checkTrajectoryState(local_contacts, local_manager, manip.calcFwdKin(solutions[i]), request);
+    collision_free[i] = static_cast<char>(local_contacts.empty());
+  });
+
+  tesseract_kinematics::IKSolutions filtered;
+  filtered.reserve(solutions.size());
+  for (std::size_t i = 0; i < solutions.size(); ++i)
+  {
+    if (collision_free[i] != 0)
+      filtered.push_back(solutions[i]);
+  }
+
+  return filtered;
+}
+
+tesseract_common::AllowedCollisionMatrix
+generateAllowedCollisionMatrix(const Environment& env, const AllowedCollisionMatrixGeneratorConfig& config)
+{
+  tesseract_common::AllowedCollisionMatrix acm;
+
+  tesseract_scene_graph::SceneGraph::ConstPtr scene_graph = env.getSceneGraph();
+  tesseract_scene_graph::StateSolver::UPtr state_solver = env.getStateSolver();
+  tesseract_collision::DiscreteContactManager::UPtr manager = env.getDiscreteContactManager();
+  if (scene_graph == nullptr || state_solver == nullptr || manager == nullptr)
+    throw std::runtime_error("generateAllowedCollisionMatrix, the environment is not initialized!");
+
+  const std::vector<std::string> collision_objects = manager->getCollisionObjects();
+  const std::unordered_set<std::string> collision_objects_set(collision_objects.begin(), collision_objects.end());
+
+  // Adjacent links, links without collision geometry are skipped when searching for the parent
+  for (const auto& link_name : collision_objects)
+  {
+    std::unordered_set<std::string> visited{ link_name };
+    std::vector<std::string> stack{ link_name };
+    while (!stack.empty())
+    {
+      const std::string current = stack.back();
+      stack.pop_back();
+      for (const auto& joint : scene_graph->getInboundJoints(current))
+      {
+        if (!visited.insert(joint->parent_link_name).second)
+          continue;
+
+        if (collision_objects_set.find(joint->parent_link_name) != collision_objects_set.end())
+          acm.addAllowedCollision(link_name, joint->parent_link_name, "Adjacent");
+        else
+          stack.push_back(joint->parent_link_name);
+      }
+    }
+  }
+
+  // Every object is made active so pairs of static objects are checked too
+  manager->setActiveCollisionObjects(collision_objects);
+  manager->setCollisionMarginData(tesseract_collision::CollisionMarginData(0.0));
+
+  tesseract_collision::ContactRequest request(tesseract_collision::ContactTestType::ALL);
+  request.calculate_penetration = false;
+  request.calculate_distance = false;
+  request.result_fields = tesseract_collision::ContactResultFields::NONE;
+
+  // Links in collision in the current state of the environment
+  {
+    auto default_acm = std::make_shared<const tesseract_common::AllowedCollisionMatrix>(acm);
+    manager->setIsContactAllowedFn([default_acm](const std::string& link_name1, const std::string& link_name2) {
+      return default_acm->isCollisionAllowed(link_name1, link_name2);
+    });
+
+    tesseract_collision::ContactResultMap contacts;
+    manager->setCollisionObjectsTransform(env.getState().link_transforms);
+    manager->contactTest(contacts, request);
+    for (const auto& contact : contacts)
+      acm.addAllowedCollision(contact.first.first, contact.first.second, "Default");
+  }
+
+  // Count the number of sampled states in which each pair is in collision
+  auto sampled_acm = std::make_shared<const tesseract_common::AllowedCollisionMatrix>(acm);
+  manager->setIsContactAllowedFn([sampled_acm](const std::string& link_name1, const std::string& link_name2) {
+    return sampled_acm->isCollisionAllowed(link_name1, link_name2);
+  });
+
+  using CollisionCounts = std::unordered_map<tesseract_common::LinkNamesPair, std::size_t, tesseract_common::PairHash>;
+  if (config.num_samples == 0)
+    return acm;
+
+  // Every thread uses its own contact manager clone and counts, the counts are merged once all samples are processed
+  const std::size_t num_threads = tesseract_common::getParallelThreadCount(config.num_threads, config.num_samples);
+  std::vector<tesseract_collision::DiscreteContactManager::UPtr> managers;
+  managers.reserve(num_threads);
+  for (std::size_t i = 0; i < num_threads; ++i)
+    managers.push_back(manager->clone());
+
+  std::vector<CollisionCounts> thread_counts(num_threads);
+  std::vector<tesseract_collision::ContactResultMap> thread_contacts(num_threads);
+
+  // The random number generator used by the state solver is shared so sampling is serialized
+  std::mutex sample_mutex;
+  tesseract_common::parallelFor(config.num_samples, num_threads, [&](std::size_t /*i*/, std::size_t thread_index) {
+    tesseract_scene_graph::SceneState state;
+    {
+      std::scoped_lock lock(sample_mutex);
+      state = state_solver->getRandomState();
+    }
+
+    tesseract_collision::ContactResultMap& contacts = thread_contacts[thread_index];
+    contacts.clear();
+    managers[thread_index]->setCollisionObjectsTransform(state.link_transforms);
+    managers[thread_index]->contactTest(contacts, request);
+    for (const auto& contact : contacts)
+      ++thread_counts[thread_index][tesseract_common::makeOrderedLinkPair(contact.first.first, contact.first.second)];
+  });
+
+  CollisionCounts collision_counts;
+  for (const auto& local_counts : thread_counts)
+  {
+    for (const auto& count : local_counts)
+      collision_counts[count.first] += count.second;
+  }
+
+  for (std::size_t i = 0; i < collision_objects.size(); ++i)
+  {
+    for (std::size_t j = i + 1; j < collision_objects.size(); ++j)
+    {
+      const std::string& link_name1 = collision_objects[i];
+      const std::string& link_name2 = collision_objects[j];
+      if (sampled_acm->isCollisionAllowed(link_name1, link_name2))
+        continue;
+
+      auto it = collision_counts.find(tesseract_common::makeOrderedLinkPair(link_name1, link_name2));
+      if (it == collision_counts.end())
+        acm.addAllowedCollision(link_name1, link_name2, "Never");
+      else if (it->second == config.num_samples)
+        acm.addAllowedCollision(link_name1, link_name2, "Always");
+    }
+  }
+
+  return acm;
+}
+
 }  // namespace tesseract_environment
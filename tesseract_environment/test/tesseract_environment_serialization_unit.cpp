@@ -35,6 +35,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract_common/utils.h>
 #include <tesseract_environment/commands.h>
 #include <tesseract_environment/environment.h>
+#include <tesseract_geometry/impl/box.h>
 #include <tesseract_urdf/urdf_parser.h>
 #include <tesseract_srdf/srdf_model.h>
 #include <tesseract_support/tesseract_support_resource_locator.h>
@@ -78,6 +79,65 @@ TEST(EnvironmentSerializeUnit, Environment)  // NOLINT
   testSerializationPtr<Environment>(env, "Environment");
 }
 
+TEST(EnvironmentSerializeUnit, EnvironmentSnapshot)  // NOLINT
+{
+  Environment::Ptr env = getEnvironment();
+  int init_revision = env->getRevision();
+
+  // Add a link sharing its geometry between the visual and collision and change the state
+  auto box = std::make_shared<tesseract_geometry::Box>(0.1, 0.2, 0.3);
+  Link link("snapshot_link");
+  link.visual.push_back(std::make_shared<Visual>());
+  link.visual.back()->geometry = box;
+  link.collision.push_back(std::make_shared<Collision>());
+  link.collision.back()->geometry = box;
+  EXPECT_TRUE(env->applyCommand(std::make_shared<AddLinkCommand>(link)));
+
+  std::vector<std::string> joint_names = env->getActiveJointNames();
+  env->setState(joint_names, Eigen::VectorXd::Constant(static_cast<Eigen::Index>(joint_names.size()), 0.25));
+
+  const std::string file_path = tesseract_common::getTempPath() + "environment_snapshot.bin";
+  EXPECT_TRUE(env->saveSnapshot(file_path));
+
+  auto loaded = std::make_shared<Environment>();
+  EXPECT_TRUE(loaded->initFromSnapshot(file_path));
+  EXPECT_TRUE(loaded->isInitialized());
+  EXPECT_TRUE(*env == *loaded);
+  EXPECT_EQ(loaded->getRevision(), env->getRevision());
+  EXPECT_EQ(loaded->getKinematicsInformation(), env->getKinematicsInformation());
+  EXPECT_EQ(loaded->getContactManagersPluginInfo(), env->getContactManagersPluginInfo());
+  EXPECT_EQ(loaded->getCollisionMarginData(), env->getCollisionMarginData());
+  EXPECT_EQ(loaded->getResourceLocator() != nullptr, env->getResourceLocator() != nullptr);
+  EXPECT_TRUE(loaded->getCurrentJointValues(joint_names).isApprox(env->getCurrentJointValues(joint_names)));
+  EXPECT_TRUE(loaded->getLinkTransform("snapshot_link").isApprox(env->getLinkTransform("snapshot_link")));
+  EXPECT_TRUE(loaded->getGroupJointNames("manipulator") == env->getGroupJointNames("manipulator"));
+
+  // Geometry shared in the saved environment is shared in the loaded environment
+  auto loaded_link = loaded->getLink("snapshot_link");
+  ASSERT_TRUE(loaded_link != nullptr);
+  EXPECT_EQ(loaded_link->visual.front()->geometry, loaded_link->collision.front()->geometry);
+
+  // The command history is restored so the loaded environment can be reset
+  EXPECT_TRUE(loaded->reset());
+  EXPECT_EQ(loaded->getRevision(), init_revision);
+  EXPECT_TRUE(loaded->getLink("snapshot_link") == nullptr);
+
+  // Loading a snapshot replaces the content of an initialized environment
+  EXPECT_TRUE(loaded->initFromSnapshot(file_path));
+  EXPECT_TRUE(*env == *loaded);
+
+  // An environment which is not initialized can not be saved
+  EXPECT_FALSE(Environment().saveSnapshot(tesseract_common::getTempPath() + "environment_snapshot_empty.bin"));
+
+  // Files which do not exist or are not snapshots fail to load
+  Environment failed;
+  EXPECT_FALSE(failed.initFromSnapshot(tesseract_common::getTempPath() + "environment_snapshot_missing.bin"));
+  const std::string archive_path = tesseract_common::getTempPath() + "environment_snapshot_archive.bin";
+  EXPECT_TRUE(Serialization::toArchiveFileBinary<Environment>(*env, archive_path));
+  EXPECT_FALSE(failed.initFromSnapshot(archive_path));
+  EXPECT_FALSE(failed.isInitialized());
+}
+
 TEST(EnvironmentCommandsSerializeUnit, ModifyAllowedCollisionsCommand)  // NOLINT
 {
   {  // ADD
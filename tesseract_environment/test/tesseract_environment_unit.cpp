@@ -2683,6 +2683,76 @@ TEST(TesseractEnvironmentUnit, EnvFindTCPUnit)  // NOLINT
   }
 }
 
+TEST(TesseractEnvironmentUnit, EnvIKCacheUnit)  // NOLINT
+{
+  // Get the environment
+  auto env = getEnvironment();
+  EXPECT_TRUE(env->getIKCache() == nullptr);
+
+  // Kinematic groups created before the cache is assigned do not use it
+  auto kg_no_cache = env->getKinematicGroup("manipulator");
+  EXPECT_TRUE(kg_no_cache->getIKCache() == nullptr);
+
+  auto cache = std::make_shared<tesseract_kinematics::IKCache>();
+  env->setIKCache(cache);
+  EXPECT_TRUE(env->getIKCache() == cache);
+
+  auto kg = env->getKinematicGroup("manipulator");
+  EXPECT_TRUE(kg->getIKCache() == cache);
+
+  Eigen::VectorXd joint_values(7);
+  joint_values << 0.1, 0.2, 0.3, -0.4, 0.5, 0.6, 0.7;
+  Eigen::VectorXd seed = joint_values + Eigen::VectorXd::Constant(7, 0.01);
+  tesseract_kinematics::KinGroupIKInput input(kg->calcFwdKin(joint_values).at("tool0"), "base_link", "tool0");
+
+  tesseract_kinematics::IKSolutions solutions = kg->calcInvKin(input, seed);
+  EXPECT_EQ(cache->getMissCount(), 1);
+  EXPECT_EQ(cache->getHitCount(), 0);
+  EXPECT_EQ(cache->size(), 1);
+
+  // Other kinematic groups of the environment share the cache
+  auto kg2 = env->getKinematicGroup("manipulator");
+  tesseract_kinematics::IKSolutions cached_solutions = kg2->calcInvKin(input, seed);
+  EXPECT_EQ(cache->getMissCount(), 1);
+  EXPECT_EQ(cache->getHitCount(), 1);
+  ASSERT_EQ(cached_solutions.size(), solutions.size());
+  for (std::size_t i = 0; i < solutions.size(); ++i)
+    EXPECT_TRUE(cached_solutions[i].isApprox(solutions[i], 1e-8));
+
+  // Changing the current state clears the cache and the existing kinematic groups stop using it
+  int revision = cache->getRevision();
+  env->setState(kg->getJointNames(), joint_values);
+  EXPECT_NE(cache->getRevision(), revision);
+  EXPECT_EQ(cache->size(), 0);
+
+  cached_solutions = kg->calcInvKin(input, seed);
+  EXPECT_EQ(cache->size(), 0);
+  ASSERT_EQ(cached_solutions.size(), solutions.size());
+
+  auto kg3 = env->getKinematicGroup("manipulator");
+  EXPECT_TRUE(kg3->getIKCache() == cache);
+  kg3->calcInvKin(input, seed);
+  EXPECT_GE(cache->size(), 1);
+
+  // Changing the environment clears the cache
+  revision = cache->getRevision();
+  auto cmd = std::make_shared<ChangeJointVelocityLimitsCommand>("joint_a1", 2.0);
+  EXPECT_TRUE(env->applyCommand(cmd));
+  EXPECT_NE(cache->getRevision(), revision);
+  EXPECT_EQ(cache->size(), 0);
+
+  // A clone gets its own cache with the same configuration
+  auto cloned_env = env->clone();
+  EXPECT_TRUE(cloned_env->getIKCache() != nullptr);
+  EXPECT_TRUE(cloned_env->getIKCache() != cache);
+  EXPECT_EQ(cloned_env->getIKCache()->getConfig().capacity, cache->getConfig().capacity);
+
+  // Disable caching
+  env->setIKCache(nullptr);
+  EXPECT_TRUE(env->getIKCache() == nullptr);
+  EXPECT_TRUE(env->getKinematicGroup("manipulator")->getIKCache() == nullptr);
+}
+
 TEST(TesseractEnvironmentUnit, getActiveLinkNamesRecursiveUnit)  // NOLINT
 {
   // Get the environment
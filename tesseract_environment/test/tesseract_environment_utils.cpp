@@ -10,6 +10,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_environment/environment.h>
 #include <tesseract_environment/utils.h>
+#include <tesseract_geometry/impl/box.h>
 #include <tesseract_support/tesseract_support_resource_locator.h>
 
 using namespace tesseract_scene_graph;
@@ -349,6 +350,136 @@ TEST(TesseractEnvironmentUtils, checkTrajectoryState)  // NOLINT
   }
 }
 
+TEST(TesseractEnvironmentUtils, generateAllowedCollisionMatrix)  // NOLINT
+{
+  auto scene_graph = getSceneGraph();
+  EXPECT_TRUE(scene_graph != nullptr);
+
+  auto srdf = getSRDFModel(*scene_graph);
+  EXPECT_TRUE(srdf != nullptr);
+
+  auto env = std::make_shared<Environment>();
+  bool success = env->init(*scene_graph, srdf);
+  EXPECT_TRUE(success);
+
+  // Both boxes are at the origin in the default state
+  AllowedCollisionMatrixGeneratorConfig config;
+  config.num_samples = 100;
+  config.num_threads = 4;
+  tesseract_common::AllowedCollisionMatrix acm = generateAllowedCollisionMatrix(*env, config);
+  EXPECT_EQ(acm.getAllAllowedCollisions().size(), 1);
+  EXPECT_EQ(acm.getAllAllowedCollisions().at(tesseract_common::makeOrderedLinkPair("boxbot_link", "test_box_link")),
+            "Default");
+
+  // Move the boxbot away so the boxes are no longer in collision in the current state
+  env->setState({ { "boxbot_x_joint", 5 }, { "boxbot_y_joint", 5 } });
+
+  // Attach a link to the boxbot and a link far above the static box
+  Link link("attached_link");
+  Collision::Ptr collision = std::make_shared<Collision>();
+  collision->origin.translation() = Eigen::Vector3d(0, 0, 0.5);
+  collision->geometry = std::make_shared<tesseract_geometry::Box>(0.5, 0.5, 0.5);
+  link.collision.push_back(collision);
+
+  Joint joint("attached_joint");
+  joint.parent_link_name = "no_geom_link";
+  joint.child_link_name = "attached_link";
+  joint.type = JointType::FIXED;
+  EXPECT_TRUE(env->applyCommand(std::make_shared<AddLinkCommand>(link, joint)));
+
+  Link far_link("far_link");
+  Collision::Ptr far_collision = std::make_shared<Collision>();
+  far_collision->origin.translation() = Eigen::Vector3d(0, 0, 10);
+  far_collision->geometry = std::make_shared<tesseract_geometry::Box>(0.5, 0.5, 0.5);
+  far_link.collision.push_back(far_collision);
+
+  Joint far_joint("far_joint");
+  far_joint.parent_link_name = "test_box_link";
+  far_joint.child_link_name = "far_link";
+  far_joint.type = JointType::FIXED;
+  EXPECT_TRUE(env->applyCommand(std::make_shared<AddLinkCommand>(far_link, far_joint)));
+
+  acm = generateAllowedCollisionMatrix(*env, config);
+  const auto& entries = acm.getAllAllowedCollisions();
+  EXPECT_EQ(entries.at(tesseract_common::makeOrderedLinkPair("boxbot_link", "attached_link")), "Adjacent");
+  EXPECT_EQ(entries.at(tesseract_common::makeOrderedLinkPair("test_box_link", "far_link")), "Adjacent");
+  EXPECT_EQ(entries.at(tesseract_common::makeOrderedLinkPair("boxbot_link", "far_link")), "Never");
+  EXPECT_EQ(entries.at(tesseract_common::makeOrderedLinkPair("attached_link", "far_link")), "Never");
+
+  // The boxes only collide in a small portion of the joint space so they may or may not be sampled in collision
+  auto it = entries.find(tesseract_common::makeOrderedLinkPair("boxbot_link", "test_box_link"));
+  EXPECT_TRUE(it == entries.end() || it->second == "Never");
+
+  // Without samples only the adjacent and default entries are generated
+  config.num_samples = 0;
+  acm = generateAllowedCollisionMatrix(*env, config);
+  EXPECT_EQ(acm.getAllAllowedCollisions().size(), 2);
+}
+
+TEST(TesseractEnvironmentUtils, filterCollisionFreeSolutions)  // NOLINT
+{
+  auto scene_graph = getSceneGraph();
+  EXPECT_TRUE(scene_graph != nullptr);
+
+  auto srdf = getSRDFModel(*scene_graph);
+  EXPECT_TRUE(srdf != nullptr);
+
+  auto env = std::make_shared<Environment>();
+  bool success = env->init(*scene_graph, srdf);
+  EXPECT_TRUE(success);
+
+  tesseract_kinematics::JointGroup::UPtr manip = env->getJointGroup("manipulator");
+  EXPECT_TRUE(manip != nullptr);
+
+  CollisionCheckConfig config;
+  config.type = tesseract_collision::CollisionEvaluatorType::DISCRETE;
+  config.contact_request.type = tesseract_collision::ContactTestType::ALL;
+  config.contact_manager_config.margin_data = tesseract_collision::CollisionMarginData(0.0);
+  config.contact_manager_config.margin_data_override_type = tesseract_common::CollisionMarginOverrideType::REPLACE;
+
+  // The boxes are in collision when the boxbot is less than a meter away from the origin along both axes
+  tesseract_kinematics::IKSolutions solutions;
+  tesseract_kinematics::IKSolutions expected;
+  for (int i = 0; i < 20; ++i)
+  {
+    Eigen::VectorXd solution(2);
+    solution << -2.0 + (0.25 * i), 0.5 * (i % 3);
+    solutions.push_back(solution);
+    if (std::abs(solution(0)) >= 1.0 || std::abs(solution(1)) >= 1.0)
+      expected.push_back(solution);
+  }
+  EXPECT_FALSE(expected.empty());
+  EXPECT_LT(expected.size(), solutions.size());
+
+  for (std::size_t num_threads : std::vector<std::size_t>{ 0, 1, 4, 100 })
+  {
+    DiscreteContactManager::UPtr manager = env->getDiscreteContactManager();
+    tesseract_kinematics::IKSolutions filtered =
+        filterCollisionFreeSolutions(solutions, *manager, *manip, config, num_threads);
+    ASSERT_EQ(filtered.size(), expected.size());
+    for (std::size_t i = 0; i < expected.size(); ++i)
+      EXPECT_TRUE(filtered[i].isApprox(expected[i]));
+  }
+
+  // The config is applied to the manager so a larger margin removes the solutions close to the static box
+  {
+    auto margin_config = config;
+    margin_config.contact_manager_config.margin_data = tesseract_collision::CollisionMarginData(0.3);
+    DiscreteContactManager::UPtr manager = env->getDiscreteContactManager();
+    tesseract_kinematics::IKSolutions filtered =
+        filterCollisionFreeSolutions(solutions, *manager, *manip, margin_config, 2);
+    EXPECT_LT(filtered.size(), expected.size());
+    for (const auto& solution : filtered)
+      EXPECT_TRUE(std::abs(solution(0)) >= 1.3 || std::abs(solution(1)) >= 1.3);
+  }
+
+  // No solutions
+  {
+    DiscreteContactManager::UPtr manager = env->getDiscreteContactManager();
+    EXPECT_TRUE(filterCollisionFreeSolutions({}, *manager, *manip, config, 4).empty());
+  }
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
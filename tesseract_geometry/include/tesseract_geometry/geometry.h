@@ -50,11 +50,13 @@ enum GeometryType
   CONVEX_MESH,
   SDF_MESH,
   OCTREE,
-  POLYGON_MESH
+  POLYGON_MESH,
+  COMPACT_MESH
 };
 static const std::vector<std::string> GeometryTypeStrings = { "UNINITIALIZED", "SPHERE",   "CYLINDER", "CAPSULE",
                                                               "CONE",          "BOX",      "PLANE",    "MESH",
-                                                              "CONVEX_MESH",   "SDF_MESH", "OCTREE",   "POLYGON_MESH" };
+                                                              "CONVEX_MESH",   "SDF_MESH", "OCTREE",   "POLYGON_MESH",
+                                                              "COMPACT_MESH" };
 
 class Geometry
 {
@@ -0,0 +1,162 @@
+/**
+ * @file compact_mesh.h
+ * @brief Tesseract Compact Mesh Geometry
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_GEOMETRY_COMPACT_MESH_H
+#define TESSERACT_GEOMETRY_COMPACT_MESH_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <boost/serialization/access.hpp>
+#include <boost/serialization/export.hpp>
+#include <Eigen/Geometry>
+#include <cstdint>
+#include <memory>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/resource_locator.h>
+#include <tesseract_geometry/geometry.h>
+#include <tesseract_geometry/impl/mesh.h>
+#include <tesseract_geometry/impl/polygon_mesh.h>
+
+namespace tesseract_geometry
+{
+/**
+ * @brief A triangle mesh stored in single precision with a plain triangle index array
+ * @details This is intended for very large static meshes, for example scanned environments. The vertices and
+ * triangles are stored in flat buffers which are shared between clones and can be referenced directly by the
+ * collision backends without being copied.
+ */
+class CompactMesh : public Geometry
+{
+public:
+  // LCOV_EXCL_START
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+  // LCOV_EXCL_STOP
+
+  using Ptr = std::shared_ptr<CompactMesh>;
+  using ConstPtr = std::shared_ptr<const CompactMesh>;
+
+  /**
+   * @brief Compact mesh geometry
+   * @param vertices The vertices stored as x, y, z for every vertex
+   * @param triangles The vertex indices stored as three indices for every triangle
+   * @param resource A resource locator for locating resource
+   * @param scale The scale applied to the mesh, the vertices are expected to already be scaled
+   */
+  CompactMesh(std::shared_ptr<const std::vector<float>> vertices,
+              std::shared_ptr<const std::vector<std::uint32_t>> triangles,
+              tesseract_common::Resource::ConstPtr resource = nullptr,
+              const Eigen::Vector3d& scale = Eigen::Vector3d(1, 1, 1));
+
+  /**
+   * @brief Create a compact mesh from a polygon mesh
+   * @details Faces with more than three vertices are triangulated as a fan.
+   * @param mesh The polygon mesh to convert
+   */
+  explicit CompactMesh(const PolygonMesh& mesh);
+
+  CompactMesh() = default;
+  ~CompactMesh() override = default;
+
+  /**
+   * @brief Get the vertices
+   * @return The vertices stored as x, y, z for every vertex
+   */
+  const std::shared_ptr<const std::vector<float>>& getVertices() const { return vertices_; }
+
+  /**
+   * @brief Get the triangles
+   * @return The vertex indices stored as three indices for every triangle
+   */
+  const std::shared_ptr<const std::vector<std::uint32_t>>& getTriangles() const { return triangles_; }
+
+  /**
+   * @brief Get vertex count
+   * @return Number of vertices
+   */
+  int getVertexCount() const { return static_cast<int>(vertices_->size() / 3); }
+
+  /**
+   * @brief Get triangle count
+   * @return Number of triangles
+   */
+  int getTriangleCount() const { return static_cast<int>(triangles_->size() / 3); }
+
+  /**
+   * @brief Get a vertex in double precision
+   * @param index The index of the vertex
+   * @return The vertex
+   */
+  Eigen::Vector3d getVertex(std::size_t index) const
+  {
+    const float* v = &(*vertices_)[3 * index];
+    return { static_cast<double>(v[0]), static_cast<double>(v[1]), static_cast<double>(v[2]) };
+  }
+
+  /**
+   * @brief Get the path to file used to generate the mesh
+   *
+   * Note: If empty, assume it was manually generated.
+   *
+   * @return Absolute path to the mesh file
+   */
+  tesseract_common::Resource::ConstPtr getResource() const { return resource_; }
+
+  /**
+   * @brief Get the scale applied to file used to generate the mesh
+   * @return The scale x, y, z
+   */
+  const Eigen::Vector3d& getScale() const { return scale_; }
+
+  /**
+   * @brief Create a double precision mesh
+   * @details This is used by consumers which do not support compact meshes and copies the vertices and triangles.
+   * @return The mesh
+   */
+  Mesh::Ptr toMesh() const;
+
+  Geometry::Ptr clone() const override
+  {
+    return std::make_shared<CompactMesh>(vertices_, triangles_, resource_, scale_);
+  }
+
+  bool operator==(const CompactMesh& rhs) const;
+  bool operator!=(const CompactMesh& rhs) const;
+
+private:
+  std::shared_ptr<const std::vector<float>> vertices_;
+  std::shared_ptr<const std::vector<std::uint32_t>> triangles_;
+  tesseract_common::Resource::ConstPtr resource_;
+  Eigen::Vector3d scale_{ 1, 1, 1 };
+
+  friend class boost::serialization::access;
+  template <class Archive>
+  void serialize(Archive& ar, const unsigned int version);  // NOLINT
+};
+}  // namespace tesseract_geometry
+
+BOOST_CLASS_EXPORT_KEY2(tesseract_geometry::CompactMesh, "CompactMesh")
+#endif  // TESSERACT_GEOMETRY_COMPACT_MESH_H
@@ -445,7 +445,8 @@ std::vector<std::shared_ptr<T>> createMeshFromResource(tesseract_common::Resourc
     }
   }
 
-  std::vector<uint8_t> data = resource->getResourceContents();
+  // Resources which are already in memory, like bundled resources, are read without copying
+  const tesseract_common::ResourceSpan data = resource->getResourceSpan();
   if (data.empty())
   {
     if (resource->isFile())
@@ -480,15 +481,15 @@ std::vector<std::shared_ptr<T>> createMeshFromResource(tesseract_common::Resourc
   // And have it read the given file with some post-processing
   const aiScene* scene = nullptr;
   if (triangulate)
-    scene = importer.ReadFileFromMemory(data.data(),
-                                        data.size(),
+    scene = importer.ReadFileFromMemory(data.data,
+                                        data.size,
                                         aiProcess_Triangulate | aiProcess_JoinIdenticalVertices |
                                             aiProcess_SortByPType | aiProcess_RemoveComponent,
                                         hint);
   else
     scene =
-        importer.ReadFileFromMemory(data.data(),
-                                    data.size(),
+        importer.ReadFileFromMemory(data.data,
+                                    data.size,
                                     aiProcess_JoinIdenticalVertices | aiProcess_SortByPType | aiProcess_RemoveComponent,
                                     hint);
 
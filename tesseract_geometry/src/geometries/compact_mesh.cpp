@@ -0,0 +1,155 @@
+/**
+ * @file compact_mesh.cpp
+ * @brief Tesseract Compact Mesh Geometry
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <boost/serialization/access.hpp>
+#include <boost/serialization/base_object.hpp>
+#include <boost/serialization/nvp.hpp>
+#include <boost/serialization/vector.hpp>
+#include <boost/serialization/shared_ptr.hpp>
+#include <memory>
+#include <stdexcept>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/utils.h>
+#include <tesseract_common/eigen_serialization.h>
+#include <tesseract_geometry/impl/compact_mesh.h>
+
+namespace tesseract_geometry
+{
+CompactMesh::CompactMesh(std::shared_ptr<const std::vector<float>> vertices,
+                         std::shared_ptr<const std::vector<std::uint32_t>> triangles,
+                         tesseract_common::Resource::ConstPtr resource,
+                         const Eigen::Vector3d& scale)
+  : Geometry(GeometryType::COMPACT_MESH)
+  , vertices_(std::move(vertices))
+  , triangles_(std::move(triangles))
+  , resource_(std::move(resource))
+  , scale_(scale)
+{
+  if (vertices_ == nullptr || triangles_ == nullptr)
+    std::throw_with_nested(std::runtime_error("CompactMesh: The vertices and triangles must not be nullptr"));
+
+  if (vertices_->size() % 3 != 0)
+    std::throw_with_nested(std::runtime_error("CompactMesh: The number of vertex coordinates must be a multiple of 3"));
+
+  if (triangles_->size() % 3 != 0)
+    std::throw_with_nested(std::runtime_error("CompactMesh: The number of triangle indices must be a multiple of 3"));
+
+  const std::size_t vertex_count = vertices_->size() / 3;
+  for (std::uint32_t index : *triangles_)
+  {
+    if (index >= vertex_count)
+      std::throw_with_nested(std::runtime_error("CompactMesh: Triangle vertex index is out of range"));
+  }
+}
+
+CompactMesh::CompactMesh(const PolygonMesh& mesh)
+  : Geometry(GeometryType::COMPACT_MESH), resource_(mesh.getResource()), scale_(mesh.getScale())
+{
+  const tesseract_common::VectorVector3d& mesh_vertices = *mesh.getVertices();
+  const Eigen::VectorXi& mesh_faces = *mesh.getFaces();
+
+  auto vertices = std::make_shared<std::vector<float>>();
+  vertices->reserve(3 * mesh_vertices.size());
+  for (const auto& v : mesh_vertices)
+  {
+    vertices->push_back(static_cast<float>(v.x()));
+    vertices->push_back(static_cast<float>(v.y()));
+    vertices->push_back(static_cast<float>(v.z()));
+  }
+
+  auto triangles = std::make_shared<std::vector<std::uint32_t>>();
+  triangles->reserve(3 * static_cast<std::size_t>(mesh.getFaceCount()));
+  for (Eigen::Index i = 0; i < mesh_faces.size();)
+  {
+    const int face_vertex_count = mesh_faces[i];
+    if (face_vertex_count < 3 || i + face_vertex_count >= mesh_faces.size())
+      std::throw_with_nested(std::runtime_error("CompactMesh: The polygon mesh faces are invalid"));
+
+    // Triangulate the face as a fan around its first vertex
+    for (int j = 2; j < face_vertex_count; ++j)
+    {
+      triangles->push_back(static_cast<std::uint32_t>(mesh_faces[i + 1]));
+      triangles->push_back(static_cast<std::uint32_t>(mesh_faces[i + j]));
+      triangles->push_back(static_cast<std::uint32_t>(mesh_faces[i + j + 1]));
+    }
+    i += face_vertex_count + 1;
+  }
+
+  vertices_ = vertices;
+  triangles_ = triangles;
+}
+
+Mesh::Ptr CompactMesh::toMesh() const
+{
+  auto vertices = std::make_shared<tesseract_common::VectorVector3d>();
+  vertices->reserve(static_cast<std::size_t>(getVertexCount()));
+  for (std::size_t i = 0; i < static_cast<std::size_t>(getVertexCount()); ++i)
+    vertices->push_back(getVertex(i));
+
+  const int triangle_count = getTriangleCount();
+  auto faces = std::make_shared<Eigen::VectorXi>(4L * triangle_count);
+  for (std::size_t i = 0; i < static_cast<std::size_t>(triangle_count); ++i)
+  {
+    const auto idx = static_cast<Eigen::Index>(4 * i);
+    (*faces)[idx] = 3;
+    (*faces)[idx + 1] = static_cast<int>((*triangles_)[3 * i]);
+    (*faces)[idx + 2] = static_cast<int>((*triangles_)[(3 * i) + 1]);
+    (*faces)[idx + 3] = static_cast<int>((*triangles_)[(3 * i) + 2]);
+  }
+
+  return std::make_shared<Mesh>(vertices, faces, triangle_count, resource_, scale_);
+}
+
+bool CompactMesh::operator==(const CompactMesh& rhs) const
+{
+  bool equal = true;
+  equal &= Geometry::operator==(rhs);
+  equal &= (vertices_ == rhs.vertices_) ||
+           (vertices_ != nullptr && rhs.vertices_ != nullptr && *vertices_ == *rhs.vertices_);
+  equal &= (triangles_ == rhs.triangles_) ||
+           (triangles_ != nullptr && rhs.triangles_ != nullptr && *triangles_ == *rhs.triangles_);
+  equal &= tesseract_common::almostEqualRelativeAndAbs(scale_, rhs.scale_);
+  return equal;
+}
+bool CompactMesh::operator!=(const CompactMesh& rhs) const { return !operator==(rhs); }
+
+template <class Archive>
+void CompactMesh::serialize(Archive& ar, const unsigned int /*version*/)
+{
+  ar& BOOST_SERIALIZATION_BASE_OBJECT_NVP(Geometry);
+  ar& BOOST_SERIALIZATION_NVP(vertices_);
+  ar& BOOST_SERIALIZATION_NVP(triangles_);
+  ar& BOOST_SERIALIZATION_NVP(resource_);
+  ar& BOOST_SERIALIZATION_NVP(scale_);
+}
+}  // namespace tesseract_geometry
+
+#include <tesseract_common/serialization.h>
+TESSERACT_SERIALIZE_ARCHIVES_INSTANTIATE(tesseract_geometry::CompactMesh)
+BOOST_CLASS_EXPORT_IMPLEMENT(tesseract_geometry::CompactMesh)
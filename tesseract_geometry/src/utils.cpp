@@ -202,6 +202,19 @@ bool isIdentical(const Geometry& geom1, const Geometry& geom2)
 
       break;
     }
+    case GeometryType::COMPACT_MESH:
+    {
+      const auto& s1 = static_cast<const CompactMesh&>(geom1);
+      const auto& s2 = static_cast<const CompactMesh&>(geom2);
+
+      if (s1.getVertexCount() != s2.getVertexCount())
+        return false;
+
+      if (s1.getTriangleCount() != s2.getTriangleCount())
+        return false;
+
+      break;
+    }
     default:
     {
       CONSOLE_BRIDGE_logError("This geometric shape type (%d) is not supported", static_cast<int>(geom1.getType()));
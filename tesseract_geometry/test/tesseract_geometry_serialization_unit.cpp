@@ -58,6 +58,23 @@ TEST(TesseractGeometrySerializeUnit, Cone)  // NOLINT
   tesseract_common::testSerializationDerivedClass<Geometry, Cone>(object, "Cone");
 }
 
+TEST(TesseractGeometrySerializeUnit, CompactMesh)  // NOLINT
+{
+  std::string path = std::string(TESSERACT_SUPPORT_DIR) + "/meshes/sphere_p25m.stl";
+  tesseract_common::TesseractSupportResourceLocator locator;
+  auto meshes = tesseract_geometry::createMeshFromResource<tesseract_geometry::Mesh>(locator.locateResource(path));
+  auto object = std::make_shared<CompactMesh>(*meshes.front());
+  tesseract_common::testSerialization<CompactMesh>(*object, "CompactMesh");
+  tesseract_common::testSerializationDerivedClass<Geometry, CompactMesh>(object, "CompactMesh");
+
+  // The resource is serialized
+  ASSERT_TRUE(object->getResource() != nullptr);
+  std::string object_string = tesseract_common::Serialization::toArchiveStringXML<CompactMesh>(*object, "CompactMesh");
+  auto nobject = tesseract_common::Serialization::fromArchiveStringXML<CompactMesh>(object_string);
+  ASSERT_TRUE(nobject.getResource() != nullptr);
+  EXPECT_EQ(nobject.getResource()->getUrl(), object->getResource()->getUrl());
+}
+
 TEST(TesseractGeometrySerializeUnit, ConvexMesh)  // NOLINT
 {
   std::string path = std::string(TESSERACT_SUPPORT_DIR) + "/meshes/sphere_p25m.stl";
@@ -319,6 +319,63 @@ TEST(TesseractGeometryUnit, Mesh)  // NOLINT
   }
 }
 
+TEST(TesseractGeometryUnit, CompactMesh)  // NOLINT
+{
+  auto vertices = std::make_shared<std::vector<float>>(std::vector<float>{ 1, 1, 0, 1, -1, 0, -1, -1, 0, -1, 1, 0 });
+  auto triangles = std::make_shared<std::vector<std::uint32_t>>(std::vector<std::uint32_t>{ 0, 1, 2, 0, 2, 3 });
+
+  using T = tesseract_geometry::CompactMesh;
+  auto geom = std::make_shared<T>(vertices, triangles);
+  EXPECT_TRUE(geom->getVertices() == vertices);
+  EXPECT_TRUE(geom->getTriangles() == triangles);
+  EXPECT_EQ(geom->getVertexCount(), 4);
+  EXPECT_EQ(geom->getTriangleCount(), 2);
+  EXPECT_TRUE(geom->getVertex(1).isApprox(Eigen::Vector3d(1, -1, 0)));
+  EXPECT_TRUE(geom->getScale().isApprox(Eigen::Vector3d(1, 1, 1)));
+  EXPECT_EQ(geom->getType(), tesseract_geometry::GeometryType::COMPACT_MESH);
+
+  // The clone shares the buffers
+  auto geom_clone = geom->clone();
+  EXPECT_TRUE(std::static_pointer_cast<T>(geom_clone)->getVertices() == vertices);
+  EXPECT_TRUE(std::static_pointer_cast<T>(geom_clone)->getTriangles() == triangles);
+  EXPECT_EQ(geom_clone->getType(), tesseract_geometry::GeometryType::COMPACT_MESH);
+
+  // Test isIdentical
+  EXPECT_TRUE(tesseract_geometry::isIdentical(*geom, *geom_clone));
+  EXPECT_FALSE(tesseract_geometry::isIdentical(
+      *geom,
+      T(vertices, std::make_shared<std::vector<std::uint32_t>>(std::vector<std::uint32_t>{ 0, 1, 2 }))));
+
+  // Convert to a mesh
+  tesseract_geometry::Mesh::Ptr mesh = geom->toMesh();
+  EXPECT_EQ(mesh->getVertexCount(), 4);
+  EXPECT_EQ(mesh->getFaceCount(), 2);
+  EXPECT_TRUE(mesh->getVertices()->at(3).isApprox(Eigen::Vector3d(-1, 1, 0)));
+  EXPECT_EQ((*mesh->getFaces())[4], 3);
+  EXPECT_EQ((*mesh->getFaces())[7], 3);
+
+  // Convert from a polygon mesh, the quad is triangulated
+  auto poly_vertices = std::make_shared<tesseract_common::VectorVector3d>(*mesh->getVertices());
+  poly_vertices->emplace_back(0, 0, 1);
+  auto poly_faces = std::make_shared<Eigen::VectorXi>(9);
+  *poly_faces << 4, 0, 1, 2, 3, 3, 0, 1, 4;
+  T converted(tesseract_geometry::PolygonMesh(poly_vertices, poly_faces, 2, nullptr, Eigen::Vector3d(2, 2, 2)));
+  EXPECT_EQ(converted.getVertexCount(), 5);
+  ASSERT_EQ(converted.getTriangleCount(), 3);
+  EXPECT_TRUE(converted.getScale().isApprox(Eigen::Vector3d(2, 2, 2)));
+  EXPECT_EQ(*converted.getTriangles(), std::vector<std::uint32_t>({ 0, 1, 2, 0, 2, 3, 0, 1, 4 }));
+  EXPECT_TRUE(converted.getVertex(4).isApprox(Eigen::Vector3d(0, 0, 1)));
+
+  // Invalid buffers
+  EXPECT_ANY_THROW(T(nullptr, triangles));  // NOLINT
+  EXPECT_ANY_THROW(  // NOLINT
+      T(std::make_shared<std::vector<float>>(std::vector<float>{ 1, 1 }), triangles));
+  EXPECT_ANY_THROW(  // NOLINT
+      T(vertices, std::make_shared<std::vector<std::uint32_t>>(std::vector<std::uint32_t>{ 0, 1 })));
+  EXPECT_ANY_THROW(  // NOLINT
+      T(vertices, std::make_shared<std::vector<std::uint32_t>>(std::vector<std::uint32_t>{ 0, 1, 4 })));
+}
+
 TEST(TesseractGeometryUnit, SDFMesh)  // NOLINT
 {
   auto vertices = std::make_shared<tesseract_common::VectorVector3d>();
@@ -0,0 +1,194 @@
+/**
+ * @file ik_cache.h
+ * @brief A least recently used cache of inverse kinematics solutions
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_KINEMATICS_IK_CACHE_H
+#define TESSERACT_KINEMATICS_IK_CACHE_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <Eigen/Geometry>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_kinematics/core/types.h>
+
+namespace tesseract_kinematics
+{
+/** @brief The configuration of an inverse kinematics cache */
+struct IKCacheConfig
+{
+  /**
+   * @brief The quantization step of the target positions
+   * @details Targets whose positions fall within the same step share solutions, so this is the position error
+   * accepted when reusing a solution
+   */
+  double position_tolerance{ 1e-6 };
+
+  /**
+   * @brief The quantization step of the quaternion components of the target orientations
+   * @details Targets whose orientations fall within the same step share solutions, so this is the orientation error
+   * accepted when reusing a solution
+   */
+  double orientation_tolerance{ 1e-6 };
+
+  /**
+   * @brief The quantization step of the seed joint values
+   * @details This should be coarse, it only matters for solvers whose solutions depend on the seed
+   */
+  double seed_tolerance{ 0.1 };
+
+  /** @brief The maximum number of cached requests, if zero nothing is cached */
+  std::size_t capacity{ 1024 };
+
+  /** @brief The number of independently locked shards the entries are distributed over */
+  std::size_t shard_count{ 16 };
+};
+
+/**
+ * @brief A thread safe least recently used cache of inverse kinematics solutions
+ * @details Requests are identified by a key built with the append functions from the names of the solver, frames and
+ * tip links together with the quantized target poses and seed. The entries are distributed over shards by the hash of
+ * the key where each shard has its own lock and evicts its least recently used entry when full.
+ *
+ * Every entry belongs to a revision of the environment the solutions were computed for. Changing the revision clears
+ * the cache and lookups or insertions using a different revision are ignored, so kinematics created from an outdated
+ * environment never read or write the cache.
+ */
+class IKCache
+{
+public:
+  using Ptr = std::shared_ptr<IKCache>;
+  using ConstPtr = std::shared_ptr<const IKCache>;
+  using UPtr = std::unique_ptr<IKCache>;
+  using ConstUPtr = std::unique_ptr<const IKCache>;
+
+  /**
+   * @brief Construct an empty cache
+   * @param config The cache configuration
+   */
+  explicit IKCache(IKCacheConfig config = IKCacheConfig());
+  virtual ~IKCache() = default;
+  IKCache(const IKCache&) = delete;
+  IKCache& operator=(const IKCache&) = delete;
+  IKCache(IKCache&&) = delete;
+  IKCache& operator=(IKCache&&) = delete;
+
+  /** @brief Get the cache configuration */
+  const IKCacheConfig& getConfig() const;
+
+  /**
+   * @brief Append a name to a key
+   * @param key The key to append to
+   * @param name The name, for example a working frame or tip link name
+   */
+  void appendName(std::string& key, const std::string& name) const;
+
+  /**
+   * @brief Append a quantized pose to a key
+   * @param key The key to append to
+   * @param pose The pose
+   */
+  void appendPose(std::string& key, const Eigen::Isometry3d& pose) const;
+
+  /**
+   * @brief Append a quantized seed to a key
+   * @param key The key to append to
+   * @param seed The seed joint values
+   */
+  void appendSeed(std::string& key, const Eigen::Ref<const Eigen::VectorXd>& seed) const;
+
+  /**
+   * @brief Get the cached solutions of a request and mark it as most recently used
+   * @param solutions The cached solutions, unchanged if not found
+   * @param key The key of the request
+   * @param revision The revision the caller was created for
+   * @return True if found, otherwise false
+   */
+  bool get(IKSolutions& solutions, const std::string& key, int revision);
+
+  /**
+   * @brief Store the solutions of a request, evicting the least recently used request of its shard if full
+   * @param key The key of the request
+   * @param revision The revision the caller was created for, ignored if it is not the current revision
+   * @param solutions The solutions
+   */
+  void put(const std::string& key, int revision, IKSolutions solutions);
+
+  /**
+   * @brief Set the current revision, clearing the cache if it changed
+   * @param revision The revision
+   */
+  void setRevision(int revision);
+
+  /** @brief Get the current revision */
+  int getRevision() const;
+
+  /** @brief Remove all entries */
+  void clear();
+
+  /** @brief Get the number of cached requests */
+  std::size_t size() const;
+
+  /** @brief Get the number of lookups which found an entry */
+  std::size_t getHitCount() const;
+
+  /** @brief Get the number of lookups which did not find an entry */
+  std::size_t getMissCount() const;
+
+protected:
+  /** @brief A part of the cache with its own lock */
+  struct Shard
+  {
+    using Entry = std::pair<std::string, IKSolutions>;
+
+    /** @brief The entries ordered from most to least recently used */
+    std::list<Entry> entries;
+
+    /** @brief The entries indexed by key */
+    std::unordered_map<std::string, std::list<Entry>::iterator> lookup;
+
+    mutable std::mutex mutex;
+  };
+
+  IKCacheConfig config_;
+  std::size_t shard_capacity_{ 0 };
+  std::vector<Shard> shards_;
+  std::atomic<int> revision_{ 0 };
+  std::atomic<std::size_t> hits_{ 0 };
+  std::atomic<std::size_t> misses_{ 0 };
+
+  /** @brief Get the shard a key belongs to */
+  Shard& getShard(const std::string& key);
+};
+
+}  // namespace tesseract_kinematics
+
+#endif  // TESSERACT_KINEMATICS_IK_CACHE_H
@@ -78,6 +78,18 @@ public:
   virtual IKSolutions calcInvKin(const tesseract_common::TransformMap& tip_link_poses,
                                  const Eigen::Ref<const Eigen::VectorXd>& seed) const = 0;
 
+  /**
+   * @brief Calculates joint solutions for a batch of poses of a single tip link
+   * @details The default implementation calls calcInvKin for every pose. Solvers which can solve many poses more
+   * efficiently, like closed form solvers, should override this.
+   * @note This is only supported by solvers with a single tip link
+   * @param tip_link_poses The poses of the tip link relative to the working frame of the kinematics group
+   * @param seed Vector of seed joint angles used for every pose (size must match number of joints in kinematic object)
+   * @return The solutions of every pose, if a pose has no solutions it failed to find a solution
+   */
+  virtual IKBatchSolutions calcInvKinBatch(const tesseract_common::VectorIsometry3d& tip_link_poses,
+                                           const Eigen::Ref<const Eigen::VectorXd>& seed) const;
+
   /**
    * @brief Get list of joint names for kinematic object
    * @return A vector of joint names, joint_list_
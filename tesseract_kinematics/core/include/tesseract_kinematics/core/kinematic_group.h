@@ -34,6 +34,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_kinematics/core/joint_group.h>
 #include <tesseract_kinematics/core/inverse_kinematics.h>
+#include <tesseract_kinematics/core/ik_cache.h>
 
 namespace tesseract_kinematics
 {
@@ -74,6 +75,24 @@ struct KinGroupIKInput
 };
 using KinGroupIKInputs = tesseract_common::AlignedVector<KinGroupIKInput>;
 
+/** @brief The configuration used when solving inverse kinematics for a batch of poses */
+struct KinGroupIKBatchConfig
+{
+  /** @brief The number of threads to use, if zero the hardware concurrency is used */
+  std::size_t num_threads{ 0 };
+
+  /**
+   * @brief Seed each pose with the solution of the previous pose which is closest to the seed of the previous pose
+   * @details This is intended for numerical solvers where consecutive waypoints of a toolpath should converge to the
+   * same configuration. The poses are split into one contiguous block per thread and the first pose of every block is
+   * seeded with the provided seed, so use a single thread if every pose should be seeded by its neighbor.
+   */
+  bool propagate_seed{ false };
+};
+
+/** @brief The inverse kinematics solutions for a batch of poses stored in a single buffer */
+using KinGroupIKBatchSolutions = IKBatchSolutions;
+
 class KinematicGroup : public JointGroup
 {
 public:
@@ -125,6 +144,23 @@ public:
    */
   IKSolutions calcInvKin(const KinGroupIKInput& tip_link_pose, const Eigen::Ref<const Eigen::VectorXd>& seed) const;
 
+  /**
+   * @brief Calculates joint solutions for a batch of poses, for example the waypoints of a toolpath
+   * @details The transforms to the working frame and tip link of the inverse kinematics solver are only computed once
+   * for the batch. The poses are solved by multiple threads, each using its own clone of the inverse kinematics solver.
+   * @param poses The poses of the tip link relative to the working frame
+   * @param working_frame The link name the poses are relative to, it must be listed in getAllValidWorkingFrames
+   * @param tip_link_name The tip link to solve inverse kinematics for, it must be listed in getAllPossibleTipLinkNames
+   * @param seed Vector of seed joint angles (size must match number of joints in robot chain)
+   * @param config The batch configuration
+   * @return The solutions of every pose, if a pose has no solutions it failed to find a solution
+   */
+  KinGroupIKBatchSolutions calcInvKinBatch(const tesseract_common::VectorIsometry3d& poses,
+                                           const std::string& working_frame,
+                                           const std::string& tip_link_name,
+                                           const Eigen::Ref<const Eigen::VectorXd>& seed,
+                                           const KinGroupIKBatchConfig& config = KinGroupIKBatchConfig()) const;
+
   /** @brief Returns all possible working frames in which goal poses can be defined
    * @details The inverse kinematics solver requires that all poses be defined relative to a single working frame.
    * However if this working frame is static, a pose can be defined in another static frame in the environment and
@@ -145,6 +181,19 @@ public:
    */
   std::vector<std::string> getAllPossibleTipLinkNames() const;
 
+  /**
+   * @brief Set the cache used by calcInvKin
+   * @details The cache may be shared by multiple kinematic groups. It stores the solutions of the inverse kinematics
+   * solver before they are checked against the joint limits of the group, so changing the limits does not invalidate
+   * it. The cache is not used by calcInvKinBatch.
+   * @param cache The cache, if nullptr caching is disabled
+   * @param revision The revision of the environment the kinematic group was created for
+   */
+  void setIKCache(IKCache::Ptr cache, int revision = 0);
+
+  /** @brief Get the cache used by calcInvKin, nullptr if caching is disabled */
+  IKCache::Ptr getIKCache() const;
+
 private:
   std::vector<std::string> joint_names_;
   bool reorder_required_{ false };
@@ -153,6 +202,58 @@ private:
   Eigen::Isometry3d inv_to_fwd_base_{ Eigen::Isometry3d::Identity() };
   std::vector<std::string> working_frames_;
   std::unordered_map<std::string, std::string> inv_tip_links_map_;
+  IKCache::Ptr ik_cache_;
+  int ik_cache_revision_{ 0 };
+
+  /**
+   * @brief Get the transform from the inverse kinematics solver working frame to a valid working frame
+   * @param working_frame The working frame listed in getAllValidWorkingFrames
+   * @return The transform from the inverse kinematics solver working frame to the working frame
+   */
+  Eigen::Isometry3d calcWorkingFrameOffset(const std::string& working_frame) const;
+
+  /**
+   * @brief Get the transform from a possible tip link to the inverse kinematics solver tip link
+   * @param tip_link_name The tip link listed in getAllPossibleTipLinkNames
+   * @return The transform from the tip link to the inverse kinematics solver tip link
+   */
+  Eigen::Isometry3d calcTipLinkOffset(const std::string& tip_link_name) const;
+
+  /**
+   * @brief Solve inverse kinematics and convert the solutions to the joint order of the group
+   * @details Solutions are harmonized toward the median of the joint limits and solutions violating the limits are
+   * removed.
+   * @param inv_kin The inverse kinematics solver
+   * @param ik_inputs The poses of the inverse kinematics solver tip links relative to its working frame
+   * @param seed Vector of seed joint angles in the joint order of the group
+   * @return The solutions in the joint order of the group
+   */
+  IKSolutions calcInvKinHelper(const InverseKinematics& inv_kin,
+                               const tesseract_common::TransformMap& ik_inputs,
+                               const Eigen::Ref<const Eigen::VectorXd>& seed) const;
+
+  /**
+   * @brief Convert solutions of the inverse kinematics solver to the joint order of the group
+   * @details Solutions are harmonized toward the median of the joint limits and solutions violating the limits are
+   * removed.
+   * @param solutions The solutions in the joint order of the solver
+   * @return The solutions in the joint order of the group
+   */
+  IKSolutions processSolutions(IKSolutions solutions) const;
+
+  /**
+   * @brief Convert joint values from the joint order of the group to the joint order of the inverse kinematics solver
+   * @param seed Vector of joint values in the joint order of the group
+   * @return The joint values in the joint order of the inverse kinematics solver
+   */
+  Eigen::VectorXd toSolverJointOrder(const Eigen::Ref<const Eigen::VectorXd>& seed) const;
+
+  /**
+   * @brief Convert a solution of the inverse kinematics solver to the joint order of the group and harmonize it
+   * @param solution The solution in the joint order of the solver which is modified in place
+   * @return True if the solution satisfies the joint limits, otherwise false
+   */
+  bool processSolution(Eigen::VectorXd& solution) const;
 };
 
 }  // namespace tesseract_kinematics
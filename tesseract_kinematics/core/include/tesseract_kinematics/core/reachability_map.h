@@ -0,0 +1,246 @@
+/**
+ * @file reachability_map.h
+ * @brief A voxelized reachability map of a kinematic group
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_KINEMATICS_REACHABILITY_MAP_H
+#define TESSERACT_KINEMATICS_REACHABILITY_MAP_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include <Eigen/Geometry>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/types.h>
+
+namespace tesseract_kinematics
+{
+class KinematicGroup;
+
+/** @brief The configuration used when creating a reachability map */
+struct ReachabilityMapConfig
+{
+  /** @brief The edge length of a voxel */
+  double resolution{ 0.05 };
+
+  /** @brief The number of random joint states for which forward kinematics is sampled */
+  std::size_t fk_samples{ 100000 };
+
+  /**
+   * @brief The number of rotations about the approach axis tried when solving inverse kinematics for an orientation
+   * @details After sampling forward kinematics, inverse kinematics is solved at the center of every reachable voxel
+   * for every orientation which was not covered by the forward kinematics samples. If zero this is skipped.
+   */
+  std::size_t ik_samples{ 0 };
+
+  /** @brief The number of threads to use, if zero the hardware concurrency is used */
+  std::size_t num_threads{ 0 };
+
+  /** @brief The seed of the random joint states, the same seed and number of threads creates the same map */
+  unsigned seed{ 0 };
+};
+
+/**
+ * @brief A voxelized reachability map of the tip link of a kinematic group relative to a working frame
+ * @details Every voxel stores a bit mask of the approach directions (the z-axis of the tip link) reached within the
+ * voxel. The approach directions are discretized into ORIENTATION_BIN_COUNT bins evenly distributed on the unit
+ * sphere. All queries are a constant time lookup.
+ */
+class ReachabilityMap
+{
+public:
+  // LCOV_EXCL_START
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+  // LCOV_EXCL_STOP
+
+  using Ptr = std::shared_ptr<ReachabilityMap>;
+  using ConstPtr = std::shared_ptr<const ReachabilityMap>;
+  using UPtr = std::unique_ptr<ReachabilityMap>;
+  using ConstUPtr = std::unique_ptr<const ReachabilityMap>;
+
+  /** @brief The number of approach direction bins */
+  static constexpr std::size_t ORIENTATION_BIN_COUNT = 32;
+
+  ReachabilityMap() = default;
+  virtual ~ReachabilityMap() = default;
+  ReachabilityMap(const ReachabilityMap&) = default;
+  ReachabilityMap& operator=(const ReachabilityMap&) = default;
+  ReachabilityMap(ReachabilityMap&&) = default;
+  ReachabilityMap& operator=(ReachabilityMap&&) = default;
+
+  /**
+   * @brief Construct an empty reachability map
+   * @param working_frame The frame the map is relative to
+   * @param tip_link_name The tip link the map was created for
+   * @param origin The minimum corner of the map
+   * @param resolution The edge length of a voxel
+   * @param size The number of voxels along each axis
+   */
+  ReachabilityMap(std::string working_frame,
+                  std::string tip_link_name,
+                  const Eigen::Vector3d& origin,
+                  double resolution,
+                  const std::array<std::size_t, 3>& size);
+
+  /**
+   * @brief Create a reachability map by sampling a kinematic group
+   * @details The joint space is sampled with forward kinematics and the bounds of the map are the bounds of the
+   * samples. If requested, inverse kinematics is then solved for the orientations not covered by the samples.
+   * @param kin_group The kinematic group to sample
+   * @param working_frame The frame the map is relative to, it must be listed in getAllValidWorkingFrames
+   * @param tip_link_name The tip link to sample, it must be listed in getAllPossibleTipLinkNames
+   * @param config The configuration
+   * @return The reachability map
+   */
+  static ReachabilityMap create(const KinematicGroup& kin_group,
+                                const std::string& working_frame,
+                                const std::string& tip_link_name,
+                                const ReachabilityMapConfig& config = ReachabilityMapConfig());
+
+  /**
+   * @brief Mark the voxel and approach direction of a pose as reachable
+   * @param pose The pose of the tip link relative to the working frame, ignored if outside the map
+   */
+  void addPose(const Eigen::Isometry3d& pose);
+
+  /**
+   * @brief Check if any pose within the voxel containing the position is reachable
+   * @param position The position relative to the working frame
+   * @return True if reachable, otherwise false
+   */
+  bool isReachable(const Eigen::Vector3d& position) const;
+
+  /**
+   * @brief Check if any voxel within a number of voxels of the voxel containing the position is reachable
+   * @details The map is created from samples so a reachable voxel may not have been sampled. Checking the neighboring
+   * voxels makes the check conservative for pruning, positions farther than the dilation from any sampled voxel are
+   * considered unreachable.
+   * @param position The position relative to the working frame
+   * @param dilation The number of voxels along each axis around the voxel containing the position which are checked
+   * @return True if a voxel within the dilation is reachable, otherwise false
+   */
+  bool isNearReachable(const Eigen::Vector3d& position, std::size_t dilation = 1) const;
+
+  /**
+   * @brief Check if the approach direction of the pose is reachable within the voxel containing its position
+   * @param pose The pose of the tip link relative to the working frame
+   * @return True if reachable, otherwise false
+   */
+  bool isReachable(const Eigen::Isometry3d& pose) const;
+
+  /**
+   * @brief Get the bit mask of reachable approach directions of the voxel containing the position
+   * @param position The position relative to the working frame
+   * @return The bit mask, zero if the position is outside the map
+   */
+  std::uint32_t getOrientationMask(const Eigen::Vector3d& position) const;
+
+  /**
+   * @brief Get the fraction of approach directions reachable within the voxel containing the position
+   * @param position The position relative to the working frame
+   * @return The fraction between zero and one
+   */
+  double getOrientationCoverage(const Eigen::Vector3d& position) const;
+
+  /** @brief Get the frame the map is relative to */
+  const std::string& getWorkingFrame() const;
+
+  /** @brief Get the tip link the map was created for */
+  const std::string& getTipLinkName() const;
+
+  /** @brief Get the minimum corner of the map */
+  const Eigen::Vector3d& getOrigin() const;
+
+  /** @brief Get the edge length of a voxel */
+  double getResolution() const;
+
+  /** @brief Get the number of voxels along each axis */
+  const std::array<std::size_t, 3>& getSize() const;
+
+  /** @brief Get the number of voxels with at least one reachable approach direction */
+  std::size_t getReachableVoxelCount() const;
+
+  /**
+   * @brief Get the approach direction bin closest to a direction
+   * @param direction The unit direction
+   * @return The bin index
+   */
+  static std::size_t getOrientationBin(const Eigen::Vector3d& direction);
+
+  /**
+   * @brief Get the approach direction of a bin
+   * @param bin The bin index
+   * @return The unit direction
+   */
+  static const Eigen::Vector3d& getOrientationBinDirection(std::size_t bin);
+
+  /**
+   * @brief Save the map to a binary file
+   * @details The file is written in the byte order of the machine
+   * @param file_path The file path
+   * @return True if successful, otherwise false
+   */
+  bool saveFile(const tesseract_common::fs::path& file_path) const;
+
+  /**
+   * @brief Load the map from a binary file written by saveFile
+   * @details The file is rejected if the sizes it contains do not match the size of the file
+   * @param file_path The file path
+   * @return True if successful, otherwise false and the map is unchanged
+   */
+  bool loadFile(const tesseract_common::fs::path& file_path);
+
+  bool operator==(const ReachabilityMap& rhs) const;
+  bool operator!=(const ReachabilityMap& rhs) const;
+
+protected:
+  std::string working_frame_;                          /**< @brief The frame the map is relative to */
+  std::string tip_link_name_;                          /**< @brief The tip link the map was created for */
+  Eigen::Vector3d origin_{ Eigen::Vector3d::Zero() };  /**< @brief The minimum corner of the map */
+  double resolution_{ 0 };                             /**< @brief The edge length of a voxel */
+  std::array<std::size_t, 3> size_{ 0, 0, 0 };         /**< @brief The number of voxels along each axis */
+  std::vector<std::uint32_t> voxels_;                  /**< @brief The approach direction mask of every voxel */
+
+  /**
+   * @brief Get the index of the voxel containing the position
+   * @param position The position relative to the working frame
+   * @return The index of the voxel, or -1 if the position is outside the map
+   */
+  long getVoxelIndex(const Eigen::Vector3d& position) const;
+
+  /**
+   * @brief Get the center of a voxel
+   * @param index The index of the voxel
+   * @return The center relative to the working frame
+   */
+  Eigen::Vector3d getVoxelCenter(std::size_t index) const;
+};
+
+}  // namespace tesseract_kinematics
+
+#endif  // TESSERACT_KINEMATICS_REACHABILITY_MAP_H
@@ -37,6 +37,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_kinematics/core/inverse_kinematics.h>
 #include <tesseract_kinematics/core/forward_kinematics.h>
+#include <tesseract_kinematics/core/reachability_map.h>
 #include <tesseract_kinematics/core/types.h>
 
 namespace tesseract_kinematics
@@ -117,6 +118,20 @@ public:
   std::string getSolverName() const override final;
   InverseKinematics::UPtr clone() const override final;
 
+  /**
+   * @brief Set the reachability map of the manipulator used to skip positioner samples which can not be reached
+   * @details Positioner samples where the target position is more than one voxel away from any voxel the manipulator
+   * reaches are skipped without calling the manipulator inverse kinematics. The neighboring voxels are included since
+   * the map is sampled and a reachable voxel may not have been sampled. Only the position is checked since the
+   * orientation coverage is sampled and may be incomplete.
+   * @param reachability_map The map relative to the manipulator working frame for the manipulator tip link, nullptr to
+   * disable
+   */
+  void setReachabilityMap(ReachabilityMap::ConstPtr reachability_map);
+
+  /** @brief Get the reachability map of the manipulator, nullptr if not set */
+  ReachabilityMap::ConstPtr getReachabilityMap() const;
+
 private:
   std::vector<std::string> joint_names_;
   InverseKinematics::UPtr manip_inv_kin_;
@@ -127,6 +142,7 @@ private:
   Eigen::Index dof_{ -1 };
   Eigen::Isometry3d positioner_to_robot_{ Eigen::Isometry3d::Identity() };
   std::vector<Eigen::VectorXd> dof_range_;
+  ReachabilityMap::ConstPtr reachability_map_;
   std::string solver_name_{ DEFAULT_ROP_INV_KIN_SOLVER_NAME }; /**< @brief Name of this solver */
 
   void init(const tesseract_scene_graph::SceneGraph& scene_graph,
@@ -40,6 +40,39 @@ namespace tesseract_kinematics
 /** @brief The inverse kinematics solutions container */
 using IKSolutions = std::vector<Eigen::VectorXd>;
 
+/**
+ * @brief The inverse kinematics solutions for a batch of poses stored in a single buffer
+ * @details The solutions of pose i are the columns offsets[i] to offsets[i + 1] - 1 of solutions.
+ */
+struct IKBatchSolutions
+{
+  /** @brief The solutions of every pose stored as columns */
+  Eigen::MatrixXd solutions;
+
+  /** @brief The first column of the solutions of every pose, the last entry is the total number of solutions */
+  std::vector<Eigen::Index> offsets;
+
+  /** @brief Get the number of poses */
+  std::size_t size() const { return offsets.empty() ? 0 : offsets.size() - 1; }
+
+  /**
+   * @brief Get the number of solutions of a pose
+   * @param index The index of the pose
+   * @return The number of solutions
+   */
+  Eigen::Index getSolutionCount(std::size_t index) const { return offsets[index + 1] - offsets[index]; }
+
+  /**
+   * @brief Get the solutions of a pose
+   * @param index The index of the pose
+   * @return The solutions stored as columns
+   */
+  Eigen::MatrixXd::ConstColsBlockXpr getSolutions(std::size_t index) const
+  {
+    return solutions.middleCols(offsets[index], getSolutionCount(index));
+  }
+};
+
 /** @brief The Universal Robot kinematic parameters */
 struct URParameters
 {
@@ -524,5 +524,29 @@ inline void harmonizeTowardMedian(Eigen::Ref<VectorX<FloatType>> qs,
   }
 }
 
+/**
+ * @brief Store the inverse kinematics solutions of a batch of poses in a single buffer
+ * @param pose_solutions The solutions of every pose
+ * @param num_joints The number of joints of every solution
+ * @return The solutions of every pose stored in a single buffer
+ */
+inline IKBatchSolutions toIKBatchSolutions(const std::vector<IKSolutions>& pose_solutions, Eigen::Index num_joints)
+{
+  IKBatchSolutions batch_solutions;
+  batch_solutions.offsets.reserve(pose_solutions.size() + 1);
+  batch_solutions.offsets.push_back(0);
+  for (const auto& solutions : pose_solutions)
+    batch_solutions.offsets.push_back(batch_solutions.offsets.back() + static_cast<Eigen::Index>(solutions.size()));
+
+  batch_solutions.solutions.resize(num_joints, batch_solutions.offsets.back());
+  for (std::size_t i = 0; i < pose_solutions.size(); ++i)
+  {
+    for (std::size_t j = 0; j < pose_solutions[i].size(); ++j)
+      batch_solutions.solutions.col(batch_solutions.offsets[i] + static_cast<Eigen::Index>(j)) = pose_solutions[i][j];
+  }
+
+  return batch_solutions;
+}
+
 }  // namespace tesseract_kinematics
 #endif  // TESSERACT_KINEMATICS_UTILS_H
@@ -0,0 +1,171 @@
+/**
+ * @file create_reachability_map.cpp
+ * @brief This creates a reachability map of a kinematic group and saves it to a file
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <iostream>
+#include <console_bridge/console.h>
+#include <boost/program_options.hpp>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/serialization.h>
+#include <tesseract_common/utils.h>
+#include <tesseract_scene_graph/graph.h>
+#include <tesseract_state_solver/kdl/kdl_state_solver.h>
+#include <tesseract_kinematics/core/kinematic_group.h>
+#include <tesseract_kinematics/core/kinematics_plugin_factory.h>
+#include <tesseract_kinematics/core/reachability_map.h>
+
+namespace
+{
+const size_t ERROR_IN_COMMAND_LINE = 1;
+const size_t SUCCESS = 0;
+const size_t ERROR_UNHANDLED_EXCEPTION = 2;
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  std::string scene_graph_path;
+  std::string kinematics_config_path;
+  std::string group_name;
+  std::string solver_name;
+  std::string working_frame;
+  std::string tip_link_name;
+  std::string output;
+  tesseract_kinematics::ReachabilityMapConfig config;
+
+  namespace po = boost::program_options;
+  po::options_description desc("Options");
+  desc.add_options()("help,h", "Print help messages")(
+      "scene_graph,s",
+      po::value<std::string>(&scene_graph_path)->required(),
+      "File path to a serialized scene graph, a file with the .xml extension is read as an xml archive otherwise as a "
+      "binary archive.")("kinematics_config,k",
+                         po::value<std::string>(&kinematics_config_path)->required(),
+                         "File path to the kinematics plugin config used to create the inverse kinematics solver.")(
+      "group,g", po::value<std::string>(&group_name)->required(), "Name of the kinematic group.")(
+      "solver",
+      po::value<std::string>(&solver_name),
+      "Name of the inverse kinematics solver, the default solver of the group if empty.")(
+      "working_frame,w",
+      po::value<std::string>(&working_frame),
+      "Frame the map is relative to, the working frame of the solver if empty.")(
+      "tip_link,t",
+      po::value<std::string>(&tip_link_name),
+      "Tip link to sample, the first tip link of the solver if empty.")(
+      "output,o", po::value<std::string>(&output)->required(), "File path to save the generated reachability map.")(
+      "resolution,r", po::value<double>(&config.resolution), "Edge length of a voxel.")(
+      "fk_samples,f", po::value<std::size_t>(&config.fk_samples), "Number of random joint states sampled.")(
+      "ik_samples,i",
+      po::value<std::size_t>(&config.ik_samples),
+      "Number of rotations about the approach axis tried when solving inverse kinematics for the orientations not "
+      "covered by the samples, zero skips solving inverse kinematics.")(
+      "threads,n",
+      po::value<std::size_t>(&config.num_threads),
+      "Number of threads, zero uses the hardware concurrency.")(
+      "seed", po::value<unsigned>(&config.seed), "Seed of the random joint states.");
+
+  po::variables_map vm;
+  try
+  {
+    po::store(po::parse_command_line(argc, argv, desc), vm);  // can throw
+
+    /** --help option */
+    if (vm.count("help") != 0U)
+    {
+      std::cout << "Basic Command Line Parameter App" << std::endl << desc << std::endl;
+      return SUCCESS;
+    }
+
+    po::notify(vm);  // throws on error, so do after help in case
+                     // there are any problems
+  }
+  catch (po::error& e)
+  {
+    std::cerr << "ERROR: " << e.what() << std::endl << std::endl;
+    std::cerr << desc << std::endl;
+    return ERROR_IN_COMMAND_LINE;
+  }
+
+  try
+  {
+    if (!tesseract_common::fs::is_regular_file(scene_graph_path))
+    {
+      CONSOLE_BRIDGE_logError("Failed to locate scene graph file!");
+      return ERROR_UNHANDLED_EXCEPTION;
+    }
+
+    tesseract_scene_graph::SceneGraph scene_graph =
+        (tesseract_common::fs::path(scene_graph_path).extension() == ".xml") ?
+            tesseract_common::Serialization::fromArchiveFileXML<tesseract_scene_graph::SceneGraph>(scene_graph_path) :
+            tesseract_common::Serialization::fromArchiveFileBinary<tesseract_scene_graph::SceneGraph>(scene_graph_path);
+
+    tesseract_scene_graph::KDLStateSolver state_solver(scene_graph);
+    tesseract_scene_graph::SceneState scene_state = state_solver.getState();
+
+    tesseract_kinematics::KinematicsPluginFactory factory(tesseract_common::fs::path{ kinematics_config_path });
+    if (solver_name.empty())
+      solver_name = factory.getDefaultInvKinPlugin(group_name);
+
+    tesseract_kinematics::InverseKinematics::UPtr inv_kin =
+        factory.createInvKin(group_name, solver_name, scene_graph, scene_state);
+    if (inv_kin == nullptr)
+    {
+      CONSOLE_BRIDGE_logError("Failed to create inverse kinematics solver '%s' for group '%s'!",
+                              solver_name.c_str(),
+                              group_name.c_str());
+      return ERROR_UNHANDLED_EXCEPTION;
+    }
+
+    if (working_frame.empty())
+      working_frame = inv_kin->getWorkingFrame();
+
+    if (tip_link_name.empty())
+      tip_link_name = inv_kin->getTipLinkNames().front();
+
+    std::vector<std::string> joint_names = inv_kin->getJointNames();
+    tesseract_kinematics::KinematicGroup kin_group(
+        group_name, joint_names, std::move(inv_kin), scene_graph, scene_state);
+
+    const tesseract_kinematics::ReachabilityMap map =
+        tesseract_kinematics::ReachabilityMap::create(kin_group, working_frame, tip_link_name, config);
+    CONSOLE_BRIDGE_logInform("Created reachability map with %zu reachable voxels", map.getReachableVoxelCount());
+
+    if (!map.saveFile(output))
+    {
+      CONSOLE_BRIDGE_logError("Failed to write reachability map to file!");
+      return ERROR_UNHANDLED_EXCEPTION;
+    }
+  }
+  catch (const std::exception& e)
+  {
+    CONSOLE_BRIDGE_logError("Failed to create reachability map!");
+    tesseract_common::printNestedException(e);
+    return ERROR_UNHANDLED_EXCEPTION;
+  }
+
+  return 0;
+}
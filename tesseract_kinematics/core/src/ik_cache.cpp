@@ -0,0 +1,170 @@
+/**
+ * @file ik_cache.cpp
+ * @brief A least recently used cache of inverse kinematics solutions
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_kinematics/core/ik_cache.h>
+
+namespace tesseract_kinematics
+{
+/** @brief Append the value quantized by the step to the key */
+static void appendQuantized(std::string& key, double value, double step)
+{
+  const auto quantized = static_cast<std::int64_t>(std::llround(value / step));
+  key.append(reinterpret_cast<const char*>(&quantized), sizeof(quantized));  // NOLINT
+}
+
+IKCache::IKCache(IKCacheConfig config) : config_(config)
+{
+  if (config_.position_tolerance <= 0 || config_.orientation_tolerance <= 0 || config_.seed_tolerance <= 0)
+    throw std::runtime_error("IKCache, the tolerances must be greater than zero!");
+
+  if (config_.shard_count == 0)
+    throw std::runtime_error("IKCache, the shard count must be greater than zero!");
+
+  shard_capacity_ = (config_.capacity + config_.shard_count - 1) / config_.shard_count;
+  shards_ = std::vector<Shard>(config_.shard_count);
+}
+
+const IKCacheConfig& IKCache::getConfig() const { return config_; }
+
+void IKCache::appendName(std::string& key, const std::string& name) const
+{
+  key.append(name);
+  key.push_back('\0');
+}
+
+void IKCache::appendPose(std::string& key, const Eigen::Isometry3d& pose) const
+{
+  for (Eigen::Index i = 0; i < 3; ++i)
+    appendQuantized(key, pose.translation()(i), config_.position_tolerance);
+
+  // A rotation is represented by two quaternions, use the one with a positive scalar part
+  Eigen::Quaterniond q(pose.rotation());
+  if (q.w() < 0)
+    q.coeffs() *= -1;
+
+  for (Eigen::Index i = 0; i < 4; ++i)
+    appendQuantized(key, q.coeffs()(i), config_.orientation_tolerance);
+}
+
+void IKCache::appendSeed(std::string& key, const Eigen::Ref<const Eigen::VectorXd>& seed) const
+{
+  for (Eigen::Index i = 0; i < seed.size(); ++i)
+    appendQuantized(key, seed(i), config_.seed_tolerance);
+}
+
+bool IKCache::get(IKSolutions& solutions, const std::string& key, int revision)
+{
+  Shard& shard = getShard(key);
+  std::scoped_lock lock(shard.mutex);
+  auto it = shard.lookup.find(key);
+  if (revision != revision_ || it == shard.lookup.end())
+  {
+    ++misses_;
+    return false;
+  }
+
+  // Move the entry to the front of the list, this does not invalidate the iterators
+  shard.entries.splice(shard.entries.begin(), shard.entries, it->second);
+  solutions = it->second->second;
+  ++hits_;
+  return true;
+}
+
+void IKCache::put(const std::string& key, int revision, IKSolutions solutions)
+{
+  if (shard_capacity_ == 0)
+    return;
+
+  // The revision is checked while holding the lock so entries of an outdated revision can not be added after the
+  // shard was cleared by setRevision
+  Shard& shard = getShard(key);
+  std::scoped_lock lock(shard.mutex);
+  if (revision != revision_)
+    return;
+
+  auto it = shard.lookup.find(key);
+  if (it != shard.lookup.end())
+  {
+    it->second->second = std::move(solutions);
+    shard.entries.splice(shard.entries.begin(), shard.entries, it->second);
+    return;
+  }
+
+  if (shard.entries.size() >= shard_capacity_)
+  {
+    shard.lookup.erase(shard.entries.back().first);
+    shard.entries.pop_back();
+  }
+
+  shard.entries.emplace_front(key, std::move(solutions));
+  shard.lookup[key] = shard.entries.begin();
+}
+
+void IKCache::setRevision(int revision)
+{
+  if (revision_.exchange(revision) != revision)
+    clear();
+}
+
+int IKCache::getRevision() const { return revision_; }
+
+void IKCache::clear()
+{
+  for (auto& shard : shards_)
+  {
+    std::scoped_lock lock(shard.mutex);
+    shard.entries.clear();
+    shard.lookup.clear();
+  }
+}
+
+std::size_t IKCache::size() const
+{
+  std::size_t size{ 0 };
+  for (const auto& shard : shards_)
+  {
+    std::scoped_lock lock(shard.mutex);
+    size += shard.entries.size();
+  }
+  return size;
+}
+
+std::size_t IKCache::getHitCount() const { return hits_; }
+
+std::size_t IKCache::getMissCount() const { return misses_; }
+
+IKCache::Shard& IKCache::getShard(const std::string& key)
+{
+  return shards_[std::hash<std::string>{}(key) % shards_.size()];
+}
+
+}  // namespace tesseract_kinematics
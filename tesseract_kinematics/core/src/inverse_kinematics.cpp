@@ -0,0 +1,51 @@
+/**
+ * @file inverse_kinematics.cpp
+ * @brief Inverse kinematics functions.
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_kinematics/core/inverse_kinematics.h>
+#include <tesseract_kinematics/core/utils.h>
+
+namespace tesseract_kinematics
+{
+IKBatchSolutions InverseKinematics::calcInvKinBatch(const tesseract_common::VectorIsometry3d& tip_link_poses,
+                                                    const Eigen::Ref<const Eigen::VectorXd>& seed) const
+{
+  const std::vector<std::string> tip_link_names = getTipLinkNames();
+  assert(tip_link_names.size() == 1);
+
+  std::vector<IKSolutions> pose_solutions;
+  pose_solutions.reserve(tip_link_poses.size());
+
+  tesseract_common::TransformMap ik_inputs;
+  Eigen::Isometry3d& ik_input = ik_inputs[tip_link_names.front()];
+  for (const auto& pose : tip_link_poses)
+  {
+    ik_input = pose;
+    pose_solutions.push_back(calcInvKin(ik_inputs, seed));
+  }
+
+  return toIKBatchSolutions(pose_solutions, numJoints());
+}
+}  // namespace tesseract_kinematics
@@ -30,6 +30,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_kinematics/core/joint_group.h>
 #include <tesseract_common/utils.h>
+#include <tesseract_common/metrics.h>
 
 #include <tesseract_scene_graph/kdl_parser.h>
 
@@ -114,6 +115,7 @@ JointGroup& JointGroup::operator=(const JointGroup& other)
 
 tesseract_common::TransformMap JointGroup::calcFwdKin(const Eigen::Ref<const Eigen::VectorXd>& joint_angles) const
 {
+  TESSERACT_COMMON_METRICS_SCOPE("JointGroup::calcFwdKin");
   tesseract_common::TransformMap state = state_solver_->getState(joint_names_, joint_angles).link_transforms;
   state.insert(static_link_transforms_.begin(), static_link_transforms_.end());
   return state;
@@ -122,6 +124,7 @@ tesseract_common::TransformMap JointGroup::calcFwdKin(const Eigen::Ref<const Eig
 Eigen::MatrixXd JointGroup::calcJacobian(const Eigen::Ref<const Eigen::VectorXd>& joint_angles,
                                          const std::string& link_name) const
 {
+  TESSERACT_COMMON_METRICS_SCOPE("JointGroup::calcJacobian");
   Eigen::MatrixXd solver_jac = state_solver_->getJacobian(joint_names_, joint_angles, link_name);
 
   Eigen::MatrixXd kin_jac(6, numJoints());
@@ -153,6 +156,7 @@ Eigen::MatrixXd JointGroup::calcJacobian(const Eigen::Ref<const Eigen::VectorXd>
   if (base_link_name == getBaseLinkName())
     return calcJacobian(joint_angles, link_name);
 
+  TESSERACT_COMMON_METRICS_SCOPE("JointGroup::calcJacobian");
   Eigen::MatrixXd solver_jac = state_solver_->getJacobian(joint_names_, joint_angles, link_name);
 
   Eigen::MatrixXd kin_jac(6, numJoints());
@@ -192,6 +196,7 @@ Eigen::MatrixXd JointGroup::calcJacobian(const Eigen::Ref<const Eigen::VectorXd>
   if (base_link_name == getBaseLinkName())
     return calcJacobian(joint_angles, link_name, link_point);
 
+  TESSERACT_COMMON_METRICS_SCOPE("JointGroup::calcJacobian");
   Eigen::MatrixXd solver_jac = state_solver_->getJacobian(joint_names_, joint_angles, link_name);
 
   Eigen::MatrixXd kin_jac(6, numJoints());
@@ -31,6 +31,8 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract_kinematics/core/kinematic_group.h>
 #include <tesseract_kinematics/core/utils.h>
 #include <tesseract_common/utils.h>
+#include <tesseract_common/metrics.h>
+#include <tesseract_common/parallel_for.h>
 
 #include <tesseract_scene_graph/kdl_parser.h>
 
@@ -106,12 +108,16 @@ KinematicGroup& KinematicGroup::operator=(const KinematicGroup& other)
   inv_to_fwd_base_ = other.inv_to_fwd_base_;
   working_frames_ = other.working_frames_;
   inv_tip_links_map_ = other.inv_tip_links_map_;
+  ik_cache_ = other.ik_cache_;
+  ik_cache_revision_ = other.ik_cache_revision_;
   return *this;
 }
 
 IKSolutions KinematicGroup::calcInvKin(const KinGroupIKInputs& tip_link_poses,
                                        const Eigen::Ref<const Eigen::VectorXd>& seed) const
 {
+  TESSERACT_COMMON_METRICS_SCOPE("KinematicGroup::calcInvKin");
+
   // Convert to IK Inputs
   tesseract_common::TransformMap ik_inputs;
   for (const auto& tip_link_pose : tip_link_poses)
@@ -120,62 +126,36 @@ IKSolutions KinematicGroup::calcInvKin(const KinGroupIKInputs& tip_link_poses,
            working_frames_.end());
     assert(std::abs(1.0 - tip_link_pose.pose.matrix().determinant()) < 1e-6);  // NOLINT
 
-    // The IK Solvers tip link and working frame
-    std::string ik_solver_tip_link = inv_tip_links_map_.at(tip_link_pose.tip_link_name);
-    std::string working_frame = inv_kin_->getWorkingFrame();
-
-    // Get transform from working frame to user working frame (reference frame for the target IK pose)
-    const Eigen::Isometry3d& world_to_user_wf = state_.link_transforms.at(tip_link_pose.working_frame);
-    const Eigen::Isometry3d& world_to_wf = state_.link_transforms.at(working_frame);
-    const Eigen::Isometry3d wf_to_user_wf = world_to_wf.inverse() * world_to_user_wf;
-
-    // Get the transform from IK solver tip link to the user tip link
-    const Eigen::Isometry3d& world_to_user_tl = state_.link_transforms.at(tip_link_pose.tip_link_name);
-    const Eigen::Isometry3d& world_to_tl = state_.link_transforms.at(ik_solver_tip_link);
-    const Eigen::Isometry3d tl_to_user_tl = world_to_tl.inverse() * world_to_user_tl;
+    // The IK Solvers tip link
+    const std::string& ik_solver_tip_link = inv_tip_links_map_.at(tip_link_pose.tip_link_name);
 
     // Get the transformation from the IK solver working frame to the IK solver tip frame
-    const Eigen::Isometry3d& user_wf_to_user_tl = tip_link_pose.pose;  // an unnecessary but helpful alias
-    const Eigen::Isometry3d wf_to_tl = wf_to_user_wf * user_wf_to_user_tl * tl_to_user_tl.inverse();
-
-    ik_inputs[ik_solver_tip_link] = wf_to_tl;
+    ik_inputs[ik_solver_tip_link] = calcWorkingFrameOffset(tip_link_pose.working_frame) * tip_link_pose.pose *
+                                    calcTipLinkOffset(tip_link_pose.tip_link_name);
   }
 
-  // format seed for inverse kinematic solver
-  if (reorder_required_)
-  {
-    Eigen::VectorXd ordered_seed = seed;
-    for (Eigen::Index i = 0; i < inv_kin_->numJoints(); ++i)
-      ordered_seed(inv_kin_joint_map_[static_cast<std::size_t>(i)]) = seed(i);
-
-    IKSolutions solutions = inv_kin_->calcInvKin(ik_inputs, ordered_seed);
-    IKSolutions solutions_filtered;
-    solutions_filtered.reserve(solutions.size());
-    for (const auto& solution : solutions)
-    {
-      Eigen::VectorXd ordered_sol = solution;
-      for (Eigen::Index i = 0; i < inv_kin_->numJoints(); ++i)
-        ordered_sol(i) = solution(inv_kin_joint_map_[static_cast<std::size_t>(i)]);
-
-      tesseract_kinematics::harmonizeTowardMedian<double>(ordered_sol, redundancy_indices_, limits_.joint_limits);
-      if (tesseract_common::satisfiesPositionLimits<double>(ordered_sol, limits_.joint_limits))
-        solutions_filtered.push_back(ordered_sol);
-    }
+  if (ik_cache_ == nullptr)
+    return calcInvKinHelper(*inv_kin_, ik_inputs, seed);
 
-    return solutions_filtered;
+  std::string key;
+  ik_cache_->appendName(key, name_);
+  ik_cache_->appendName(key, inv_kin_->getSolverName());
+  for (const auto& tip_link_pose : tip_link_poses)
+  {
+    ik_cache_->appendName(key, tip_link_pose.working_frame);
+    ik_cache_->appendName(key, tip_link_pose.tip_link_name);
+    ik_cache_->appendPose(key, tip_link_pose.pose);
   }
+  ik_cache_->appendSeed(key, seed);
 
-  IKSolutions solutions = inv_kin_->calcInvKin(ik_inputs, seed);
-  IKSolutions solutions_filtered;
-  solutions_filtered.reserve(solutions.size());
-  for (auto& solution : solutions)
+  IKSolutions solutions;
+  if (!ik_cache_->get(solutions, key, ik_cache_revision_))
   {
-    tesseract_kinematics::harmonizeTowardMedian<double>(solution, redundancy_indices_, limits_.joint_limits);
-    if (tesseract_common::satisfiesPositionLimits<double>(solution, limits_.joint_limits))
-      solutions_filtered.push_back(solution);
+    solutions = inv_kin_->calcInvKin(ik_inputs, toSolverJointOrder(seed));
+    ik_cache_->put(key, ik_cache_revision_, solutions);
   }
 
-  return solutions_filtered;
+  return processSolutions(std::move(solutions));
 }
 
 IKSolutions KinematicGroup::calcInvKin(const KinGroupIKInput& tip_link_pose,
@@ -184,6 +164,91 @@ IKSolutions KinematicGroup::calcInvKin(const KinGroupIKInput& tip_link_pose,
   return calcInvKin(KinGroupIKInputs{ tip_link_pose }, seed);  // NOLINT
 }
 
+KinGroupIKBatchSolutions KinematicGroup::calcInvKinBatch(const tesseract_common::VectorIsometry3d& poses,
+                                                         const std::string& working_frame,
+                                                         const std::string& tip_link_name,
+                                                         const Eigen::Ref<const Eigen::VectorXd>& seed,
+                                                         const KinGroupIKBatchConfig& config) const
+{
+  TESSERACT_COMMON_METRICS_SCOPE("KinematicGroup::calcInvKinBatch");
+  assert(std::find(working_frames_.begin(), working_frames_.end(), working_frame) != working_frames_.end());
+
+  // The IK solvers tip link and the transforms to the IK solver frames are the same for every pose
+  const std::string& ik_solver_tip_link = inv_tip_links_map_.at(tip_link_name);
+  const Eigen::Isometry3d wf_to_user_wf = calcWorkingFrameOffset(working_frame);
+  const Eigen::Isometry3d user_tl_to_tl = calcTipLinkOffset(tip_link_name);
+
+  const std::size_t num_threads = tesseract_common::getParallelThreadCount(config.num_threads, poses.size());
+
+  // When propagating the seed every thread solves a single contiguous block of poses, otherwise every block is solved
+  // by a single call to the solver and a few blocks per thread are used to balance the load
+  const std::size_t num_blocks_target = num_threads * ((config.propagate_seed) ? 1 : 4);
+  const std::size_t block_size = std::max<std::size_t>((poses.size() + num_blocks_target - 1) / num_blocks_target, 1);
+  const std::size_t num_blocks = (poses.size() + block_size - 1) / block_size;
+  const Eigen::VectorXd solver_seed = toSolverJointOrder(seed);
+
+  // The inverse kinematics solvers are not required to be thread safe so every thread uses its own clone
+  std::vector<InverseKinematics::UPtr> inv_kins;
+  if (num_threads > 1)
+  {
+    inv_kins.reserve(num_threads);
+    for (std::size_t i = 0; i < num_threads; ++i)
+      inv_kins.push_back(inv_kin_->clone());
+  }
+
+  std::vector<IKSolutions> pose_solutions(poses.size());
+  tesseract_common::parallelFor(num_blocks, num_threads, [&](std::size_t b, std::size_t thread_index) {
+    const InverseKinematics& inv_kin = (inv_kins.empty()) ? *inv_kin_ : *inv_kins[thread_index];
+    const std::size_t begin = b * block_size;
+    const std::size_t end = std::min(begin + block_size, poses.size());
+    if (!config.propagate_seed)
+    {
+      tesseract_common::VectorIsometry3d block_poses;
+      block_poses.reserve(end - begin);
+      for (std::size_t i = begin; i < end; ++i)
+      {
+        assert(std::abs(1.0 - poses[i].matrix().determinant()) < 1e-6);  // NOLINT
+        block_poses.push_back(wf_to_user_wf * poses[i] * user_tl_to_tl);
+      }
+
+      IKBatchSolutions block_solutions = inv_kin.calcInvKinBatch(block_poses, solver_seed);
+      for (std::size_t i = 0; i < block_poses.size(); ++i)
+      {
+        IKSolutions& solutions = pose_solutions[begin + i];
+        solutions.reserve(static_cast<std::size_t>(block_solutions.getSolutionCount(i)));
+        for (Eigen::Index j = 0; j < block_solutions.getSolutionCount(i); ++j)
+        {
+          Eigen::VectorXd solution = block_solutions.getSolutions(i).col(j);
+          if (processSolution(solution))
+            solutions.push_back(solution);
+        }
+      }
+      return;
+    }
+
+    tesseract_common::TransformMap ik_inputs;
+    Eigen::Isometry3d& ik_input = ik_inputs[ik_solver_tip_link];
+    Eigen::VectorXd pose_seed = seed;
+    for (std::size_t i = begin; i < end; ++i)
+    {
+      assert(std::abs(1.0 - poses[i].matrix().determinant()) < 1e-6);  // NOLINT
+      ik_input = wf_to_user_wf * poses[i] * user_tl_to_tl;
+      pose_solutions[i] = calcInvKinHelper(inv_kin, ik_inputs, pose_seed);
+
+      if (!pose_solutions[i].empty())
+      {
+        pose_seed = *std::min_element(pose_solutions[i].begin(),
+                                      pose_solutions[i].end(),
+                                      [&pose_seed](const Eigen::VectorXd& a, const Eigen::VectorXd& b) {
+                                        return (a - pose_seed).squaredNorm() < (b - pose_seed).squaredNorm();
+                                      });
+      }
+    }
+  });
+
+  return toIKBatchSolutions(pose_solutions, numJoints());
+}
+
 std::vector<std::string> KinematicGroup::getAllValidWorkingFrames() const { return working_frames_; }
 
 std::vector<std::string> KinematicGroup::getAllPossibleTipLinkNames() const
@@ -195,4 +260,74 @@ std::vector<std::string> KinematicGroup::getAllPossibleTipLinkNames() const
 
   return ik_tip_links;
 }
+
+void KinematicGroup::setIKCache(IKCache::Ptr cache, int revision)
+{
+  ik_cache_ = std::move(cache);
+  ik_cache_revision_ = revision;
+}
+
+IKCache::Ptr KinematicGroup::getIKCache() const { return ik_cache_; }
+
+Eigen::Isometry3d KinematicGroup::calcWorkingFrameOffset(const std::string& working_frame) const
+{
+  // Get transform from working frame to user working frame (reference frame for the target IK pose)
+  const Eigen::Isometry3d& world_to_user_wf = state_.link_transforms.at(working_frame);
+  const Eigen::Isometry3d& world_to_wf = state_.link_transforms.at(inv_kin_->getWorkingFrame());
+  return world_to_wf.inverse() * world_to_user_wf;
+}
+
+Eigen::Isometry3d KinematicGroup::calcTipLinkOffset(const std::string& tip_link_name) const
+{
+  // Get the transform from IK solver tip link to the user tip link
+  const Eigen::Isometry3d& world_to_user_tl = state_.link_transforms.at(tip_link_name);
+  const Eigen::Isometry3d& world_to_tl = state_.link_transforms.at(inv_tip_links_map_.at(tip_link_name));
+  const Eigen::Isometry3d tl_to_user_tl = world_to_tl.inverse() * world_to_user_tl;
+  return tl_to_user_tl.inverse();
+}
+
+IKSolutions KinematicGroup::calcInvKinHelper(const InverseKinematics& inv_kin,
+                                             const tesseract_common::TransformMap& ik_inputs,
+                                             const Eigen::Ref<const Eigen::VectorXd>& seed) const
+{
+  return processSolutions(inv_kin.calcInvKin(ik_inputs, toSolverJointOrder(seed)));
+}
+
+IKSolutions KinematicGroup::processSolutions(IKSolutions solutions) const
+{
+  IKSolutions solutions_filtered;
+  solutions_filtered.reserve(solutions.size());
+  for (auto& solution : solutions)
+  {
+    if (processSolution(solution))
+      solutions_filtered.push_back(solution);
+  }
+
+  return solutions_filtered;
+}
+
+Eigen::VectorXd KinematicGroup::toSolverJointOrder(const Eigen::Ref<const Eigen::VectorXd>& seed) const
+{
+  if (!reorder_required_)
+    return seed;
+
+  Eigen::VectorXd ordered_seed = seed;
+  for (Eigen::Index i = 0; i < seed.size(); ++i)
+    ordered_seed(inv_kin_joint_map_[static_cast<std::size_t>(i)]) = seed(i);
+
+  return ordered_seed;
+}
+
+bool KinematicGroup::processSolution(Eigen::VectorXd& solution) const
+{
+  if (reorder_required_)
+  {
+    const Eigen::VectorXd solver_solution = solution;
+    for (Eigen::Index i = 0; i < solution.size(); ++i)
+      solution(i) = solver_solution(inv_kin_joint_map_[static_cast<std::size_t>(i)]);
+  }
+
+  tesseract_kinematics::harmonizeTowardMedian<double>(solution, redundancy_indices_, limits_.joint_limits);
+  return tesseract_common::satisfiesPositionLimits<double>(solution, limits_.joint_limits);
+}
 }  // namespace tesseract_kinematics
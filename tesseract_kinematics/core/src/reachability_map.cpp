@@ -0,0 +1,464 @@
+/**
+ * @file reachability_map.cpp
+ * @brief A voxelized reachability map of a kinematic group
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <bitset>
+#include <fstream>
+#include <limits>
+#include <random>
+#include <console_bridge/console.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/parallel_for.h>
+#include <tesseract_common/utils.h>
+#include <tesseract_kinematics/core/reachability_map.h>
+#include <tesseract_kinematics/core/kinematic_group.h>
+
+namespace tesseract_kinematics
+{
+namespace
+{
+const std::string REACHABILITY_MAP_HEADER = "tesseract_reachability_map_1\n";
+
+/** @brief The approach direction bins evenly distributed on the unit sphere using a Fibonacci lattice */
+const std::array<Eigen::Vector3d, ReachabilityMap::ORIENTATION_BIN_COUNT>& getOrientationBins()
+{
+  static const std::array<Eigen::Vector3d, ReachabilityMap::ORIENTATION_BIN_COUNT> bins = []() {
+    std::array<Eigen::Vector3d, ReachabilityMap::ORIENTATION_BIN_COUNT> directions;
+    const double golden_angle = M_PI * (3.0 - std::sqrt(5.0));
+    const auto n = static_cast<double>(ReachabilityMap::ORIENTATION_BIN_COUNT);
+    for (std::size_t i = 0; i < directions.size(); ++i)
+    {
+      const double z = 1.0 - ((2.0 * static_cast<double>(i) + 1.0) / n);
+      const double r = std::sqrt(1.0 - (z * z));
+      const double theta = golden_angle * static_cast<double>(i);
+      directions[i] = Eigen::Vector3d(r * std::cos(theta), r * std::sin(theta), z);
+    }
+    return directions;
+  }();
+
+  return bins;
+}
+
+template <typename T>
+void writeBinary(std::ofstream& os, const T& value)
+{
+  os.write(reinterpret_cast<const char*>(&value), sizeof(T));  // NOLINT
+}
+
+template <typename T>
+bool readBinary(std::ifstream& is, T& value)
+{
+  return static_cast<bool>(is.read(reinterpret_cast<char*>(&value), sizeof(T)));  // NOLINT
+}
+
+void writeString(std::ofstream& os, const std::string& value)
+{
+  writeBinary(os, static_cast<std::uint64_t>(value.size()));
+  os.write(value.data(), static_cast<std::streamsize>(value.size()));
+}
+
+/** @brief Get the number of bytes between the read position and the end of the file */
+std::uint64_t getRemainingBytes(std::ifstream& is)
+{
+  const std::streampos position = is.tellg();
+  if (position < 0)
+    return 0;
+
+  is.seekg(0, std::ios::end);
+  const std::streampos end = is.tellg();
+  is.seekg(position);
+  return (end < position) ? 0 : static_cast<std::uint64_t>(end - position);
+}
+
+bool readString(std::ifstream& is, std::string& value)
+{
+  std::uint64_t size{ 0 };
+  if (!readBinary(is, size) || size > 4096 || size > getRemainingBytes(is))
+    return false;
+
+  value.resize(static_cast<std::size_t>(size));
+  return static_cast<bool>(is.read(value.data(), static_cast<std::streamsize>(size)));
+}
+}  // namespace
+
+ReachabilityMap::ReachabilityMap(std::string working_frame,
+                                 std::string tip_link_name,
+                                 const Eigen::Vector3d& origin,
+                                 double resolution,
+                                 const std::array<std::size_t, 3>& size)
+  : working_frame_(std::move(working_frame))
+  , tip_link_name_(std::move(tip_link_name))
+  , origin_(origin)
+  , resolution_(resolution)
+  , size_(size)
+  , voxels_(size[0] * size[1] * size[2], 0)
+{
+  if (!(resolution_ > 0))
+    throw std::runtime_error("ReachabilityMap, resolution must be greater than zero");
+}
+
+ReachabilityMap ReachabilityMap::create(const KinematicGroup& kin_group,
+                                        const std::string& working_frame,
+                                        const std::string& tip_link_name,
+                                        const ReachabilityMapConfig& config)
+{
+  if (!(config.resolution > 0))
+    throw std::runtime_error("ReachabilityMap, resolution must be greater than zero");
+
+  if (config.fk_samples == 0)
+  {
+    CONSOLE_BRIDGE_logWarn("ReachabilityMap, no forward kinematics samples requested so the map is empty");
+    return { working_frame, tip_link_name, Eigen::Vector3d::Zero(), config.resolution, { 0, 0, 0 } };
+  }
+
+  const std::size_t num_threads = tesseract_common::getParallelThreadCount(config.num_threads, config.fk_samples);
+
+  // Sample forward kinematics in a chunk per thread, every chunk uses its own copy of the kinematic group and random
+  // number generator so the samples only depend on the seed and the number of threads
+  const Eigen::MatrixX2d joint_limits = kin_group.getLimits().joint_limits;
+  std::vector<tesseract_common::VectorIsometry3d> thread_poses(num_threads);
+  tesseract_common::parallelFor(num_threads, num_threads, [&](std::size_t t, std::size_t /*thread_index*/) {
+    KinematicGroup thread_kin_group(kin_group);
+    std::mt19937 generator(config.seed + static_cast<unsigned>(t));
+    std::uniform_real_distribution<double> distribution(0.0, 1.0);
+
+    const std::size_t begin = (config.fk_samples * t) / num_threads;
+    const std::size_t end = (config.fk_samples * (t + 1)) / num_threads;
+    thread_poses[t].reserve(end - begin);
+
+    Eigen::VectorXd joint_values(joint_limits.rows());
+    for (std::size_t i = begin; i < end; ++i)
+    {
+      for (Eigen::Index j = 0; j < joint_limits.rows(); ++j)
+        joint_values(j) = joint_limits(j, 0) + (distribution(generator) * (joint_limits(j, 1) - joint_limits(j, 0)));
+
+      tesseract_common::TransformMap poses = thread_kin_group.calcFwdKin(joint_values);
+      thread_poses[t].push_back(poses.at(working_frame).inverse() * poses.at(tip_link_name));
+    }
+  });
+
+  // The bounds of the map are the bounds of the samples
+  Eigen::Vector3d min_position = Eigen::Vector3d::Constant(std::numeric_limits<double>::max());
+  Eigen::Vector3d max_position = Eigen::Vector3d::Constant(std::numeric_limits<double>::lowest());
+  for (const auto& poses : thread_poses)
+  {
+    for (const auto& pose : poses)
+    {
+      min_position = min_position.cwiseMin(pose.translation());
+      max_position = max_position.cwiseMax(pose.translation());
+    }
+  }
+
+  std::array<std::size_t, 3> size{ 0, 0, 0 };
+  for (std::size_t i = 0; i < 3; ++i)
+  {
+    const auto axis = static_cast<Eigen::Index>(i);
+    size[i] = static_cast<std::size_t>(std::floor((max_position(axis) - min_position(axis)) / config.resolution)) + 1;
+  }
+
+  ReachabilityMap map(working_frame, tip_link_name, min_position, config.resolution, size);
+  for (const auto& poses : thread_poses)
+  {
+    for (const auto& pose : poses)
+      map.addPose(pose);
+  }
+
+  if (config.ik_samples == 0)
+    return map;
+
+  // Solve inverse kinematics at the center of the reachable voxels for the approach directions not sampled. Every
+  // voxel is only modified by the thread which processes it.
+  std::vector<std::size_t> reachable_voxels;
+  reachable_voxels.reserve(map.getReachableVoxelCount());
+  for (std::size_t i = 0; i < map.voxels_.size(); ++i)
+  {
+    if (map.voxels_[i] != 0)
+      reachable_voxels.push_back(i);
+  }
+
+  const Eigen::VectorXd seed = (joint_limits.col(0) + joint_limits.col(1)) / 2.0;
+  std::vector<std::unique_ptr<KinematicGroup>> thread_kin_groups(
+      tesseract_common::getParallelThreadCount(num_threads, reachable_voxels.size()));
+  for (auto& thread_kin_group : thread_kin_groups)
+    thread_kin_group = std::make_unique<KinematicGroup>(kin_group);
+
+  tesseract_common::parallelFor(reachable_voxels.size(), num_threads, [&](std::size_t v, std::size_t thread_index) {
+    const KinematicGroup& thread_kin_group = *thread_kin_groups[thread_index];
+    std::uint32_t& mask = map.voxels_[reachable_voxels[v]];
+    Eigen::Isometry3d pose{ Eigen::Isometry3d::Identity() };
+    pose.translation() = map.getVoxelCenter(reachable_voxels[v]);
+    for (std::size_t bin = 0; bin < ORIENTATION_BIN_COUNT; ++bin)
+    {
+      if ((mask & (1U << bin)) != 0)
+        continue;
+
+      const Eigen::Quaterniond approach =
+          Eigen::Quaterniond::FromTwoVectors(Eigen::Vector3d::UnitZ(), getOrientationBinDirection(bin));
+      for (std::size_t r = 0; r < config.ik_samples; ++r)
+      {
+        const double angle = (2.0 * M_PI * static_cast<double>(r)) / static_cast<double>(config.ik_samples);
+        pose.linear() = (approach * Eigen::AngleAxisd(angle, Eigen::Vector3d::UnitZ())).toRotationMatrix();
+        if (!thread_kin_group.calcInvKin(KinGroupIKInput(pose, working_frame, tip_link_name), seed).empty())
+        {
+          mask |= (1U << bin);
+          break;
+        }
+      }
+    }
+  });
+
+  return map;
+}
+
+void ReachabilityMap::addPose(const Eigen::Isometry3d& pose)
+{
+  const long index = getVoxelIndex(pose.translation());
+  if (index < 0)
+    return;
+
+  voxels_[static_cast<std::size_t>(index)] |= (1U << getOrientationBin(pose.matrix().col(2).head<3>()));
+}
+
+bool ReachabilityMap::isReachable(const Eigen::Vector3d& position) const { return getOrientationMask(position) != 0; }
+
+bool ReachabilityMap::isNearReachable(const Eigen::Vector3d& position, std::size_t dilation) const
+{
+  // Get the range of voxels within the dilation of the voxel containing the position, clipped to the map
+  std::array<std::size_t, 3> begin{ 0, 0, 0 };
+  std::array<std::size_t, 3> end{ 0, 0, 0 };
+  for (std::size_t i = 0; i < 3; ++i)
+  {
+    const auto axis = static_cast<Eigen::Index>(i);
+    const double value = std::floor((position(axis) - origin_(axis)) / resolution_);
+    const auto d = static_cast<double>(dilation);
+    if (!(value + d >= 0) || !(value - d < static_cast<double>(size_[i])))
+      return false;
+
+    begin[i] = static_cast<std::size_t>(std::max(value - d, 0.0));
+    end[i] = static_cast<std::size_t>(std::min(value + d + 1, static_cast<double>(size_[i])));
+  }
+
+  for (std::size_t x = begin[0]; x < end[0]; ++x)
+  {
+    for (std::size_t y = begin[1]; y < end[1]; ++y)
+    {
+      for (std::size_t z = begin[2]; z < end[2]; ++z)
+      {
+        if (voxels_[(((x * size_[1]) + y) * size_[2]) + z] != 0)
+          return true;
+      }
+    }
+  }
+
+  return false;
+}
+
+bool ReachabilityMap::isReachable(const Eigen::Isometry3d& pose) const
+{
+  return (getOrientationMask(pose.translation()) & (1U << getOrientationBin(pose.matrix().col(2).head<3>()))) != 0;
+}
+
+std::uint32_t ReachabilityMap::getOrientationMask(const Eigen::Vector3d& position) const
+{
+  const long index = getVoxelIndex(position);
+  return (index < 0) ? 0 : voxels_[static_cast<std::size_t>(index)];
+}
+
+double ReachabilityMap::getOrientationCoverage(const Eigen::Vector3d& position) const
+{
+  const std::bitset<ORIENTATION_BIN_COUNT> mask(getOrientationMask(position));
+  return static_cast<double>(mask.count()) / static_cast<double>(ORIENTATION_BIN_COUNT);
+}
+
+const std::string& ReachabilityMap::getWorkingFrame() const { return working_frame_; }
+
+const std::string& ReachabilityMap::getTipLinkName() const { return tip_link_name_; }
+
+const Eigen::Vector3d& ReachabilityMap::getOrigin() const { return origin_; }
+
+double ReachabilityMap::getResolution() const { return resolution_; }
+
+const std::array<std::size_t, 3>& ReachabilityMap::getSize() const { return size_; }
+
+std::size_t ReachabilityMap::getReachableVoxelCount() const
+{
+  return static_cast<std::size_t>(
+      std::count_if(voxels_.begin(), voxels_.end(), [](std::uint32_t mask) { return mask != 0; }));
+}
+
+std::size_t ReachabilityMap::getOrientationBin(const Eigen::Vector3d& direction)
+{
+  const auto& bins = getOrientationBins();
+  std::size_t closest_bin{ 0 };
+  double closest_dot = std::numeric_limits<double>::lowest();
+  for (std::size_t i = 0; i < bins.size(); ++i)
+  {
+    const double dot = bins[i].dot(direction);
+    if (dot > closest_dot)
+    {
+      closest_dot = dot;
+      closest_bin = i;
+    }
+  }
+  return closest_bin;
+}
+
+const Eigen::Vector3d& ReachabilityMap::getOrientationBinDirection(std::size_t bin)
+{
+  return getOrientationBins().at(bin);
+}
+
+bool ReachabilityMap::saveFile(const tesseract_common::fs::path& file_path) const
+{
+  std::ofstream os(file_path.string(), std::ios::binary | std::ios::trunc);
+  if (!os)
+  {
+    CONSOLE_BRIDGE_logError("ReachabilityMap, failed to open file: %s", file_path.string().c_str());
+    return false;
+  }
+
+  os.write(REACHABILITY_MAP_HEADER.data(), static_cast<std::streamsize>(REACHABILITY_MAP_HEADER.size()));
+  writeString(os, working_frame_);
+  writeString(os, tip_link_name_);
+  for (Eigen::Index i = 0; i < 3; ++i)
+    writeBinary(os, origin_(i));
+  writeBinary(os, resolution_);
+  for (const auto& s : size_)
+    writeBinary(os, static_cast<std::uint64_t>(s));
+  os.write(reinterpret_cast<const char*>(voxels_.data()),  // NOLINT
+           static_cast<std::streamsize>(voxels_.size() * sizeof(std::uint32_t)));
+
+  if (!os)
+  {
+    CONSOLE_BRIDGE_logError("ReachabilityMap, failed to write file: %s", file_path.string().c_str());
+    return false;
+  }
+
+  return true;
+}
+
+bool ReachabilityMap::loadFile(const tesseract_common::fs::path& file_path)
+{
+  std::ifstream is(file_path.string(), std::ios::binary);
+  if (!is)
+  {
+    CONSOLE_BRIDGE_logError("ReachabilityMap, failed to open file: %s", file_path.string().c_str());
+    return false;
+  }
+
+  std::string header(REACHABILITY_MAP_HEADER.size(), '\0');
+  if (!is.read(header.data(), static_cast<std::streamsize>(header.size())) || header != REACHABILITY_MAP_HEADER)
+  {
+    CONSOLE_BRIDGE_logError("ReachabilityMap, file is not a reachability map: %s", file_path.string().c_str());
+    return false;
+  }
+
+  ReachabilityMap map;
+  bool success = readString(is, map.working_frame_) && readString(is, map.tip_link_name_);
+  for (Eigen::Index i = 0; i < 3; ++i)
+    success = success && readBinary(is, map.origin_(i));
+  success = success && readBinary(is, map.resolution_);
+  for (auto& s : map.size_)
+  {
+    std::uint64_t value{ 0 };
+    success = success && readBinary(is, value);
+    s = static_cast<std::size_t>(value);
+  }
+
+  // The size is untrusted so the number of voxels is checked for overflow and against the remaining file size before
+  // allocating them
+  std::uint64_t voxel_count{ 1 };
+  for (const auto& s : map.size_)
+  {
+    if (s != 0 && voxel_count > std::numeric_limits<std::uint64_t>::max() / s)
+      success = false;
+    else
+      voxel_count *= s;
+  }
+
+  const std::uint64_t remaining_bytes = (success) ? getRemainingBytes(is) : 0;
+  if (voxel_count != remaining_bytes / sizeof(std::uint32_t) || (remaining_bytes % sizeof(std::uint32_t)) != 0)
+    success = false;
+
+  if (success)
+  {
+    map.voxels_.resize(static_cast<std::size_t>(voxel_count));
+    success = static_cast<bool>(is.read(reinterpret_cast<char*>(map.voxels_.data()),  // NOLINT
+                                        static_cast<std::streamsize>(map.voxels_.size() * sizeof(std::uint32_t))));
+  }
+
+  if (!success || !(map.resolution_ > 0))
+  {
+    CONSOLE_BRIDGE_logError("ReachabilityMap, failed to read file: %s", file_path.string().c_str());
+    return false;
+  }
+
+  *this = std::move(map);
+  return true;
+}
+
+bool ReachabilityMap::operator==(const ReachabilityMap& rhs) const
+{
+  bool equal = true;
+  equal &= working_frame_ == rhs.working_frame_;
+  equal &= tip_link_name_ == rhs.tip_link_name_;
+  equal &= origin_.isApprox(rhs.origin_);
+  equal &= tesseract_common::almostEqualRelativeAndAbs(resolution_, rhs.resolution_);
+  equal &= size_ == rhs.size_;
+  equal &= voxels_ == rhs.voxels_;
+  return equal;
+}
+
+bool ReachabilityMap::operator!=(const ReachabilityMap& rhs) const { return !operator==(rhs); }
+
+long ReachabilityMap::getVoxelIndex(const Eigen::Vector3d& position) const
+{
+  std::array<std::size_t, 3> index{ 0, 0, 0 };
+  for (std::size_t i = 0; i < 3; ++i)
+  {
+    const auto axis = static_cast<Eigen::Index>(i);
+    const double value = std::floor((position(axis) - origin_(axis)) / resolution_);
+    if (!(value >= 0) || !(value < static_cast<double>(size_[i])))
+      return -1;
+
+    index[i] = static_cast<std::size_t>(value);
+  }
+
+  return static_cast<long>((((index[0] * size_[1]) + index[1]) * size_[2]) + index[2]);
+}
+
+Eigen::Vector3d ReachabilityMap::getVoxelCenter(std::size_t index) const
+{
+  const std::size_t z = index % size_[2];
+  const std::size_t y = (index / size_[2]) % size_[1];
+  const std::size_t x = index / (size_[1] * size_[2]);
+  const Eigen::Vector3d voxel(static_cast<double>(x), static_cast<double>(y), static_cast<double>(z));
+  return origin_ + (resolution_ * (voxel + Eigen::Vector3d::Constant(0.5)));
+}
+
+}  // namespace tesseract_kinematics
@@ -168,6 +168,7 @@ REPInvKin& REPInvKin::operator=(const REPInvKin& other)
   manip_tip_link_ = other.manip_tip_link_;
   dof_ = other.dof_;
   dof_range_ = other.dof_range_;
+  reachability_map_ = other.reachability_map_;
 
   return *this;
 }
@@ -214,6 +215,9 @@ void REPInvKin::ikAt(IKSolutions& solutions,
   if (robot_target_pose.translation().norm() > manip_reach_)
     return;
 
+  if (reachability_map_ != nullptr && !reachability_map_->isNearReachable(robot_target_pose.translation()))
+    return;
+
   tesseract_common::TransformMap robot_target_poses{ std::make_pair(manip_tip_link_, robot_target_pose) };
   auto robot_dof = static_cast<Eigen::Index>(manip_inv_kin_->numJoints());
   auto positioner_dof = static_cast<Eigen::Index>(positioner_pose.size());
@@ -254,4 +258,16 @@ std::vector<std::string> REPInvKin::getTipLinkNames() const { return { manip_tip
 
 std::string REPInvKin::getSolverName() const { return solver_name_; }
 
+void REPInvKin::setReachabilityMap(ReachabilityMap::ConstPtr reachability_map)
+{
+  if (reachability_map != nullptr && (reachability_map->getWorkingFrame() != manip_inv_kin_->getWorkingFrame() ||
+                                      reachability_map->getTipLinkName() != manip_tip_link_))
+    throw std::runtime_error("REPInvKin, reachability map must be relative to the manipulator working frame and "
+                             "tip link");
+
+  reachability_map_ = std::move(reachability_map);
+}
+
+ReachabilityMap::ConstPtr REPInvKin::getReachabilityMap() const { return reachability_map_; }
+
 }  // namespace tesseract_kinematics
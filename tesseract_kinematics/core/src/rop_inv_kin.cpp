@@ -171,6 +171,7 @@ ROPInvKin& ROPInvKin::operator=(const ROPInvKin& other)
   joint_names_ = other.joint_names_;
   dof_ = other.dof_;
   dof_range_ = other.dof_range_;
+  reachability_map_ = other.reachability_map_;
 
   return *this;
 }
@@ -215,6 +216,9 @@ void ROPInvKin::ikAt(IKSolutions& solutions,
   if (robot_target_pose.translation().norm() > manip_reach_)
     return;
 
+  if (reachability_map_ != nullptr && !reachability_map_->isNearReachable(robot_target_pose.translation()))
+    return;
+
   tesseract_common::TransformMap robot_target_poses{ std::make_pair(manip_tip_link_, robot_target_pose) };
   auto robot_dof = static_cast<Eigen::Index>(manip_inv_kin_->numJoints());
   auto positioner_dof = static_cast<Eigen::Index>(positioner_pose.size());
@@ -255,4 +259,16 @@ std::vector<std::string> ROPInvKin::getTipLinkNames() const { return manip_inv_k
 
 std::string ROPInvKin::getSolverName() const { return solver_name_; }
 
+void ROPInvKin::setReachabilityMap(ReachabilityMap::ConstPtr reachability_map)
+{
+  if (reachability_map != nullptr && (reachability_map->getWorkingFrame() != manip_inv_kin_->getWorkingFrame() ||
+                                      reachability_map->getTipLinkName() != manip_tip_link_))
+    throw std::runtime_error("ROPInvKin, reachability map must be relative to the manipulator working frame and "
+                             "tip link");
+
+  reachability_map_ = std::move(reachability_map);
+}
+
+ReachabilityMap::ConstPtr ROPInvKin::getReachabilityMap() const { return reachability_map_; }
+
 }  // namespace tesseract_kinematics
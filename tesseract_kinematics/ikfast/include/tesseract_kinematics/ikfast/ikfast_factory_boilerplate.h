@@ -45,6 +45,7 @@ public:
     std::size_t n_joints = 0;
     std::vector<std::string> active_joints;
     std::vector<std::vector<double>> free_joint_states;
+    IKFastInvKinConfig ikfast_config;
     try
     {
       if (YAML::Node n = config["base_link"])
@@ -96,11 +97,46 @@ public:
         CONSOLE_BRIDGE_logDebug("IKFastInvKinFactory: No 'free_joint_states' entry found, none required");
       }
 
+      // The refined free joint values are clamped to the limits of the free joints
+      const auto num_free_joints = static_cast<std::size_t>(GetNumFreeParameters());
+      if (num_free_joints > 0 && num_free_joints == free_joints_required)
+      {
+        const int* free_joint_indices = GetFreeParameters();
+        ikfast_config.free_joint_limits.resize(static_cast<Eigen::Index>(num_free_joints), 2);
+        for (std::size_t i = 0; i < num_free_joints; ++i)
+        {
+          const auto& joint_name = active_joints.at(static_cast<std::size_t>(free_joint_indices[i]));  // NOLINT
+          const auto& limits = scene_graph.getJoint(joint_name)->limits;
+          if (limits != nullptr && limits->lower < limits->upper)
+            ikfast_config.free_joint_limits.row(static_cast<Eigen::Index>(i)) << limits->lower, limits->upper;
+          else
+            ikfast_config.free_joint_limits.row(static_cast<Eigen::Index>(i))
+                << std::numeric_limits<double>::lowest(),
+                std::numeric_limits<double>::max();
+        }
+      }
+
       free_joint_states.reserve(free_joint_states_map.size());
       std::transform(free_joint_states_map.begin(),
                      free_joint_states_map.end(),
                      std::back_inserter(free_joint_states),
                      [](const std::pair<const std::size_t, std::vector<double>>& pair) { return pair.second; });
+
+      // Get the optional free joint sampling configuration
+      if (YAML::Node n = config["num_threads"])
+        ikfast_config.num_threads = n.as<std::size_t>();
+
+      if (YAML::Node n = config["adaptive_refinements"])
+        ikfast_config.adaptive_refinements = n.as<std::size_t>();
+
+      if (YAML::Node n = config["adaptive_step"])
+        ikfast_config.adaptive_step = n.as<double>();
+
+      if (YAML::Node n = config["adaptive_max_states"])
+        ikfast_config.adaptive_max_states = n.as<std::size_t>();
+
+      if (YAML::Node n = config["duplicate_tolerance"])
+        ikfast_config.duplicate_tolerance = n.as<double>();
     }
     catch (const std::exception& e)
     {
@@ -108,7 +144,8 @@ public:
       return nullptr;
     }
 
-    return std::make_unique<IKFastInvKin>(base_link, tip_link, active_joints, solver_name, free_joint_states);
+    return std::make_unique<IKFastInvKin>(
+        base_link, tip_link, active_joints, solver_name, free_joint_states, ikfast_config);
   }
 };
 
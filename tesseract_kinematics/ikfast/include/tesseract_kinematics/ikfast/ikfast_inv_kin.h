@@ -33,6 +33,36 @@ namespace tesseract_kinematics
 {
 static const std::string IKFAST_INV_KIN_CHAIN_SOLVER_NAME = "IKFastInvKin";
 
+/** @brief The configuration of how IKFast solves the free joint combinations */
+struct IKFastInvKinConfig
+{
+  /** @brief The number of threads the free joint combinations are split across, if zero the hardware concurrency */
+  std::size_t num_threads{ 1 };
+
+  /**
+   * @brief The number of times the free joint combinations which produced solutions are refined
+   * @details Each refinement samples every free joint of a combination which produced solutions at plus and minus the
+   * refinement step, after which the step is halved. The refined values are clamped to the free joint limits and
+   * combinations which were already solved are skipped. If zero only the provided free joint combinations are sampled.
+   */
+  std::size_t adaptive_refinements{ 0 };
+
+  /** @brief The initial refinement step of the free joints */
+  double adaptive_step{ 0.1 };
+
+  /** @brief The maximum number of refined free joint combinations solved across all refinements */
+  std::size_t adaptive_max_states{ 1000 };
+
+  /**
+   * @brief The lower and upper limit of every free joint, the refined free joint values are clamped to these limits
+   * @details If it does not have a row for every free joint the range of the provided free joint states is used
+   */
+  Eigen::MatrixX2d free_joint_limits;
+
+  /** @brief Solutions where every joint is within this tolerance of a previous solution are removed */
+  double duplicate_tolerance{ 1e-6 };
+};
+
 /**
  * @brief IKFast Inverse Kinematics Implmentation.
  *
@@ -98,12 +128,15 @@ public:
    * @param tip_link_name The name of the tip link for the kinematic chain
    * @param joint_names The joint names for the kinematic chain
    * @param solver_name The solver name of the kinematic chain
+   * @param free_joint_states The combinations of free joints to sample when computing IK
+   * @param config The configuration of how the free joint combinations are solved
    */
   IKFastInvKin(std::string base_link_name,
                std::string tip_link_name,
                std::vector<std::string> joint_names,
                std::string solver_name = IKFAST_INV_KIN_CHAIN_SOLVER_NAME,
-               std::vector<std::vector<double>> free_joint_states = {});
+               std::vector<std::vector<double>> free_joint_states = {},
+               IKFastInvKinConfig config = IKFastInvKinConfig());
 
   IKSolutions calcInvKin(const tesseract_common::TransformMap& tip_link_poses,
                          const Eigen::Ref<const Eigen::VectorXd>& seed) const override;
@@ -135,6 +168,7 @@ protected:
   /**< @brief combinations of free joints to sample when computing IK
    * Example: Given 3 free joints, a valid input would be [[0,0,0][0,0,1][-1,0,1][0,2,0]] */
   std::vector<std::vector<double>> free_joint_states_;
+  IKFastInvKinConfig config_; /**< @brief The configuration of how the free joint combinations are solved */
 };
 
 }  // namespace tesseract_kinematics
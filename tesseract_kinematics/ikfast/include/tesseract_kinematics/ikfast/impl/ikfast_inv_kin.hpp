@@ -29,12 +29,17 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <stdexcept>
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <set>
 #include <console_bridge/console.h>
 #include <tesseract_kinematics/ikfast/external/ikfast.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_kinematics/ikfast/ikfast_inv_kin.h>
 #include <tesseract_kinematics/core/utils.h>
+#include <tesseract_common/parallel_for.h>
 
 namespace tesseract_kinematics
 {
@@ -42,12 +47,14 @@ inline IKFastInvKin::IKFastInvKin(std::string base_link_name,
                                   std::string tip_link_name,
                                   std::vector<std::string> joint_names,
                                   std::string solver_name,
-                                  std::vector<std::vector<double>> free_joint_states)
+                                  std::vector<std::vector<double>> free_joint_states,
+                                  IKFastInvKinConfig config)
   : base_link_name_(std::move(base_link_name))
   , tip_link_name_(std::move(tip_link_name))
   , joint_names_(std::move(joint_names))
   , solver_name_(std::move(solver_name))
   , free_joint_states_(std::move(free_joint_states))
+  , config_(config)
 {
 }
 
@@ -62,6 +69,7 @@ inline IKFastInvKin& IKFastInvKin::operator=(const IKFastInvKin& other)
   joint_names_ = other.joint_names_;
   solver_name_ = other.solver_name_;
   free_joint_states_ = other.free_joint_states_;
+  config_ = other.config_;
 
   return *this;
 }
@@ -87,53 +95,138 @@ inline IKSolutions IKFastInvKin::calcInvKin(const tesseract_common::TransformMap
 
   auto ikfast_dof = static_cast<std::size_t>(numJoints());
 
-  // Call IK (TODO: Make a better solution list class? One that uses vector instead of list)
-  ikfast::IkSolutionList<IkReal> ikfast_solution_set;
-  std::vector<double> sols;
-
-  // Lambda to add all possible solutions for a given combination of free joints, or nullptr if no free joints
-  auto addSols = [&](const double* pfree) {
-    ComputeIk(translation.data(), rotation.data(), pfree, ikfast_solution_set);
+  // Lambda to solve every combination of free joints, an empty combination is solved without free joints. The
+  // solutions of every combination are stored separately so the order does not depend on the number of threads.
+  auto solveFreeJointStates = [&](const std::vector<std::vector<double>>& free_joint_states) {
+    std::vector<std::vector<IkReal>> free_joint_sols(free_joint_states.size());
 
-    // Unpack the solutions into the output vector
-    const auto n_sols = ikfast_solution_set.GetNumSolutions();
+    // Call IK (TODO: Make a better solution list class? One that uses vector instead of list)
+    std::vector<ikfast::IkSolutionList<IkReal>> ikfast_solution_sets(
+        tesseract_common::getParallelThreadCount(config_.num_threads, free_joint_states.size()));
+    tesseract_common::parallelFor(
+        free_joint_states.size(), config_.num_threads, [&](std::size_t c, std::size_t thread_index) {
+          ikfast::IkSolutionList<IkReal>& ikfast_solution_set = ikfast_solution_sets[thread_index];
+          const double* pfree = (free_joint_states[c].empty()) ? nullptr : free_joint_states[c].data();
+          ComputeIk(translation.data(), rotation.data(), pfree, ikfast_solution_set);
 
-    std::vector<IkReal> ikfast_output;
-    ikfast_output.resize(n_sols * ikfast_dof);
+          // Unpack the solutions into the output vector
+          const auto n_sols = ikfast_solution_set.GetNumSolutions();
+          std::vector<IkReal>& ikfast_output = free_joint_sols[c];
+          ikfast_output.resize(n_sols * ikfast_dof);
 
-    for (std::size_t i = 0; i < n_sols; ++i)
-    {
-      // This actually walks the list EVERY time from the start of i.
-      const auto& sol = ikfast_solution_set.GetSolution(i);
-      auto* out = ikfast_output.data() + i * ikfast_dof;
-      sol.GetSolution(out, pfree);
-    }
+          for (std::size_t i = 0; i < n_sols; ++i)
+          {
+            // This actually walks the list EVERY time from the start of i.
+            const auto& sol = ikfast_solution_set.GetSolution(i);
+            auto* out = ikfast_output.data() + i * ikfast_dof;
+            sol.GetSolution(out, pfree);
+          }
+        });
 
-    sols.insert(
-        end(sols), std::make_move_iterator(ikfast_output.begin()), std::make_move_iterator(ikfast_output.end()));
+    return free_joint_sols;
   };
 
-  if (!free_joint_states_.empty())
+  std::vector<std::vector<double>> free_joint_states = free_joint_states_;
+  if (free_joint_states.empty())
+    free_joint_states.emplace_back();
+
+  std::vector<std::vector<IkReal>> free_joint_sols = solveFreeJointStates(free_joint_states);
+  std::vector<double> sols;
+  for (const auto& free_joint_sol : free_joint_sols)
+    sols.insert(end(sols), free_joint_sol.begin(), free_joint_sol.end());
+
+  // The refined free joint values are clamped to the free joint limits, if they are not provided the range of the
+  // provided free joint states is used so the refinement never samples outside of it
+  const std::size_t num_free_joints = free_joint_states.front().size();
+  Eigen::MatrixX2d free_joint_limits = config_.free_joint_limits;
+  if (config_.adaptive_refinements > 0 && static_cast<std::size_t>(free_joint_limits.rows()) != num_free_joints)
   {
-    for (auto j_combo : free_joint_states_)
+    free_joint_limits.resize(static_cast<Eigen::Index>(num_free_joints), 2);
+    free_joint_limits.col(0).setConstant(std::numeric_limits<double>::max());
+    free_joint_limits.col(1).setConstant(std::numeric_limits<double>::lowest());
+    for (const auto& free_joint_state : free_joint_states_)
     {
-      addSols(j_combo.data());
+      for (std::size_t j = 0; j < num_free_joints; ++j)
+      {
+        const auto row = static_cast<Eigen::Index>(j);
+        free_joint_limits(row, 0) = std::min(free_joint_limits(row, 0), free_joint_state[j]);
+        free_joint_limits(row, 1) = std::max(free_joint_limits(row, 1), free_joint_state[j]);
+      }
     }
   }
-  else
+
+  // Refine only around the combinations of free joints which produced solutions. Every combination is solved at most
+  // once and the number of refined combinations is capped so the work does not grow exponentially with the refinements
+  std::set<std::vector<double>> solved_free_joint_states(free_joint_states.begin(), free_joint_states.end());
+  std::size_t num_refined_states{ 0 };
+  double step = config_.adaptive_step;
+  for (std::size_t r = 0; r < config_.adaptive_refinements && !free_joint_states_.empty(); ++r)
   {
-    addSols(nullptr);
+    std::vector<std::vector<double>> refined_free_joint_states;
+    for (std::size_t c = 0; c < free_joint_states.size(); ++c)
+    {
+      if (free_joint_sols[c].empty())
+        continue;
+
+      for (std::size_t j = 0; j < num_free_joints; ++j)
+      {
+        for (double offset : { -step, step })
+        {
+          if (num_refined_states >= config_.adaptive_max_states)
+            break;
+
+          std::vector<double> refined_free_joint_state = free_joint_states[c];
+          const auto row = static_cast<Eigen::Index>(j);
+          refined_free_joint_state[j] =
+              std::clamp(refined_free_joint_state[j] + offset, free_joint_limits(row, 0), free_joint_limits(row, 1));
+          if (!solved_free_joint_states.insert(refined_free_joint_state).second)
+            continue;
+
+          refined_free_joint_states.push_back(std::move(refined_free_joint_state));
+          ++num_refined_states;
+        }
+      }
+    }
+
+    if (refined_free_joint_states.empty())
+      break;
+
+    free_joint_states = std::move(refined_free_joint_states);
+    free_joint_sols = solveFreeJointStates(free_joint_states);
+    for (const auto& free_joint_sol : free_joint_sols)
+      sols.insert(end(sols), free_joint_sol.begin(), free_joint_sol.end());
+
+    step /= 2.0;
   }
 
-  // Check the output
+  // Check the output and collapse duplicate solutions, the kept solutions are ordered by their first joint value so
+  // only the solutions within the tolerance of the first joint value have to be compared
   std::size_t num_sol = sols.size() / ikfast_dof;
   IKSolutions solution_set;
-  solution_set.reserve(sols.size());
+  solution_set.reserve(num_sol);
+  std::multimap<double, std::size_t> kept_solutions;
   for (std::size_t i = 0; i < num_sol; i++)
   {
     Eigen::Map<Eigen::VectorXd> eigen_sol(sols.data() + ikfast_dof * i, static_cast<Eigen::Index>(ikfast_dof));
-    if (eigen_sol.array().allFinite())
-      solution_set.push_back(eigen_sol);
+    if (!eigen_sol.array().allFinite())
+      continue;
+
+    bool duplicate{ false };
+    auto it = kept_solutions.lower_bound(eigen_sol(0) - config_.duplicate_tolerance);
+    for (; it != kept_solutions.end() && it->first <= eigen_sol(0) + config_.duplicate_tolerance; ++it)
+    {
+      if ((solution_set[it->second] - eigen_sol).cwiseAbs().maxCoeff() <= config_.duplicate_tolerance)
+      {
+        duplicate = true;
+        break;
+      }
+    }
+
+    if (duplicate)
+      continue;
+
+    kept_solutions.emplace(eigen_sol(0), solution_set.size());
+    solution_set.push_back(eigen_sol);
   }
 
   return solution_set;
@@ -74,6 +74,9 @@ public:
   IKSolutions calcInvKin(const tesseract_common::TransformMap& tip_link_poses,
                          const Eigen::Ref<const Eigen::VectorXd>& seed) const override final;
 
+  IKBatchSolutions calcInvKinBatch(const tesseract_common::VectorIsometry3d& tip_link_poses,
+                                   const Eigen::Ref<const Eigen::VectorXd>& seed) const override final;
+
   Eigen::Index numJoints() const override final;
   std::vector<std::string> getJointNames() const override final;
   std::string getBaseLinkName() const override final;
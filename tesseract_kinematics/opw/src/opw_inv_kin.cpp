@@ -87,6 +87,35 @@ IKSolutions OPWInvKin::calcInvKin(const tesseract_common::TransformMap& tip_link
   return solution_set;
 }
 
+IKBatchSolutions OPWInvKin::calcInvKinBatch(const tesseract_common::VectorIsometry3d& tip_link_poses,
+                                            const Eigen::Ref<const Eigen::VectorXd>& /*seed*/) const
+{
+  // Every pose has at most eight solutions so the valid solutions are written directly into a single buffer
+  IKBatchSolutions batch_solutions;
+  batch_solutions.solutions.resize(6, 8 * static_cast<Eigen::Index>(tip_link_poses.size()));
+  batch_solutions.offsets.reserve(tip_link_poses.size() + 1);
+  batch_solutions.offsets.push_back(0);
+
+  Eigen::Index num_solutions{ 0 };
+  for (const auto& tip_link_pose : tip_link_poses)
+  {
+    assert(std::abs(1.0 - tip_link_pose.matrix().determinant()) < 1e-6);  // NOLINT
+
+    // NOLINTNEXTLINE
+    opw_kinematics::Solutions<double> sols = opw_kinematics::inverse(params_, tip_link_pose);
+    for (const auto& sol : sols)
+    {
+      if (opw_kinematics::isValid<double>(sol))
+        batch_solutions.solutions.col(num_solutions++) = Eigen::Map<const Eigen::Matrix<double, 6, 1>>(sol.data());
+    }
+
+    batch_solutions.offsets.push_back(num_solutions);
+  }
+
+  batch_solutions.solutions.conservativeResize(Eigen::NoChange, num_solutions);
+  return batch_solutions;
+}
+
 Eigen::Index OPWInvKin::numJoints() const { return 6; }
 
 std::vector<std::string> OPWInvKin::getJointNames() const { return joint_names_; }
@@ -0,0 +1,260 @@
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <benchmark/benchmark.h>
+#include <opw_kinematics/opw_parameters.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include "kinematics_test_utils.h"
+#include "tesseract_kinematics/ikfast/impl/ikfast_inv_kin.hpp"
+#include <tesseract_kinematics/core/joint_group.h>
+#include <tesseract_kinematics/core/kinematic_group.h>
+#include <tesseract_kinematics/core/rep_inv_kin.h>
+#include <tesseract_kinematics/core/rop_inv_kin.h>
+#include <tesseract_kinematics/kdl/kdl_fwd_kin_chain.h>
+#include <tesseract_kinematics/kdl/kdl_inv_kin_chain_lma.h>
+#include <tesseract_kinematics/kdl/kdl_inv_kin_chain_nr.h>
+#include <tesseract_kinematics/opw/opw_inv_kin.h>
+#include <tesseract_kinematics/ur/ur_inv_kin.h>
+#include <tesseract_state_solver/kdl/kdl_state_solver.h>
+
+using namespace tesseract_kinematics::test_suite;
+using namespace tesseract_kinematics;
+
+opw_kinematics::Parameters<double> getOPWKinematicsParamABB()
+{
+  opw_kinematics::Parameters<double> opw_params;
+  opw_params.a1 = (0.100);
+  opw_params.a2 = (-0.135);
+  opw_params.b = (0.000);
+  opw_params.c1 = (0.615);
+  opw_params.c2 = (0.705);
+  opw_params.c3 = (0.755);
+  opw_params.c4 = (0.085);
+
+  opw_params.offsets[2] = -M_PI / 2.0;
+
+  return opw_params;
+}
+
+/** @brief Contains the information necessary to run the inverse kinematics benchmarks */
+struct InvKinBenchmarkInfo
+{
+  KinematicGroup::ConstPtr kin_group;
+  KinGroupIKInput target;
+  Eigen::VectorXd seed;
+};
+
+/**
+ * @brief Create a kinematic group and a reachable target for an inverse kinematics solver
+ * @details The target is the pose of the tip link, relative to the working frame, at a fixed joint state clamped to
+ * the joint limits so the benchmark results are reproducible.
+ */
+InvKinBenchmarkInfo createInvKinBenchmarkInfo(const tesseract_scene_graph::SceneGraph& scene_graph,
+                                              InverseKinematics::UPtr inv_kin)
+{
+  tesseract_scene_graph::KDLStateSolver state_solver(scene_graph);
+
+  std::vector<std::string> joint_names = inv_kin->getJointNames();
+  std::string working_frame = inv_kin->getWorkingFrame();
+  std::string tip_link_name = inv_kin->getTipLinkNames()[0];
+
+  tesseract_common::KinematicLimits limits = getTargetLimits(scene_graph, joint_names);
+  Eigen::VectorXd joint_values = Eigen::VectorXd::Constant(static_cast<Eigen::Index>(joint_names.size()), 0.3);
+  joint_values = joint_values.cwiseMax(limits.joint_limits.col(0)).cwiseMin(limits.joint_limits.col(1));
+
+  tesseract_scene_graph::SceneState scene_state = state_solver.getState(joint_names, joint_values);
+  Eigen::Isometry3d pose =
+      scene_state.link_transforms.at(working_frame).inverse() * scene_state.link_transforms.at(tip_link_name);
+
+  InvKinBenchmarkInfo info;
+  info.kin_group = std::make_shared<KinematicGroup>(
+      "manipulator", joint_names, std::move(inv_kin), scene_graph, state_solver.getState());
+  info.target = KinGroupIKInput(pose, working_frame, tip_link_name);
+  info.seed = Eigen::VectorXd::Zero(static_cast<Eigen::Index>(joint_names.size()));
+  return info;
+}
+
+/**
+ * @brief Benchmark that checks the JointGroup calcFwdKin method
+ * @details This may be run with multiple threads since all threads share the same joint group
+ */
+static void BM_JOINT_GROUP_CALC_FWD_KIN(benchmark::State& state, const JointGroup::ConstPtr& joint_group)  // NOLINT
+{
+  tesseract_common::KinematicLimits limits = joint_group->getLimits();
+  Eigen::VectorXd joint_values = tesseract_common::generateRandomNumber(limits.joint_limits);
+
+  tesseract_common::TransformMap poses;
+  for (auto _ : state)  // NOLINT
+  {
+    benchmark::DoNotOptimize(poses = joint_group->calcFwdKin(joint_values));
+  }
+}
+
+/**
+ * @brief Benchmark that checks the JointGroup calcJacobian method
+ * @details This may be run with multiple threads since all threads share the same joint group
+ */
+static void BM_JOINT_GROUP_CALC_JACOBIAN(benchmark::State& state,
+                                         const JointGroup::ConstPtr& joint_group,  // NOLINT
+                                         const std::string& link_name)
+{
+  tesseract_common::KinematicLimits limits = joint_group->getLimits();
+  Eigen::VectorXd joint_values = tesseract_common::generateRandomNumber(limits.joint_limits);
+
+  Eigen::MatrixXd jacobian;
+  for (auto _ : state)  // NOLINT
+  {
+    benchmark::DoNotOptimize(jacobian = joint_group->calcJacobian(joint_values, link_name));
+  }
+}
+
+/**
+ * @brief Benchmark that checks the KinematicGroup calcInvKin method
+ * @details This may be run with multiple threads since all threads share the same kinematic group
+ */
+static void BM_KIN_GROUP_CALC_INV_KIN(benchmark::State& state, const InvKinBenchmarkInfo& info)  // NOLINT
+{
+  IKSolutions solutions;
+  for (auto _ : state)  // NOLINT
+  {
+    benchmark::DoNotOptimize(solutions = info.kin_group->calcInvKin(info.target, info.seed));
+  }
+  state.counters["solutions"] = static_cast<double>(solutions.size());
+}
+
+int main(int argc, char** argv)
+{
+  //////////////////////////////////////
+  // Forward Kinematics
+  //////////////////////////////////////
+  {
+    std::function<void(benchmark::State&, JointGroup::ConstPtr)> BM_JOINT_GROUP_CALC_FWD_KIN_FUNC =
+        BM_JOINT_GROUP_CALC_FWD_KIN;
+    std::function<void(benchmark::State&, JointGroup::ConstPtr, std::string)> BM_JOINT_GROUP_CALC_JACOBIAN_FUNC =
+        BM_JOINT_GROUP_CALC_JACOBIAN;
+
+    // The robot name, scene graph, joint names and the link used for the jacobian
+    struct FwdKinRobot
+    {
+      std::string name;
+      tesseract_scene_graph::SceneGraph::UPtr scene_graph;
+      std::vector<std::string> joint_names;
+      std::string link_name;
+    };
+
+    std::vector<FwdKinRobot> robots;
+    robots.push_back({ "IIWA",
+                       getSceneGraphIIWA(),
+                       { "joint_a1", "joint_a2", "joint_a3", "joint_a4", "joint_a5", "joint_a6", "joint_a7" },
+                       "tool0" });
+    robots.push_back({ "ABB",
+                       getSceneGraphABB(),
+                       { "joint_1", "joint_2", "joint_3", "joint_4", "joint_5", "joint_6" },
+                       "tool0" });
+    robots.push_back(
+        { "ABB_EXTERNAL_POSITIONER",
+          getSceneGraphABBExternalPositioner(),
+          { "positioner_joint_1", "positioner_joint_2", "joint_1", "joint_2", "joint_3", "joint_4", "joint_5", "joint_6" },
+          "tool0" });
+
+    for (const auto& robot : robots)
+    {
+      tesseract_scene_graph::KDLStateSolver state_solver(*robot.scene_graph);
+      auto joint_group = std::make_shared<JointGroup>(
+          "manipulator", robot.joint_names, *robot.scene_graph, state_solver.getState());
+
+      std::string name = "BM_JOINT_GROUP_CALC_FWD_KIN_" + robot.name;
+      benchmark::RegisterBenchmark(name.c_str(), BM_JOINT_GROUP_CALC_FWD_KIN_FUNC, joint_group)
+          ->ThreadRange(1, 8)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kNanosecond);
+
+      name = "BM_JOINT_GROUP_CALC_JACOBIAN_" + robot.name;
+      benchmark::RegisterBenchmark(name.c_str(), BM_JOINT_GROUP_CALC_JACOBIAN_FUNC, joint_group, robot.link_name)
+          ->ThreadRange(1, 8)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kNanosecond);
+    }
+  }
+
+  //////////////////////////////////////
+  // Inverse Kinematics
+  //////////////////////////////////////
+  {
+    std::function<void(benchmark::State&, InvKinBenchmarkInfo)> BM_KIN_GROUP_CALC_INV_KIN_FUNC =
+        BM_KIN_GROUP_CALC_INV_KIN;
+
+    std::vector<std::pair<std::string, InvKinBenchmarkInfo>> solvers;
+
+    auto iiwa_scene_graph = getSceneGraphIIWA();
+    solvers.emplace_back(
+        "KDL_LMA_IIWA",
+        createInvKinBenchmarkInfo(*iiwa_scene_graph,
+                                  std::make_unique<KDLInvKinChainLMA>(*iiwa_scene_graph, "base_link", "tool0")));
+    solvers.emplace_back(
+        "KDL_NR_IIWA",
+        createInvKinBenchmarkInfo(*iiwa_scene_graph,
+                                  std::make_unique<KDLInvKinChainNR>(*iiwa_scene_graph, "base_link", "tool0")));
+
+    auto abb_scene_graph = getSceneGraphABB();
+    std::vector<std::string> abb_joint_names{ "joint_1", "joint_2", "joint_3", "joint_4", "joint_5", "joint_6" };
+    solvers.emplace_back("OPW_ABB",
+                         createInvKinBenchmarkInfo(*abb_scene_graph,
+                                                   std::make_unique<OPWInvKin>(
+                                                       getOPWKinematicsParamABB(), "base_link", "tool0", abb_joint_names)));
+    solvers.emplace_back(
+        "IKFAST_ABB",
+        createInvKinBenchmarkInfo(*abb_scene_graph,
+                                  std::make_unique<IKFastInvKin>("base_link", "tool0", abb_joint_names)));
+
+    auto ur_scene_graph = getSceneGraphUR(UR10Parameters, 0.220941, -0.1719);
+    std::vector<std::string> ur_joint_names{ "shoulder_pan_joint", "shoulder_lift_joint", "elbow_joint",
+                                             "wrist_1_joint",      "wrist_2_joint",       "wrist_3_joint" };
+    solvers.emplace_back("UR_UR10",
+                         createInvKinBenchmarkInfo(
+                             *ur_scene_graph,
+                             std::make_unique<URInvKin>(UR10Parameters, "base_link", "tool0", ur_joint_names)));
+
+    {
+      auto scene_graph = getSceneGraphABBExternalPositioner();
+      tesseract_scene_graph::KDLStateSolver state_solver(*scene_graph);
+      KDLFwdKinChain robot_fwd_kin(*scene_graph, "base_link", "tool0");
+      auto opw_kin = std::make_unique<OPWInvKin>(getOPWKinematicsParamABB(),
+                                                 robot_fwd_kin.getBaseLinkName(),
+                                                 robot_fwd_kin.getTipLinkNames()[0],
+                                                 robot_fwd_kin.getJointNames());
+      auto positioner_kin = std::make_unique<KDLFwdKinChain>(*scene_graph, "positioner_base_link", "positioner_tool0");
+      Eigen::VectorXd positioner_resolution = Eigen::VectorXd::Constant(2, 1, 0.1);
+      auto rep_inv_kin = std::make_unique<REPInvKin>(
+          *scene_graph, state_solver.getState(), std::move(opw_kin), 2.5, std::move(positioner_kin), positioner_resolution);
+      solvers.emplace_back("REP_ABB_EXTERNAL_POSITIONER", createInvKinBenchmarkInfo(*scene_graph, std::move(rep_inv_kin)));
+    }
+
+    {
+      auto scene_graph = getSceneGraphABBOnPositioner();
+      tesseract_scene_graph::KDLStateSolver state_solver(*scene_graph);
+      KDLFwdKinChain robot_fwd_kin(*scene_graph, "base_link", "tool0");
+      auto opw_kin = std::make_unique<OPWInvKin>(getOPWKinematicsParamABB(),
+                                                 robot_fwd_kin.getBaseLinkName(),
+                                                 robot_fwd_kin.getTipLinkNames()[0],
+                                                 robot_fwd_kin.getJointNames());
+      auto positioner_kin = std::make_unique<KDLFwdKinChain>(*scene_graph, "positioner_base_link", "positioner_tool0");
+      Eigen::VectorXd positioner_resolution = Eigen::VectorXd::Constant(1, 1, 0.1);
+      auto rop_inv_kin = std::make_unique<ROPInvKin>(
+          *scene_graph, state_solver.getState(), std::move(opw_kin), 2.5, std::move(positioner_kin), positioner_resolution);
+      solvers.emplace_back("ROP_ABB_ON_POSITIONER", createInvKinBenchmarkInfo(*scene_graph, std::move(rop_inv_kin)));
+    }
+
+    for (const auto& solver : solvers)
+    {
+      std::string name = "BM_KIN_GROUP_CALC_INV_KIN_" + solver.first;
+      benchmark::RegisterBenchmark(name.c_str(), BM_KIN_GROUP_CALC_INV_KIN_FUNC, solver.second)
+          ->ThreadRange(1, 8)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kMicrosecond);
+    }
+  }
+
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+}
@@ -84,6 +84,109 @@ TEST(TesseractKinematicsUnit, IKFastInvKin7DOF)  // NOLINT
   runInvKinTest(*iiwa_inv_kin2, fwd_kin, pose, tip_link_name, seed);
 }
 
+TEST(TesseractKinematicsUnit, IKFastInvKin7DOFFreeJointSampling)  // NOLINT
+{
+  // Inverse target pose and seed
+  Eigen::Isometry3d pose;
+  pose.setIdentity();
+  pose.translation()[0] = 0.223;
+  pose.translation()[1] = 0.354;
+  pose.translation()[2] = 0.5;
+
+  Eigen::VectorXd seed = Eigen::VectorXd::Zero(7);
+  tesseract_common::TransformMap input{ std::make_pair("ikfast_tcp_link", pose) };
+
+  // Setup test
+  auto scene_graph = getSceneGraphIIWA7();
+  std::string base_link_name = "link_0";
+  std::string tip_link_name = "ikfast_tcp_link";
+  std::vector<std::string> joint_names{ "joint_1", "joint_2", "joint_3", "joint_4", "joint_5", "joint_6", "joint_7" };
+
+  KDLFwdKinChain fwd_kin(*scene_graph, base_link_name, tip_link_name);
+
+  std::vector<std::vector<double>> free_joint_states;
+  for (int i = -20; i <= 20; ++i)
+    free_joint_states.push_back({ 0.1 * i });
+
+  IKFastInvKin serial_inv_kin(
+      base_link_name, tip_link_name, joint_names, IKFAST_INV_KIN_CHAIN_SOLVER_NAME, free_joint_states);
+  IKSolutions serial_solutions = serial_inv_kin.calcInvKin(input, seed);
+  EXPECT_FALSE(serial_solutions.empty());
+
+  {  // Splitting the free joint combinations across threads should not change the solutions or their order
+    IKFastInvKinConfig config;
+    config.num_threads = 3;
+    IKFastInvKin parallel_inv_kin(
+        base_link_name, tip_link_name, joint_names, IKFAST_INV_KIN_CHAIN_SOLVER_NAME, free_joint_states, config);
+    IKSolutions parallel_solutions = parallel_inv_kin.calcInvKin(input, seed);
+    ASSERT_EQ(parallel_solutions.size(), serial_solutions.size());
+    for (std::size_t i = 0; i < serial_solutions.size(); ++i)
+      EXPECT_TRUE(parallel_solutions[i].isApprox(serial_solutions[i]));
+
+    runInvKinTest(parallel_inv_kin, fwd_kin, pose, tip_link_name, seed);
+  }
+
+  {  // Duplicate free joint combinations should produce the same solutions
+    std::vector<std::vector<double>> duplicate_free_joint_states = free_joint_states;
+    duplicate_free_joint_states.insert(
+        duplicate_free_joint_states.end(), free_joint_states.begin(), free_joint_states.end());
+    IKFastInvKin duplicate_inv_kin(
+        base_link_name, tip_link_name, joint_names, IKFAST_INV_KIN_CHAIN_SOLVER_NAME, duplicate_free_joint_states);
+    IKSolutions duplicate_solutions = duplicate_inv_kin.calcInvKin(input, seed);
+    ASSERT_EQ(duplicate_solutions.size(), serial_solutions.size());
+    for (std::size_t i = 0; i < serial_solutions.size(); ++i)
+      EXPECT_TRUE(duplicate_solutions[i].isApprox(serial_solutions[i]));
+  }
+
+  {  // Adaptive sampling should find additional solutions around the coarse free joint combinations
+    std::vector<std::vector<double>> coarse_free_joint_states = { { -2.0 }, { -1.0 }, { 0.0 }, { 1.0 }, { 2.0 } };
+    IKFastInvKin coarse_inv_kin(
+        base_link_name, tip_link_name, joint_names, IKFAST_INV_KIN_CHAIN_SOLVER_NAME, coarse_free_joint_states);
+    IKSolutions coarse_solutions = coarse_inv_kin.calcInvKin(input, seed);
+
+    IKFastInvKinConfig config;
+    config.num_threads = 2;
+    config.adaptive_refinements = 2;
+    config.adaptive_step = 0.5;
+    IKFastInvKin adaptive_inv_kin(
+        base_link_name, tip_link_name, joint_names, IKFAST_INV_KIN_CHAIN_SOLVER_NAME, coarse_free_joint_states, config);
+    IKSolutions adaptive_solutions = adaptive_inv_kin.calcInvKin(input, seed);
+    EXPECT_GT(adaptive_solutions.size(), coarse_solutions.size());
+
+    runInvKinTest(adaptive_inv_kin, fwd_kin, pose, tip_link_name, seed);
+
+    // Without explicit limits the refined free joint values stay within the range of the provided states
+    const auto free_joint_index = static_cast<Eigen::Index>(GetFreeParameters()[0]);  // NOLINT
+    for (const auto& solution : adaptive_solutions)
+    {
+      EXPECT_GE(solution(free_joint_index), -2.0 - 1e-8);
+      EXPECT_LE(solution(free_joint_index), 2.0 + 1e-8);
+    }
+
+    // Check cloned
+    InverseKinematics::Ptr adaptive_inv_kin2 = adaptive_inv_kin.clone();
+    EXPECT_EQ(adaptive_inv_kin2->calcInvKin(input, seed).size(), adaptive_solutions.size());
+
+    // The refined free joint values are clamped to the provided limits
+    config.free_joint_limits.resize(1, 2);
+    config.free_joint_limits << -1.2, 1.2;
+    IKFastInvKin limited_inv_kin(
+        base_link_name, tip_link_name, joint_names, IKFAST_INV_KIN_CHAIN_SOLVER_NAME, coarse_free_joint_states, config);
+    for (const auto& solution : limited_inv_kin.calcInvKin(input, seed))
+    {
+      // Only the provided combinations at -2 and 2 are outside of the limits
+      const double value = std::abs(solution(free_joint_index));
+      EXPECT_TRUE(value <= 1.2 + 1e-8 || std::abs(value - 2.0) < 1e-8);
+    }
+
+    // Without a budget for refined combinations only the provided combinations are solved
+    config.adaptive_max_states = 0;
+    IKFastInvKin capped_inv_kin(
+        base_link_name, tip_link_name, joint_names, IKFAST_INV_KIN_CHAIN_SOLVER_NAME, coarse_free_joint_states, config);
+    EXPECT_EQ(capped_inv_kin.calcInvKin(input, seed).size(), coarse_solutions.size());
+  }
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
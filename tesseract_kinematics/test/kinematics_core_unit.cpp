@@ -1,10 +1,16 @@
 ﻿#include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <gtest/gtest.h>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <thread>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_kinematics/kdl/kdl_fwd_kin_chain.h>
 #include <tesseract_kinematics/core/utils.h>
+#include <tesseract_kinematics/core/reachability_map.h>
+#include <tesseract_kinematics/core/ik_cache.h>
 #include "kinematics_test_utils.h"
 
 const static std::string FACTORY_NAME = "TestFactory";
@@ -328,6 +334,269 @@ TEST(TesseractKinematicsUnit, UtilscalcManipulabilityUnit)  // NOLINT
   EXPECT_NEAR(m.f_angular.volume, 0.408248290463863, 1e-6);
 }
 
+TEST(TesseractKinematicsUnit, ReachabilityMapUnit)  // NOLINT
+{
+  using tesseract_kinematics::ReachabilityMap;
+
+  // Every orientation bin direction should map to its own bin
+  for (std::size_t i = 0; i < ReachabilityMap::ORIENTATION_BIN_COUNT; ++i)
+  {
+    EXPECT_NEAR(ReachabilityMap::getOrientationBinDirection(i).norm(), 1.0, 1e-8);
+    EXPECT_EQ(ReachabilityMap::getOrientationBin(ReachabilityMap::getOrientationBinDirection(i)), i);
+  }
+
+  EXPECT_ANY_THROW(ReachabilityMap("base_link", "tool0", Eigen::Vector3d::Zero(), 0, { 2, 2, 2 }));  // NOLINT
+
+  ReachabilityMap map("base_link", "tool0", Eigen::Vector3d(-1, -1, -1), 0.5, { 4, 4, 4 });
+  EXPECT_EQ(map.getWorkingFrame(), "base_link");
+  EXPECT_EQ(map.getTipLinkName(), "tool0");
+  EXPECT_TRUE(map.getOrigin().isApprox(Eigen::Vector3d(-1, -1, -1)));
+  EXPECT_NEAR(map.getResolution(), 0.5, 1e-8);
+  EXPECT_EQ(map.getReachableVoxelCount(), 0);
+
+  Eigen::Isometry3d pose = Eigen::Isometry3d::Identity();
+  pose.translation() = Eigen::Vector3d(0.1, 0.2, 0.3);
+  map.addPose(pose);
+
+  // The same voxel and approach direction is reachable but not a different approach direction
+  Eigen::Isometry3d other_pose = pose;
+  other_pose.translation() = Eigen::Vector3d(0.4, 0.4, 0.4);
+  EXPECT_TRUE(map.isReachable(Eigen::Vector3d(other_pose.translation())));
+  EXPECT_TRUE(map.isReachable(other_pose));
+  other_pose.linear() = Eigen::AngleAxisd(M_PI, Eigen::Vector3d::UnitX()).toRotationMatrix();
+  EXPECT_FALSE(map.isReachable(other_pose));
+  EXPECT_NEAR(map.getOrientationCoverage(pose.translation()), 1.0 / ReachabilityMap::ORIENTATION_BIN_COUNT, 1e-8);
+
+  map.addPose(other_pose);
+  EXPECT_TRUE(map.isReachable(other_pose));
+  EXPECT_NEAR(map.getOrientationCoverage(pose.translation()), 2.0 / ReachabilityMap::ORIENTATION_BIN_COUNT, 1e-8);
+  EXPECT_EQ(map.getReachableVoxelCount(), 1);
+
+  // Other voxels and positions outside of the map are not reachable
+  EXPECT_FALSE(map.isReachable(Eigen::Vector3d(-0.1, 0.2, 0.3)));
+  EXPECT_FALSE(map.isReachable(Eigen::Vector3d(1.1, 0.2, 0.3)));
+  EXPECT_FALSE(map.isReachable(Eigen::Vector3d(0.1, 0.2, -1.1)));
+  EXPECT_EQ(map.getOrientationMask(Eigen::Vector3d(5, 5, 5)), 0);
+
+  // The neighboring voxels, including positions outside of the map, are near a reachable voxel
+  EXPECT_TRUE(map.isNearReachable(Eigen::Vector3d(0.1, 0.2, 0.3)));
+  EXPECT_TRUE(map.isNearReachable(Eigen::Vector3d(-0.1, 0.2, 0.3)));
+  EXPECT_TRUE(map.isNearReachable(Eigen::Vector3d(0.1, 0.2, 1.1), 2));
+  EXPECT_FALSE(map.isNearReachable(Eigen::Vector3d(-0.6, 0.2, 0.3)));
+  EXPECT_FALSE(map.isNearReachable(Eigen::Vector3d(-0.6, 0.2, 0.3), 0));
+  EXPECT_TRUE(map.isNearReachable(Eigen::Vector3d(-0.6, 0.2, 0.3), 2));
+  EXPECT_FALSE(map.isNearReachable(Eigen::Vector3d(0.1, 0.2, -1.1)));
+  EXPECT_FALSE(map.isNearReachable(Eigen::Vector3d(0.1, 0.2, 1.6)));
+  EXPECT_FALSE(map.isNearReachable(Eigen::Vector3d(-0.1, 0.2, 0.3), 0));
+
+  pose.translation() = Eigen::Vector3d(5, 5, 5);
+  map.addPose(pose);
+  EXPECT_EQ(map.getReachableVoxelCount(), 1);
+
+  // Save and load
+  const std::string file_path = tesseract_common::getTempPath() + "reachability_map_unit.bin";
+  EXPECT_TRUE(map.saveFile(file_path));
+
+  ReachabilityMap loaded_map;
+  EXPECT_TRUE(loaded_map.loadFile(file_path));
+  EXPECT_TRUE(loaded_map == map);
+  EXPECT_FALSE(loaded_map != map);
+  EXPECT_TRUE(loaded_map.isReachable(other_pose));
+
+  // Loading an invalid file should fail and not change the map
+  const std::string invalid_file_path = tesseract_common::getTempPath() + "reachability_map_invalid_unit.bin";
+  {
+    std::ofstream os(invalid_file_path);
+    os << "not a reachability map";
+  }
+  EXPECT_FALSE(loaded_map.loadFile(invalid_file_path));
+
+  // A file with sizes which do not match the file size should fail
+  std::string content;
+  {
+    std::ifstream is(file_path, std::ios::binary);
+    content.assign(std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>());
+  }
+  {
+    std::ofstream os(invalid_file_path, std::ios::binary);
+    os.write(content.data(), static_cast<std::streamsize>(content.size() - 4));
+  }
+  EXPECT_FALSE(loaded_map.loadFile(invalid_file_path));
+  {
+    // The voxel count is the last value of the header before the voxels
+    std::string invalid_content = content;
+    const std::size_t offset = invalid_content.size() - (4 * 4 * 4 * sizeof(std::uint32_t)) - sizeof(std::uint64_t);
+    const std::uint64_t invalid_size = std::numeric_limits<std::uint64_t>::max() / 2;
+    std::memcpy(&invalid_content[offset], &invalid_size, sizeof(std::uint64_t));
+    std::ofstream os(invalid_file_path, std::ios::binary);
+    os.write(invalid_content.data(), static_cast<std::streamsize>(invalid_content.size()));
+  }
+  EXPECT_FALSE(loaded_map.loadFile(invalid_file_path));
+  {
+    // The length of the working frame name is the first value after the header
+    std::string invalid_content = content;
+    const std::size_t offset = std::string("tesseract_reachability_map_1\n").size();
+    const std::uint64_t invalid_size = 4000;
+    std::memcpy(&invalid_content[offset], &invalid_size, sizeof(std::uint64_t));
+    std::ofstream os(invalid_file_path, std::ios::binary);
+    os.write(invalid_content.data(), 64);
+  }
+  EXPECT_FALSE(loaded_map.loadFile(invalid_file_path));
+  EXPECT_FALSE(loaded_map.loadFile(tesseract_common::getTempPath() + "reachability_map_does_not_exist.bin"));
+  EXPECT_TRUE(loaded_map == map);
+}
+
+TEST(TesseractKinematicsUnit, IKCacheUnit)  // NOLINT
+{
+  using tesseract_kinematics::IKCache;
+  using tesseract_kinematics::IKCacheConfig;
+  using tesseract_kinematics::IKSolutions;
+
+  {
+    IKCacheConfig config;
+    config.position_tolerance = 0;
+    EXPECT_ANY_THROW(IKCache{ config });  // NOLINT
+  }
+
+  {
+    IKCacheConfig config;
+    config.shard_count = 0;
+    EXPECT_ANY_THROW(IKCache{ config });  // NOLINT
+  }
+
+  IKCacheConfig config;
+  config.position_tolerance = 1e-3;
+  config.orientation_tolerance = 1e-3;
+  config.seed_tolerance = 0.1;
+  config.capacity = 2;
+  config.shard_count = 1;
+  IKCache cache(config);
+
+  auto createKey = [&cache](const Eigen::Isometry3d& pose, const Eigen::VectorXd& seed) {
+    std::string key;
+    cache.appendName(key, "base_link");
+    cache.appendName(key, "tool0");
+    cache.appendPose(key, pose);
+    cache.appendSeed(key, seed);
+    return key;
+  };
+
+  Eigen::Isometry3d pose = Eigen::Isometry3d::Identity();
+  pose.translation() = Eigen::Vector3d(0.5, -0.25, 1.0);
+  pose.linear() = Eigen::AngleAxisd(0.3, Eigen::Vector3d(1, 2, 3).normalized()).toRotationMatrix();
+  Eigen::VectorXd seed = Eigen::VectorXd::Constant(6, 0.22);
+
+  // Poses and seeds within the same quantization step share a key
+  Eigen::Isometry3d close_pose = pose;
+  close_pose.translation() += Eigen::Vector3d::Constant(1e-5);
+  EXPECT_EQ(createKey(pose, seed), createKey(close_pose, seed));
+  EXPECT_EQ(createKey(pose, seed), createKey(pose, Eigen::VectorXd::Constant(6, 0.23)));
+
+  Eigen::Isometry3d far_pose = pose;
+  far_pose.translation() += Eigen::Vector3d(0.01, 0, 0);
+  EXPECT_NE(createKey(pose, seed), createKey(far_pose, seed));
+  EXPECT_NE(createKey(pose, seed), createKey(pose, Eigen::VectorXd::Constant(6, 0.5)));
+
+  // Both quaternions of a rotation create the same key
+  Eigen::Isometry3d negated_pose = pose;
+  Eigen::Quaterniond q(pose.rotation());
+  q.coeffs() *= -1;
+  negated_pose.linear() = q.toRotationMatrix();
+  EXPECT_EQ(createKey(pose, seed), createKey(negated_pose, seed));
+
+  // The working frame and tip link are part of the key
+  {
+    std::string key;
+    cache.appendName(key, "base_link");
+    cache.appendName(key, "tool1");
+    cache.appendPose(key, pose);
+    cache.appendSeed(key, seed);
+    EXPECT_NE(createKey(pose, seed), key);
+  }
+
+  Eigen::VectorXd solution = Eigen::VectorXd::Constant(6, 0.5);
+  const std::string key1 = createKey(pose, seed);
+  const std::string key2 = createKey(far_pose, seed);
+  const std::string key3 = createKey(pose, Eigen::VectorXd::Constant(6, 0.5));
+
+  IKSolutions solutions;
+  EXPECT_FALSE(cache.get(solutions, key1, 0));
+  EXPECT_EQ(cache.getMissCount(), 1);
+
+  cache.put(key1, 0, { solution });
+  cache.put(key2, 0, {});
+  EXPECT_EQ(cache.size(), 2);
+  EXPECT_TRUE(cache.get(solutions, key1, 0));
+  ASSERT_EQ(solutions.size(), 1);
+  EXPECT_TRUE(solutions[0].isApprox(solution));
+  EXPECT_TRUE(cache.get(solutions, key2, 0));
+  EXPECT_TRUE(solutions.empty());
+  EXPECT_EQ(cache.getHitCount(), 2);
+
+  // Using key1 makes key2 the least recently used entry which is evicted when full
+  EXPECT_TRUE(cache.get(solutions, key1, 0));
+  cache.put(key3, 0, { solution, solution });
+  EXPECT_EQ(cache.size(), 2);
+  EXPECT_TRUE(cache.get(solutions, key1, 0));
+  EXPECT_FALSE(cache.get(solutions, key2, 0));
+  EXPECT_TRUE(cache.get(solutions, key3, 0));
+  EXPECT_EQ(solutions.size(), 2);
+
+  // Changing the revision clears the cache and entries of other revisions are ignored
+  cache.setRevision(0);
+  EXPECT_EQ(cache.size(), 2);
+  cache.setRevision(1);
+  EXPECT_EQ(cache.getRevision(), 1);
+  EXPECT_EQ(cache.size(), 0);
+  cache.put(key1, 0, { solution });
+  EXPECT_EQ(cache.size(), 0);
+  cache.put(key1, 1, { solution });
+  EXPECT_FALSE(cache.get(solutions, key1, 0));
+  EXPECT_TRUE(cache.get(solutions, key1, 1));
+
+  cache.clear();
+  EXPECT_EQ(cache.size(), 0);
+
+  // Nothing is cached without capacity
+  {
+    IKCacheConfig empty_config;
+    empty_config.capacity = 0;
+    IKCache empty_cache(empty_config);
+    empty_cache.put(key1, 0, { solution });
+    EXPECT_EQ(empty_cache.size(), 0);
+    EXPECT_FALSE(empty_cache.get(solutions, key1, 0));
+  }
+
+  // Concurrent access to a sharded cache
+  {
+    IKCacheConfig sharded_config;
+    sharded_config.capacity = 64;
+    sharded_config.shard_count = 4;
+    IKCache sharded_cache(sharded_config);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t)
+    {
+      threads.emplace_back([&sharded_cache, &solution, t]() {
+        for (int i = 0; i < 1000; ++i)
+        {
+          std::string key;
+          sharded_cache.appendName(key, std::to_string((t * 1000 + i) % 100));
+          IKSolutions found;
+          if (!sharded_cache.get(found, key, 0))
+            sharded_cache.put(key, 0, { solution });
+        }
+      });
+    }
+
+    for (auto& thread : threads)
+      thread.join();
+
+    EXPECT_LE(sharded_cache.size(), 64);
+    EXPECT_EQ(sharded_cache.getHitCount() + sharded_cache.getMissCount(), 4000);
+  }
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
@@ -432,6 +432,39 @@ inline void runStringVectorEqualTest(const std::vector<std::string>& names,
   //  EXPECT_TRUE(tesseract_common::isIdentical(names, target_names, false));
 }
 
+/**
+ * @brief Run inverse kinematics for a batch of poses and compare the solutions to solving each pose
+ * @param inv_kin The inverse kinematics object
+ * @param target_pose The target pose used for every pose of the batch
+ * @param tip_link_name The tip link of the target pose
+ * @param seed The seed used for solving inverse kinematics
+ */
+inline void runInvKinBatchTest(const tesseract_kinematics::InverseKinematics& inv_kin,
+                               const Eigen::Isometry3d& target_pose,
+                               const std::string& tip_link_name,
+                               const Eigen::VectorXd& seed)
+{
+  tesseract_common::TransformMap input{ std::make_pair(tip_link_name, target_pose) };
+  IKSolutions solutions = inv_kin.calcInvKin(input, seed);
+
+  tesseract_common::VectorIsometry3d poses(5, target_pose);
+  IKBatchSolutions batch_solutions = inv_kin.calcInvKinBatch(poses, seed);
+  ASSERT_EQ(batch_solutions.size(), poses.size());
+  EXPECT_EQ(batch_solutions.offsets.back(), batch_solutions.solutions.cols());
+  EXPECT_EQ(batch_solutions.solutions.rows(), inv_kin.numJoints());
+  for (std::size_t i = 0; i < batch_solutions.size(); ++i)
+  {
+    ASSERT_EQ(batch_solutions.getSolutionCount(i), static_cast<Eigen::Index>(solutions.size()));
+    for (std::size_t j = 0; j < solutions.size(); ++j)
+      EXPECT_TRUE(batch_solutions.getSolutions(i).col(static_cast<Eigen::Index>(j)).isApprox(solutions[j]));
+  }
+
+  // An empty batch has no solutions
+  IKBatchSolutions empty_solutions = inv_kin.calcInvKinBatch({}, seed);
+  EXPECT_EQ(empty_solutions.size(), 0);
+  EXPECT_EQ(empty_solutions.solutions.cols(), 0);
+}
+
 /**
  * @brief Run inverse kinematics test comparing the inverse solution to the forward solution
  * @param inv_kin The inverse kinematics object
@@ -463,6 +496,70 @@ inline void runInvKinTest(const tesseract_kinematics::InverseKinematics& inv_kin
     Eigen::Quaterniond rot_result(result.rotation());
     EXPECT_TRUE(rot_pose.isApprox(rot_result, 1e-3));
   }
+
+  runInvKinBatchTest(inv_kin, target_pose, tip_link_name, seed);
+}
+
+/**
+ * @brief Run inverse kinematics for a batch of poses and compare the solutions to solving each pose
+ * @param kin_group The kinematic group
+ * @param target_pose The target pose used for every pose of the batch
+ * @param working_frame The working frame of the target pose
+ * @param tip_link_name The tip link of the target pose
+ * @param seed The seed used for solving inverse kinematics
+ */
+inline void runInvKinBatchTest(const tesseract_kinematics::KinematicGroup& kin_group,
+                               const Eigen::Isometry3d& target_pose,
+                               const std::string& working_frame,
+                               const std::string& tip_link_name,
+                               const Eigen::VectorXd& seed)
+{
+  tesseract_common::VectorIsometry3d poses(7, target_pose);
+  IKSolutions solutions = kin_group.calcInvKin(KinGroupIKInput(target_pose, working_frame, tip_link_name), seed);
+
+  for (bool propagate_seed : { false, true })
+  {
+    for (std::size_t num_threads : { std::size_t(1), std::size_t(3) })
+    {
+      KinGroupIKBatchConfig config;
+      config.num_threads = num_threads;
+      config.propagate_seed = propagate_seed;
+      KinGroupIKBatchSolutions batch_solutions =
+          kin_group.calcInvKinBatch(poses, working_frame, tip_link_name, seed, config);
+      ASSERT_EQ(batch_solutions.size(), poses.size());
+      EXPECT_EQ(batch_solutions.offsets.back(), batch_solutions.solutions.cols());
+      EXPECT_EQ(batch_solutions.solutions.rows(), kin_group.numJoints());
+
+      for (std::size_t i = 0; i < batch_solutions.size(); ++i)
+      {
+        EXPECT_GT(batch_solutions.getSolutionCount(i), 0);
+
+        // Without seed propagation every pose is solved using the same seed as calcInvKin
+        if (!propagate_seed)
+        {
+          ASSERT_EQ(batch_solutions.getSolutionCount(i), static_cast<Eigen::Index>(solutions.size()));
+          for (std::size_t j = 0; j < solutions.size(); ++j)
+            EXPECT_TRUE(batch_solutions.getSolutions(i).col(static_cast<Eigen::Index>(j)).isApprox(solutions[j]));
+        }
+
+        for (Eigen::Index j = 0; j < batch_solutions.getSolutionCount(i); ++j)
+        {
+          tesseract_common::TransformMap result_poses = kin_group.calcFwdKin(batch_solutions.getSolutions(i).col(j));
+          Eigen::Isometry3d result = result_poses.at(working_frame).inverse() * result_poses[tip_link_name];
+          EXPECT_TRUE(target_pose.translation().isApprox(result.translation(), 1e-4));
+
+          Eigen::Quaterniond rot_pose(target_pose.rotation());
+          Eigen::Quaterniond rot_result(result.rotation());
+          EXPECT_TRUE(rot_pose.isApprox(rot_result, 1e-3));
+        }
+      }
+    }
+  }
+
+  // An empty batch has no solutions
+  KinGroupIKBatchSolutions empty_solutions = kin_group.calcInvKinBatch({}, working_frame, tip_link_name, seed);
+  EXPECT_EQ(empty_solutions.size(), 0);
+  EXPECT_EQ(empty_solutions.solutions.cols(), 0);
 }
 
 /**
@@ -496,6 +593,8 @@ inline void runInvKinTest(const tesseract_kinematics::KinematicGroup& kin_group,
   }
 
   EXPECT_TRUE(checkKinematics(kin_group));
+
+  runInvKinBatchTest(kin_group, target_pose, working_frame, tip_link_name, seed);
 }
 
 inline void runFwdKinIIWATest(tesseract_kinematics::ForwardKinematics& kin)
@@ -193,6 +193,84 @@ TEST(TesseractKinematicsUnit, RobotOnPositionerInverseKinematicUnit)  // NOLINT
   runKinSetJointLimitsTest(kin_group2);
 }
 
+TEST(TesseractKinematicsUnit, RobotOnPositionerReachabilityMapUnit)  // NOLINT
+{
+  auto scene_graph = getSceneGraphABBOnPositioner();
+
+  tesseract_scene_graph::KDLStateSolver state_solver(*scene_graph);
+  tesseract_scene_graph::SceneState scene_state = state_solver.getState();
+
+  std::string tip_link_name = "tool0";
+  std::vector<std::string> robot_joint_names{ "joint_1", "joint_2", "joint_3", "joint_4", "joint_5", "joint_6" };
+  auto robot_fwd_kin = getRobotFwdKinematics(*scene_graph);
+  auto positioner_kin = getPositionerFwdKinematics(*scene_graph);
+  auto full_fwd_kin = getFullFwdKinematics(*scene_graph);
+  auto opw_kin = std::make_unique<OPWInvKin>(
+      getOPWKinematicsParamABB(), robot_fwd_kin->getBaseLinkName(), tip_link_name, robot_joint_names);
+
+  // Create the reachability map of the manipulator
+  KinematicGroup robot_kin_group("robot", robot_joint_names, opw_kin->clone(), *scene_graph, scene_state);
+  ReachabilityMapConfig config;
+  config.resolution = 0.2;
+  config.fk_samples = 100000;
+  config.ik_samples = 1;
+  config.num_threads = 2;
+  auto reachability_map = std::make_shared<ReachabilityMap>(
+      ReachabilityMap::create(robot_kin_group, robot_fwd_kin->getBaseLinkName(), tip_link_name, config));
+  EXPECT_GT(reachability_map->getReachableVoxelCount(), 0);
+
+  // The same configuration should create the same map
+  EXPECT_TRUE(*reachability_map == ReachabilityMap::create(
+                                       robot_kin_group, robot_fwd_kin->getBaseLinkName(), tip_link_name, config));
+
+  // Forward kinematics of the manipulator should be reachable
+  Eigen::VectorXd robot_joint_values = Eigen::VectorXd::Zero(6);
+  robot_joint_values(1) = 0.3;
+  Eigen::Isometry3d robot_pose = robot_fwd_kin->calcFwdKin(robot_joint_values).at(tip_link_name);
+  EXPECT_TRUE(reachability_map->isReachable(robot_pose.translation()));
+
+  Eigen::VectorXd positioner_resolution = Eigen::VectorXd::Constant(1, 1, 0.1);
+  ROPInvKin rop_inv_kin(
+      *scene_graph, scene_state, opw_kin->clone(), 2.5, positioner_kin->clone(), positioner_resolution);
+  EXPECT_TRUE(rop_inv_kin.getReachabilityMap() == nullptr);
+
+  Eigen::Isometry3d pose;
+  pose.setIdentity();
+  pose.translation()[0] = 1;
+  pose.translation()[1] = 0;
+  pose.translation()[2] = 1.306;
+  tesseract_common::TransformMap input{ std::make_pair(tip_link_name, pose) };
+  Eigen::VectorXd seed = Eigen::VectorXd::Zero(7);
+  IKSolutions solutions = rop_inv_kin.calcInvKin(input, seed);
+
+  // Pruning should only skip positioner samples which have no solutions so the solutions are unchanged
+  rop_inv_kin.setReachabilityMap(reachability_map);
+  EXPECT_TRUE(rop_inv_kin.getReachabilityMap() == reachability_map);
+  IKSolutions pruned_solutions = rop_inv_kin.calcInvKin(input, seed);
+  EXPECT_FALSE(pruned_solutions.empty());
+  ASSERT_EQ(pruned_solutions.size(), solutions.size());
+  for (std::size_t i = 0; i < solutions.size(); ++i)
+    EXPECT_TRUE(pruned_solutions[i].isApprox(solutions[i], 1e-8));
+  runInvKinTest(rop_inv_kin, *full_fwd_kin, pose, tip_link_name, seed);
+
+  // The map is copied with the solver
+  InverseKinematics::UPtr rop_inv_kin2 = rop_inv_kin.clone();
+  EXPECT_EQ(rop_inv_kin2->calcInvKin(input, seed).size(), pruned_solutions.size());
+
+  // An empty map skips every positioner sample
+  rop_inv_kin.setReachabilityMap(std::make_shared<ReachabilityMap>(
+      robot_fwd_kin->getBaseLinkName(), tip_link_name, Eigen::Vector3d::Zero(), 0.1, std::array<std::size_t, 3>{}));
+  EXPECT_TRUE(rop_inv_kin.calcInvKin(input, seed).empty());
+
+  // A map of a different tip link is rejected
+  auto invalid_map = std::make_shared<ReachabilityMap>(
+      robot_fwd_kin->getBaseLinkName(), "link_6", Eigen::Vector3d::Zero(), 0.1, std::array<std::size_t, 3>{});
+  EXPECT_ANY_THROW(rop_inv_kin.setReachabilityMap(invalid_map));  // NOLINT
+
+  rop_inv_kin.setReachabilityMap(nullptr);
+  EXPECT_EQ(rop_inv_kin.calcInvKin(input, seed).size(), solutions.size());
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
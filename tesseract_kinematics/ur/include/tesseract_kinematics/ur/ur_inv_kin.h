@@ -38,6 +38,11 @@
 #ifndef TESSERACT_KINEMATICS_UR_INV_KIN_H
 #define TESSERACT_KINEMATICS_UR_INV_KIN_H
 
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <array>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
 #include <tesseract_kinematics/core/inverse_kinematics.h>
 #include <tesseract_kinematics/core/types.h>
 
@@ -81,6 +86,10 @@ public:
   tesseract_kinematics::IKSolutions calcInvKin(const tesseract_common::TransformMap& tip_link_poses,
                                                const Eigen::Ref<const Eigen::VectorXd>& seed) const override final;
 
+  tesseract_kinematics::IKBatchSolutions
+  calcInvKinBatch(const tesseract_common::VectorIsometry3d& tip_link_poses,
+                  const Eigen::Ref<const Eigen::VectorXd>& seed) const override final;
+
   Eigen::Index numJoints() const override final;
   std::vector<std::string> getJointNames() const override final;
   std::string getBaseLinkName() const override final;
@@ -95,6 +104,14 @@ protected:
   std::string tip_link_name_;            /**< @brief Link name of last kink in the kinematic object */
   std::vector<std::string> joint_names_; /**< @brief Joint names for the kinematic object */
   std::string solver_name_{ UR_INV_KIN_CHAIN_SOLVER_NAME }; /**< @brief Name of this solver */
+  /**
+   * @brief Solve the analytic inverse kinematics and harmonize the solutions between [-PI, PI]
+   * @param sols The solutions of the tip link pose
+   * @param tip_link_pose The pose of the tip link relative to the base link
+   * @return The number of solutions
+   */
+  std::size_t calcInvKinHelper(std::array<std::array<double, 6>, 8>& sols,
+                               const Eigen::Isometry3d& tip_link_pose) const;
 };
 }  // namespace tesseract_kinematics
 
@@ -257,31 +257,65 @@ IKSolutions URInvKin::calcInvKin(const tesseract_common::TransformMap& tip_link_
 {
   assert(tip_link_poses.size() == 1);
   assert(tip_link_poses.find(tip_link_name_) != tip_link_poses.end());
-  assert(std::abs(1.0 - tip_link_poses.at(tip_link_name_).matrix().determinant()) < 1e-6);  // NOLINT
 
-  Eigen::Isometry3d base_offset = Eigen::Isometry3d::Identity() * Eigen::AngleAxisd(M_PI, Eigen::Vector3d::UnitZ());
-  Eigen::Isometry3d corrected_pose = base_offset.inverse() * tip_link_poses.at(tip_link_name_);
-
-  // Do the analytic IK
   // NOLINTNEXTLINE
   std::array<std::array<double, 6>, 8> sols;  // maximum of 8 IK solutions
-  auto num_sols = static_cast<std::size_t>(inverse(corrected_pose, params_, sols[0].data(), 0));
+  std::size_t num_sols = calcInvKinHelper(sols, tip_link_poses.at(tip_link_name_));
 
   // Check the output
   IKSolutions solution_set;
   solution_set.reserve(num_sols);
   for (std::size_t i = 0; i < num_sols; ++i)
+    solution_set.emplace_back(Eigen::Map<Eigen::VectorXd>(sols[i].data(), static_cast<Eigen::Index>(sols[i].size())));
+
+  return solution_set;
+}
+
+IKBatchSolutions URInvKin::calcInvKinBatch(const tesseract_common::VectorIsometry3d& tip_link_poses,
+                                           const Eigen::Ref<const Eigen::VectorXd>& /*seed*/) const
+{
+  // Every pose has at most eight solutions so the solutions are written directly into a single buffer
+  IKBatchSolutions batch_solutions;
+  batch_solutions.solutions.resize(6, 8 * static_cast<Eigen::Index>(tip_link_poses.size()));
+  batch_solutions.offsets.reserve(tip_link_poses.size() + 1);
+  batch_solutions.offsets.push_back(0);
+
+  // NOLINTNEXTLINE
+  std::array<std::array<double, 6>, 8> sols;  // maximum of 8 IK solutions
+  Eigen::Index num_solutions{ 0 };
+  for (const auto& tip_link_pose : tip_link_poses)
   {
-    Eigen::Map<Eigen::VectorXd> eigen_sol(sols[i].data(), static_cast<Eigen::Index>(sols[i].size()));
+    std::size_t num_sols = calcInvKinHelper(sols, tip_link_pose);
+    for (std::size_t i = 0; i < num_sols; ++i)
+      batch_solutions.solutions.col(num_solutions++) = Eigen::Map<const Eigen::Matrix<double, 6, 1>>(sols[i].data());
+
+    batch_solutions.offsets.push_back(num_solutions);
+  }
 
+  batch_solutions.solutions.conservativeResize(Eigen::NoChange, num_solutions);
+  return batch_solutions;
+}
+
+std::size_t URInvKin::calcInvKinHelper(std::array<std::array<double, 6>, 8>& sols,
+                                       const Eigen::Isometry3d& tip_link_pose) const
+{
+  assert(std::abs(1.0 - tip_link_pose.matrix().determinant()) < 1e-6);  // NOLINT
+
+  // The base of the analytic solution is rotated by PI about the z-axis
+  static const Eigen::Isometry3d base_offset_inv =
+      (Eigen::Isometry3d::Identity() * Eigen::AngleAxisd(M_PI, Eigen::Vector3d::UnitZ())).inverse();
+  Eigen::Isometry3d corrected_pose = base_offset_inv * tip_link_pose;
+
+  // Do the analytic IK
+  auto num_sols = static_cast<std::size_t>(inverse(corrected_pose, params_, sols[0].data(), 0));
+  for (std::size_t i = 0; i < num_sols; ++i)
+  {
     // Harmonize between [-PI, PI]
+    Eigen::Map<Eigen::VectorXd> eigen_sol(sols[i].data(), static_cast<Eigen::Index>(sols[i].size()));
     harmonizeTowardZero<double>(eigen_sol, REDUNDANT_CAPABLE_JOINTS);  // Modifies 'sol' in place
-
-    // Add solution
-    solution_set.push_back(eigen_sol);
   }
 
-  return solution_set;
+  return num_sols;
 }
 
 Eigen::Index URInvKin::numJoints() const { return 6; }
@@ -36,6 +36,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <boost/serialization/access.hpp>
 #include <string>
 #include <list>
+#include <mutex>
 #include <unordered_map>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
@@ -498,6 +499,8 @@ public:
 
   /**
    * @brief Get the shortest path between two links
+   * @details If the graph is a tree this walks up from both links to their common ancestor using a cached index,
+   * otherwise the graph is searched.
    * @param root The base link
    * @param tip The tip link
    * @return The shortest path between the two links
@@ -573,9 +576,64 @@ private:
   std::unordered_map<std::string, std::pair<Joint::Ptr, Edge>> joint_map_;
   tesseract_common::AllowedCollisionMatrix::Ptr acm_;
 
+  /**
+   * @brief A cache of the parent, depth and children of every link used when the graph is a tree
+   * @details When the graph is a tree there is a single path between two links which is found by walking up from both
+   * links to their lowest common ancestor, so shortest path and children queries are O(depth) instead of searching the
+   * whole graph. It is built the first time it is needed and cleared whenever a link or joint is added, removed or moved.
+   */
+  struct TreeIndex
+  {
+    /** @brief Indicates if the graph is a tree, if false the index is empty and the graph must be searched */
+    bool is_tree{ false };
+
+    /** @brief Map of link name to index */
+    std::unordered_map<std::string, std::size_t> index;
+
+    /** @brief The link names in breadth first order starting with the root */
+    std::vector<std::string> names;
+
+    /** @brief The index of the parent link, the root is its own parent */
+    std::vector<std::size_t> parent;
+
+    /** @brief The joint connecting the link to its parent link, nullptr for the root */
+    std::vector<Joint::ConstPtr> parent_joint;
+
+    /** @brief The number of joints between the link and the root */
+    std::vector<std::size_t> depth;
+
+    /** @brief The index of the child links in the same order as the outbound joints */
+    std::vector<std::vector<std::size_t>> children;
+
+    /**
+     * @brief Get the index of a link
+     * @param name The link name
+     * @return The index of the link, throws if the link does not exist
+     */
+    std::size_t getIndex(const std::string& name) const;
+  };
+
+  mutable std::shared_ptr<const TreeIndex> tree_index_;
+  mutable std::mutex tree_index_mutex_;
+
   /** @brief The rebuild the link and joint map by extraction information from the graph */
   void rebuildLinkAndJointMaps();
 
+  /** @brief Get the tree index, building it if it has been cleared */
+  std::shared_ptr<const TreeIndex> getTreeIndex() const;
+
+  /** @brief Clear the tree index, this must be called whenever the structure of the graph changes */
+  void clearTreeIndex();
+
+  /**
+   * @brief Get the shortest path between two links by searching the graph
+   * @details This is used when the graph is not a tree
+   * @param root The base link
+   * @param tip The tip link
+   * @return The shortest path between the two links
+   */
+  ShortestPath getShortestPathHelper(const std::string& root, const std::string& tip) const;
+
   struct cycle_detector : public boost::dfs_visitor<>
   {
     cycle_detector(bool& ascyclic) : ascyclic_(ascyclic) {}
@@ -720,6 +778,17 @@ private:
     return child_link_names;
   }
 
+  /**
+   * @brief Get the children of a link using the tree index
+   *
+   * Note: This list will include the start link and is in the same order as getLinkChildrenHelper(Vertex)
+   *
+   * @param tree_index The tree index
+   * @param start_index The index of the link to find children for
+   * @return A list of child link names including the start link
+   */
+  static std::vector<std::string> getLinkChildrenHelper(const TreeIndex& tree_index, std::size_t start_index);
+
   friend class boost::serialization::access;
   template <class Archive>
   void save(Archive& ar, const unsigned int version) const;  // NOLINT
@@ -124,6 +124,7 @@ void SceneGraph::clear()
   link_map_.clear();
   joint_map_.clear();
   acm_->clearAllowedCollisions();
+  clearTreeIndex();
 }
 
 void SceneGraph::setName(const std::string& name)
@@ -144,6 +145,7 @@ bool SceneGraph::setRoot(const std::string& name)
     return false;
 
   boost::set_property(static_cast<Graph&>(*this), boost::graph_root, name);
+  clearTreeIndex();
 
   return true;
 }
@@ -203,6 +205,7 @@ bool SceneGraph::addLinkHelper(const Link::Ptr& link_ptr, bool replace_allowed)
     VertexProperty info(link_ptr, data);
     Vertex v = boost::add_vertex(info, static_cast<Graph&>(*this));
     link_map_[link_ptr->getName()] = std::make_pair(link_ptr, v);
+    clearTreeIndex();
 
     // First link added set as root
     if (link_map_.size() == 1)
@@ -272,6 +275,7 @@ bool SceneGraph::removeLink(const std::string& name, bool recursive)
   // Now remove vertex
   boost::remove_vertex(found->second.second, static_cast<Graph&>(*this));
   link_map_.erase(name);
+  clearTreeIndex();
 
   // Need to remove any reference to link in allowed collision matrix
   removeAllowedCollision(name);
@@ -401,6 +405,7 @@ bool SceneGraph::addJointHelper(const Joint::Ptr& joint_ptr)
       boost::add_edge(parent->second.second, child->second.second, info, static_cast<Graph&>(*this));
   assert(e.second == true);
   joint_map_[joint_ptr->getName()] = std::make_pair(joint_ptr, e.first);
+  clearTreeIndex();
 
   return true;
 }
@@ -424,6 +429,7 @@ bool SceneGraph::removeJoint(const std::string& name, bool recursive)
   {
     boost::remove_edge(found->second.second, static_cast<Graph&>(*this));
     joint_map_.erase(name);
+    clearTreeIndex();
   }
   else
   {
@@ -764,6 +770,14 @@ std::vector<std::string> SceneGraph::getInvAdjacentLinkNames(const std::string&
 
 std::vector<std::string> SceneGraph::getLinkChildrenNames(const std::string& name) const
 {
+  std::shared_ptr<const TreeIndex> tree_index = getTreeIndex();
+  if (tree_index->is_tree)
+  {
+    std::vector<std::string> child_link_names = getLinkChildrenHelper(*tree_index, tree_index->getIndex(name));
+    child_link_names.erase(child_link_names.begin());
+    return child_link_names;
+  }
+
   Vertex v = getVertex(name);
   std::vector<std::string> child_link_names = getLinkChildrenHelper(v);
 
@@ -774,6 +788,16 @@ std::vector<std::string> SceneGraph::getLinkChildrenNames(const std::string& nam
 
 std::vector<std::string> SceneGraph::getJointChildrenNames(const std::string& name) const
 {
+  std::shared_ptr<const TreeIndex> tree_index = getTreeIndex();
+  if (tree_index->is_tree)
+  {
+    auto found = joint_map_.find(name);
+    if (found == joint_map_.end())
+      throw std::runtime_error("SceneGraph, edge with name '" + name + "' does not exist!");
+
+    return getLinkChildrenHelper(*tree_index, tree_index->getIndex(found->second.first->child_link_name));
+  }
+
   const auto& graph = static_cast<const Graph&>(*this);
   Edge e = getEdge(name);
   Vertex v = boost::target(e, graph);
@@ -854,6 +878,66 @@ void SceneGraph::saveDOT(const std::string& path) const
 }
 
 ShortestPath SceneGraph::getShortestPath(const std::string& root, const std::string& tip) const
+{
+  std::shared_ptr<const TreeIndex> tree_index = getTreeIndex();
+  if (!tree_index->is_tree)
+    return getShortestPathHelper(root, tip);
+
+  std::size_t r = tree_index->getIndex(root);
+  std::size_t t = tree_index->getIndex(tip);
+
+  // Walk up from both links until the lowest common ancestor is reached
+  std::vector<std::size_t> root_side;
+  std::vector<std::size_t> tip_side;
+  while (tree_index->depth[r] > tree_index->depth[t])
+  {
+    root_side.push_back(r);
+    r = tree_index->parent[r];
+  }
+
+  while (tree_index->depth[t] > tree_index->depth[r])
+  {
+    tip_side.push_back(t);
+    t = tree_index->parent[t];
+  }
+
+  while (r != t)
+  {
+    root_side.push_back(r);
+    r = tree_index->parent[r];
+    tip_side.push_back(t);
+    t = tree_index->parent[t];
+  }
+
+  ShortestPath path;
+  path.links.reserve(root_side.size() + tip_side.size() + 1);
+  path.joints.reserve(root_side.size() + tip_side.size());
+  path.active_joints.reserve(root_side.size() + tip_side.size());
+
+  auto add_joint = [&path](const Joint::ConstPtr& joint) {
+    path.joints.push_back(joint->getName());
+    if (joint->type != JointType::FIXED && joint->type != JointType::FLOATING)
+      path.active_joints.push_back(joint->getName());
+  };
+
+  for (std::size_t i : root_side)
+  {
+    path.links.push_back(tree_index->names[i]);
+    add_joint(tree_index->parent_joint[i]);
+  }
+
+  path.links.push_back(tree_index->names[r]);
+
+  for (auto it = tip_side.rbegin(); it != tip_side.rend(); ++it)
+  {
+    add_joint(tree_index->parent_joint[*it]);
+    path.links.push_back(tree_index->names[*it]);
+  }
+
+  return path;
+}
+
+ShortestPath SceneGraph::getShortestPathHelper(const std::string& root, const std::string& tip) const
 {
   // Must copy to undirected graph because order does not matter for creating kinematics chains.
 
@@ -1098,6 +1182,7 @@ void SceneGraph::rebuildLinkAndJointMaps()
 {
   link_map_.clear();
   joint_map_.clear();
+  clearTreeIndex();
 
   {  // Rebuild link map
     Graph::vertex_iterator i, iend;
@@ -1118,6 +1203,104 @@ void SceneGraph::rebuildLinkAndJointMaps()
   }
 }
 
+std::size_t SceneGraph::TreeIndex::getIndex(const std::string& name) const
+{
+  auto found = index.find(name);
+  if (found == index.end())
+    throw std::runtime_error("SceneGraph, vertex with name '" + name + "' does not exist!");
+
+  return found->second;
+}
+
+std::shared_ptr<const SceneGraph::TreeIndex> SceneGraph::getTreeIndex() const
+{
+  std::scoped_lock lock(tree_index_mutex_);
+  if (tree_index_ != nullptr)
+    return tree_index_;
+
+  const auto& graph = static_cast<const Graph&>(*this);
+
+  // The root must not have a parent and every other link must have exactly one parent and be reachable from the root
+  auto root = link_map_.find(getRoot());
+  if (root == link_map_.end() || boost::in_degree(root->second.second, graph) != 0)
+  {
+    tree_index_ = std::make_shared<const TreeIndex>();
+    return tree_index_;
+  }
+
+  auto tree_index = std::make_shared<TreeIndex>();
+  std::size_t num_links = boost::num_vertices(graph);
+  tree_index->names.reserve(num_links);
+  tree_index->parent.reserve(num_links);
+  tree_index->parent_joint.reserve(num_links);
+  tree_index->depth.reserve(num_links);
+  tree_index->children.reserve(num_links);
+
+  std::vector<Vertex> vertices;
+  vertices.reserve(num_links);
+  vertices.push_back(root->second.second);
+  tree_index->names.push_back(root->first);
+  tree_index->parent.push_back(0);
+  tree_index->parent_joint.push_back(nullptr);
+  tree_index->depth.push_back(0);
+  tree_index->children.emplace_back();
+
+  for (std::size_t i = 0; i < vertices.size(); ++i)
+  {
+    for (const auto& e : boost::make_iterator_range(boost::out_edges(vertices[i], graph)))
+    {
+      Vertex child = boost::target(e, graph);
+      if (boost::in_degree(child, graph) != 1)
+      {
+        tree_index_ = std::make_shared<const TreeIndex>();
+        return tree_index_;
+      }
+
+      std::size_t child_index = vertices.size();
+      vertices.push_back(child);
+      tree_index->names.push_back(boost::get(boost::vertex_link, graph)[child]->getName());
+      tree_index->parent.push_back(i);
+      tree_index->parent_joint.push_back(boost::get(boost::edge_joint, graph)[e]);
+      tree_index->depth.push_back(tree_index->depth[i] + 1);
+      tree_index->children[i].push_back(child_index);
+      tree_index->children.emplace_back();
+    }
+  }
+
+  if (vertices.size() != num_links)
+  {
+    tree_index_ = std::make_shared<const TreeIndex>();
+    return tree_index_;
+  }
+
+  tree_index->index.reserve(num_links);
+  for (std::size_t i = 0; i < tree_index->names.size(); ++i)
+    tree_index->index[tree_index->names[i]] = i;
+
+  tree_index->is_tree = true;
+  tree_index_ = tree_index;
+  return tree_index_;
+}
+
+void SceneGraph::clearTreeIndex()
+{
+  std::scoped_lock lock(tree_index_mutex_);
+  tree_index_ = nullptr;
+}
+
+std::vector<std::string> SceneGraph::getLinkChildrenHelper(const TreeIndex& tree_index, std::size_t start_index)
+{
+  std::vector<std::string> child_link_names;
+  std::vector<std::size_t> queue{ start_index };
+  for (std::size_t i = 0; i < queue.size(); ++i)
+  {
+    child_link_names.push_back(tree_index.names[queue[i]]);
+    queue.insert(queue.end(), tree_index.children[queue[i]].begin(), tree_index.children[queue[i]].end());
+  }
+
+  return child_link_names;
+}
+
 bool SceneGraph::operator==(const SceneGraph& rhs) const
 {
   using namespace tesseract_common;
@@ -289,6 +289,53 @@ TEST(TesseractSceneGraphUnit, TesseractSceneGraphUnit)  // NOLINT
   }
 }
 
+TEST(TesseractSceneGraphUnit, TesseractSceneGraphTreeShortestPathUnit)  // NOLINT
+{
+  using namespace tesseract_scene_graph;
+  SceneGraph g = createTestSceneGraph();
+  EXPECT_TRUE(g.isTree());
+
+  {  // Path through the common parent link
+    ShortestPath path = g.getShortestPath("link_4", "link_5");
+    EXPECT_EQ(path.links, std::vector<std::string>({ "link_4", "link_3", "link_2", "link_5" }));
+    EXPECT_EQ(path.joints, std::vector<std::string>({ "joint_3", "joint_2", "joint_4" }));
+    EXPECT_EQ(path.active_joints, std::vector<std::string>({ "joint_2", "joint_4" }));
+  }
+
+  {  // Path from the root
+    ShortestPath path = g.getShortestPath("link_1", "link_4");
+    EXPECT_EQ(path.links, std::vector<std::string>({ "link_1", "link_2", "link_3", "link_4" }));
+    EXPECT_EQ(path.joints, std::vector<std::string>({ "joint_1", "joint_2", "joint_3" }));
+    EXPECT_EQ(path.active_joints, std::vector<std::string>({ "joint_2" }));
+  }
+
+  {  // Path to itself
+    ShortestPath path = g.getShortestPath("link_3", "link_3");
+    EXPECT_EQ(path.links, std::vector<std::string>({ "link_3" }));
+    EXPECT_TRUE(path.joints.empty());
+    EXPECT_TRUE(path.active_joints.empty());
+  }
+
+  EXPECT_EQ(g.getLinkChildrenNames("link_2"), std::vector<std::string>({ "link_3", "link_5", "link_4" }));
+  EXPECT_EQ(g.getJointChildrenNames("joint_1"), std::vector<std::string>({ "link_2", "link_3", "link_5", "link_4" }));
+
+  // The cached tree must be updated when the graph changes
+  EXPECT_TRUE(g.moveJoint("joint_4", "link_4"));
+  {
+    ShortestPath path = g.getShortestPath("link_5", "link_1");
+    EXPECT_EQ(path.links, std::vector<std::string>({ "link_5", "link_4", "link_3", "link_2", "link_1" }));
+    EXPECT_EQ(path.joints, std::vector<std::string>({ "joint_4", "joint_3", "joint_2", "joint_1" }));
+    EXPECT_EQ(path.active_joints, std::vector<std::string>({ "joint_4", "joint_2" }));
+  }
+  EXPECT_EQ(g.getLinkChildrenNames("link_3"), std::vector<std::string>({ "link_4", "link_5" }));
+
+  EXPECT_TRUE(g.removeLink("link_4", true));
+  EXPECT_EQ(g.getLinkChildrenNames("link_2"), std::vector<std::string>({ "link_3" }));
+
+  EXPECT_ANY_THROW(g.getShortestPath("link_4", "link_1"));  // NOLINT
+  EXPECT_ANY_THROW(g.getLinkChildrenNames("link_5"));       // NOLINT
+}
+
 TEST(TesseractSceneGraphUnit, TesseractSceneGraphClearUnit)  // NOLINT
 {
   using namespace tesseract_scene_graph;
@@ -1,6 +1,6 @@
 /**
  * @file disabled_collisions.h
- * @brief Parse disabled collision data from srdf file
+ * @brief Parse and write disabled collision data from srdf file
  *
  * @author Levi Armstrong
  * @date March 13, 2021
@@ -34,7 +34,8 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 namespace tinyxml2
 {
-class XMLElement;  // NOLINT
+class XMLElement;   // NOLINT
+class XMLDocument;  // NOLINT
 }
 namespace tesseract_scene_graph
 {
@@ -58,6 +59,17 @@ tesseract_common::AllowedCollisionMatrix parseDisabledCollisions(const tesseract
                                                                  const tinyxml2::XMLElement* srdf_xml,
                                                                  const std::array<int, 3>& version);
 
+/**
+ * @brief Write allowed collisions as srdf disable_collisions xml elements
+ * @details The entries are written in alphabetical order of their link pairs along with their reasons
+ * @param doc The xml document used to create the elements
+ * @param srdf_xml The xml element the disable_collisions elements are appended to
+ * @param acm The allowed collision matrix to write
+ */
+void writeDisabledCollisions(tinyxml2::XMLDocument& doc,
+                             tinyxml2::XMLElement* srdf_xml,
+                             const tesseract_common::AllowedCollisionMatrix& acm);
+
 }  // namespace tesseract_srdf
 
 #endif  // TESSERACT_SRDF_DISABLED_COLLISIONS_H
@@ -32,6 +32,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_common/utils.h>
 #include <tesseract_srdf/disabled_collisions.h>
+#include <tesseract_srdf/utils.h>
 #include <tesseract_scene_graph/graph.h>
 #include <tesseract_common/allowed_collision_matrix.h>
 
@@ -78,4 +79,20 @@ tesseract_common::AllowedCollisionMatrix parseDisabledCollisions(const tesseract
 
   return acm;
 }
+
+void writeDisabledCollisions(tinyxml2::XMLDocument& doc,
+                             tinyxml2::XMLElement* srdf_xml,
+                             const tesseract_common::AllowedCollisionMatrix& acm)
+{
+  const auto allowed_collision_entries = acm.getAllAllowedCollisions();
+  auto acm_keys = getAlphabeticalACMKeys(allowed_collision_entries);
+  for (const auto& key : acm_keys)
+  {
+    tinyxml2::XMLElement* xml_acm_entry = doc.NewElement("disable_collisions");
+    xml_acm_entry->SetAttribute("link1", key.get().first.c_str());
+    xml_acm_entry->SetAttribute("link2", key.get().second.c_str());
+    xml_acm_entry->SetAttribute("reason", allowed_collision_entries.at(key.get()).c_str());
+    srdf_xml->InsertEndChild(xml_acm_entry);
+  }
+}
 }  // namespace tesseract_srdf
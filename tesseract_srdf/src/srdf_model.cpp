@@ -375,16 +375,7 @@ bool SRDFModel::saveToFile(const std::string& file_path) const
   }
 
   // Write the ACM
-  const auto allowed_collision_entries = acm.getAllAllowedCollisions();
-  auto acm_keys = getAlphabeticalACMKeys(allowed_collision_entries);
-  for (const auto& key : acm_keys)
-  {
-    tinyxml2::XMLElement* xml_acm_entry = doc.NewElement("disable_collisions");
-    xml_acm_entry->SetAttribute("link1", key.get().first.c_str());
-    xml_acm_entry->SetAttribute("link2", key.get().second.c_str());
-    xml_acm_entry->SetAttribute("reason", allowed_collision_entries.at(key.get()).c_str());
-    xml_root->InsertEndChild(xml_acm_entry);
-  }
+  writeDisabledCollisions(doc, xml_root, acm);
 
   if (collision_margin_data != nullptr)
   {
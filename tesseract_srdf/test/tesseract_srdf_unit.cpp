@@ -914,6 +914,39 @@ TEST(TesseractSRDFUnit, LoadSRDFAllowedCollisionMatrixUnit)  // NOLINT
   }
 }
 
+TEST(TesseractSRDFUnit, WriteSRDFAllowedCollisionMatrixUnit)  // NOLINT
+{
+  using namespace tesseract_scene_graph;
+  using namespace tesseract_srdf;
+
+  SceneGraph::Ptr g = getABBSceneGraph();
+
+  tesseract_common::AllowedCollisionMatrix acm;
+  acm.addAllowedCollision("link_1", "base_link", "Adjacent");
+  acm.addAllowedCollision("base_link", "link_3", "Never");
+  acm.addAllowedCollision("base_link", "link_2", "Always");
+
+  tinyxml2::XMLDocument xml_doc;
+  tinyxml2::XMLElement* element = xml_doc.NewElement("robot");
+  xml_doc.InsertEndChild(element);
+  writeDisabledCollisions(xml_doc, element, acm);
+
+  // Entries are written in alphabetical order
+  const tinyxml2::XMLElement* xml_entry = element->FirstChildElement("disable_collisions");
+  ASSERT_TRUE(xml_entry != nullptr);
+  EXPECT_EQ(std::string(xml_entry->Attribute("link1")), "base_link");
+  EXPECT_EQ(std::string(xml_entry->Attribute("link2")), "link_1");
+  EXPECT_EQ(std::string(xml_entry->Attribute("reason")), "Adjacent");
+  xml_entry = xml_entry->NextSiblingElement("disable_collisions");
+  ASSERT_TRUE(xml_entry != nullptr);
+  EXPECT_EQ(std::string(xml_entry->Attribute("link2")), "link_2");
+  EXPECT_EQ(std::string(xml_entry->Attribute("reason")), "Always");
+
+  tesseract_common::AllowedCollisionMatrix parsed_acm =
+      parseDisabledCollisions(*g, element, std::array<int, 3>({ 1, 0, 0 }));
+  EXPECT_EQ(parsed_acm, acm);
+}
+
 TEST(TesseractSRDFUnit, SRDFChainGroupUnit)  // NOLINT
 {
   using namespace tesseract_scene_graph;
@@ -0,0 +1,154 @@
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <benchmark/benchmark.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_state_solver/kdl/kdl_state_solver.h>
+#include <tesseract_state_solver/ofkt/ofkt_state_solver.h>
+#include <tesseract_common/utils.h>
+#include <tesseract_urdf/urdf_parser.h>
+#include <tesseract_support/tesseract_support_resource_locator.h>
+
+using namespace tesseract_scene_graph;
+
+SceneGraph::UPtr getSceneGraph(const std::string& urdf_name)
+{
+  std::string path = std::string(TESSERACT_SUPPORT_DIR) + "/urdf/" + urdf_name;
+
+  tesseract_common::TesseractSupportResourceLocator locator;
+  return tesseract_urdf::parseURDFFile(path, locator);
+}
+
+/** @brief Generate random joint values within the state solver limits so benchmarks do not always use the same state */
+std::vector<Eigen::VectorXd> getRandomJointValues(const StateSolver& solver, std::size_t count = 100)
+{
+  tesseract_common::KinematicLimits limits = solver.getLimits();
+  std::vector<Eigen::VectorXd> joint_values;
+  joint_values.reserve(count);
+  for (std::size_t i = 0; i < count; ++i)
+    joint_values.push_back(tesseract_common::generateRandomNumber(limits.joint_limits));
+
+  return joint_values;
+}
+
+/** @brief Benchmark that checks the setState method of the state solver */
+static void BM_SET_STATE(benchmark::State& state, const StateSolver::ConstPtr& solver)  // NOLINT
+{
+  StateSolver::UPtr clone = solver->clone();
+  std::vector<Eigen::VectorXd> joint_values = getRandomJointValues(*clone);
+
+  std::size_t i{ 0 };
+  for (auto _ : state)  // NOLINT
+  {
+    clone->setState(joint_values[i++ % joint_values.size()]);
+  }
+}
+
+/** @brief Benchmark that checks the setState method of the state solver using joint names */
+static void BM_SET_STATE_NAMES(benchmark::State& state, const StateSolver::ConstPtr& solver)  // NOLINT
+{
+  StateSolver::UPtr clone = solver->clone();
+  std::vector<std::string> joint_names = clone->getActiveJointNames();
+  std::vector<Eigen::VectorXd> joint_values = getRandomJointValues(*clone);
+
+  std::size_t i{ 0 };
+  for (auto _ : state)  // NOLINT
+  {
+    clone->setState(joint_names, joint_values[i++ % joint_values.size()]);
+  }
+}
+
+/**
+ * @brief Benchmark that checks the const getState method of the state solver
+ * @details This may be run with multiple threads since all threads share the same state solver
+ */
+static void BM_GET_STATE(benchmark::State& state, const StateSolver::ConstPtr& solver)  // NOLINT
+{
+  std::vector<Eigen::VectorXd> joint_values = getRandomJointValues(*solver);
+
+  std::size_t i{ 0 };
+  SceneState scene_state;
+  for (auto _ : state)  // NOLINT
+  {
+    benchmark::DoNotOptimize(scene_state = solver->getState(joint_values[i++ % joint_values.size()]));
+  }
+}
+
+/**
+ * @brief Benchmark that checks the const getJacobian method of the state solver
+ * @details This may be run with multiple threads since all threads share the same state solver
+ */
+static void BM_GET_JACOBIAN(benchmark::State& state,
+                            const StateSolver::ConstPtr& solver,  // NOLINT
+                            const std::string& link_name)
+{
+  std::vector<Eigen::VectorXd> joint_values = getRandomJointValues(*solver);
+
+  std::size_t i{ 0 };
+  Eigen::MatrixXd jacobian;
+  for (auto _ : state)  // NOLINT
+  {
+    benchmark::DoNotOptimize(jacobian = solver->getJacobian(joint_values[i++ % joint_values.size()], link_name));
+  }
+}
+
+int main(int argc, char** argv)
+{
+  // The urdf and the link used for the jacobian
+  std::vector<std::pair<std::string, std::string>> robots = { { "lbr_iiwa_14_r820.urdf", "tool0" },
+                                                              { "abb_irb2400_external_positioner.urdf", "tool0" } };
+
+  for (const auto& robot : robots)
+  {
+    SceneGraph::UPtr scene_graph = getSceneGraph(robot.first);
+    std::string robot_name = robot.first.substr(0, robot.first.find('.'));
+
+    std::vector<StateSolver::ConstPtr> solvers = { std::make_shared<OFKTStateSolver>(*scene_graph),
+                                                   std::make_shared<KDLStateSolver>(*scene_graph) };
+    std::vector<std::string> solver_names = { "OFKT", "KDL" };
+
+    for (std::size_t s = 0; s < solvers.size(); ++s)
+    {
+      const StateSolver::ConstPtr& solver = solvers[s];
+      std::string suffix = "_" + solver_names[s] + "_" + robot_name;
+
+      {
+        std::function<void(benchmark::State&, StateSolver::ConstPtr)> BM_SET_STATE_FUNC = BM_SET_STATE;
+        std::string name = "BM_SET_STATE" + suffix;
+        benchmark::RegisterBenchmark(name.c_str(), BM_SET_STATE_FUNC, solver)
+            ->UseRealTime()
+            ->Unit(benchmark::TimeUnit::kNanosecond);
+      }
+
+      {
+        std::function<void(benchmark::State&, StateSolver::ConstPtr)> BM_SET_STATE_NAMES_FUNC = BM_SET_STATE_NAMES;
+        std::string name = "BM_SET_STATE_NAMES" + suffix;
+        benchmark::RegisterBenchmark(name.c_str(), BM_SET_STATE_NAMES_FUNC, solver)
+            ->UseRealTime()
+            ->Unit(benchmark::TimeUnit::kNanosecond);
+      }
+
+      {
+        std::function<void(benchmark::State&, StateSolver::ConstPtr)> BM_GET_STATE_FUNC = BM_GET_STATE;
+        std::string name = "BM_GET_STATE" + suffix;
+        benchmark::RegisterBenchmark(name.c_str(), BM_GET_STATE_FUNC, solver)
+            ->ThreadRange(1, 8)
+            ->UseRealTime()
+            ->Unit(benchmark::TimeUnit::kNanosecond);
+      }
+
+      {
+        std::function<void(benchmark::State&, StateSolver::ConstPtr, std::string)> BM_GET_JACOBIAN_FUNC =
+            BM_GET_JACOBIAN;
+        std::string name = "BM_GET_JACOBIAN" + suffix;
+        benchmark::RegisterBenchmark(name.c_str(), BM_GET_JACOBIAN_FUNC, solver, robot.second)
+            ->ThreadRange(1, 8)
+            ->UseRealTime()
+            ->Unit(benchmark::TimeUnit::kNanosecond);
+      }
+    }
+  }
+
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+}
@@ -48,10 +48,32 @@ namespace tesseract_geometry
 class ConvexMesh;
 }
 
+namespace tesseract_collision
+{
+class ConvexMeshCache;
+}
+
 namespace tesseract_urdf
 {
+/**
+ * @brief Set the cache used to only compute the convex hulls of a mesh parsed with convert="true" once
+ * @details Until this is called the cache is created on first use in the directory of the
+ * TESSERACT_CONVEX_MESH_CACHE_PATH environment variable, or no cache is used if it is not set.
+ * This is thread safe.
+ * @param cache The cache, nullptr to always compute the convex hulls
+ */
+void setConvexMeshCache(std::shared_ptr<const tesseract_collision::ConvexMeshCache> cache);
+
+/**
+ * @brief Get the cache used to only compute the convex hulls of a mesh parsed with convert="true" once
+ * @details This is thread safe
+ * @return The cache, nullptr if the convex hulls are always computed
+ */
+std::shared_ptr<const tesseract_collision::ConvexMeshCache> getConvexMeshCache();
+
 /**
  * @brief Parse xml element convex_mesh
+ * @details If convert is true the convex hulls are stored in the cache returned by getConvexMeshCache
  * @param xml_element The xml element
  * @param locator The Tesseract resource
  * @param visual Indicate if it visual
@@ -27,6 +27,8 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <boost/algorithm/string.hpp>
+#include <cstdlib>
+#include <mutex>
 #include <stdexcept>
 
 #include <tesseract_common/utils.h>
@@ -40,6 +42,42 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract_urdf/convex_mesh.h>
 #include <tesseract_urdf/utils.h>
 
+namespace
+{
+/** @brief The convex mesh cache setting, the environment variable is only read once */
+struct ConvexMeshCacheSetting
+{
+  ConvexMeshCacheSetting()
+  {
+    if (const char* cache_path = std::getenv("TESSERACT_CONVEX_MESH_CACHE_PATH"))
+      cache = std::make_shared<tesseract_collision::ConvexMeshCache>(cache_path);
+  }
+
+  std::mutex mutex;
+  tesseract_collision::ConvexMeshCache::ConstPtr cache;
+};
+
+ConvexMeshCacheSetting& getConvexMeshCacheSetting()
+{
+  static ConvexMeshCacheSetting setting;
+  return setting;
+}
+}  // namespace
+
+void tesseract_urdf::setConvexMeshCache(std::shared_ptr<const tesseract_collision::ConvexMeshCache> cache)
+{
+  ConvexMeshCacheSetting& setting = getConvexMeshCacheSetting();
+  std::scoped_lock lock(setting.mutex);
+  setting.cache = std::move(cache);
+}
+
+std::shared_ptr<const tesseract_collision::ConvexMeshCache> tesseract_urdf::getConvexMeshCache()
+{
+  ConvexMeshCacheSetting& setting = getConvexMeshCacheSetting();
+  std::scoped_lock lock(setting.mutex);
+  return setting.cache;
+}
+
 std::vector<tesseract_geometry::ConvexMesh::Ptr>
 tesseract_urdf::parseConvexMesh(const tinyxml2::XMLElement* xml_element,
                                 const tesseract_common::ResourceLocator& locator,
@@ -97,12 +135,12 @@ tesseract_urdf::parseConvexMesh(const tinyxml2::XMLElement* xml_element,
       std::vector<tesseract_geometry::Mesh::Ptr> temp_meshes =
           tesseract_geometry::createMeshFromResource<tesseract_geometry::Mesh>(
               locator.locateResource(filename), scale, true, false);
-      for (auto& mesh : temp_meshes)
-      {
-        auto convex_mesh = tesseract_collision::makeConvexMesh(*mesh);
-        convex_mesh->setCreationMethod(tesseract_geometry::ConvexMesh::CONVERTED);
-        meshes.push_back(convex_mesh);
-      }
+
+      // If a cache is set the convex hulls are only computed once for each mesh
+      meshes = tesseract_collision::makeConvexMeshes(
+          std::vector<tesseract_geometry::Mesh::ConstPtr>(temp_meshes.begin(), temp_meshes.end()),
+          0,
+          getConvexMeshCache());
     }
   }
 
@@ -327,6 +327,23 @@ tinyxml2::XMLElement* tesseract_urdf::writeGeometry(const std::shared_ptr<const
       std::throw_with_nested(std::runtime_error("Could not write geometry marked as SDF mesh!"));
     }
   }
+  else if (type == tesseract_geometry::GeometryType::COMPACT_MESH)
+  {
+    try
+    {
+      // Compact meshes are written as regular meshes
+      tinyxml2::XMLElement* xml_mesh =
+          writeMesh(std::static_pointer_cast<const tesseract_geometry::CompactMesh>(geometry)->toMesh(),
+                    doc,
+                    package_path,
+                    filename + ".ply");
+      xml_element->InsertEndChild(xml_mesh);
+    }
+    catch (...)
+    {
+      std::throw_with_nested(std::runtime_error("Could not write geometry marked as compact mesh!"));
+    }
+  }
   else if (type == tesseract_geometry::GeometryType::OCTREE)
   {
     try
@@ -49,10 +49,23 @@ tesseract_geometry::Octree::Ptr tesseract_urdf::parseOctree(const tinyxml2::XMLE
     std::throw_with_nested(std::runtime_error("Octree: Missing or failed parsing attribute 'filename'!"));
 
   tesseract_common::Resource::Ptr resource = locator.locateResource(filename);
-  if (!resource || !resource->isFile())
+  if (!resource)
     std::throw_with_nested(std::runtime_error("Octree: Missing resource '" + filename + "'!"));
 
-  auto ot = std::make_shared<octomap::OcTree>(resource->getFilePath());
+  std::shared_ptr<octomap::OcTree> ot;
+  if (resource->isFile())
+  {
+    ot = std::make_shared<octomap::OcTree>(resource->getFilePath());
+  }
+  else
+  {
+    // Resources which are not files, for example resources in a resource bundle, are read from the content stream.
+    // The resolution is replaced by the resolution stored in the file.
+    ot = std::make_shared<octomap::OcTree>(0.1);
+    std::shared_ptr<std::istream> stream = resource->getResourceContentStream();
+    if (stream == nullptr || !ot->readBinary(*stream))
+      std::throw_with_nested(std::runtime_error("Octree: Error importing from '" + filename + "'!"));
+  }
 
   if (ot == nullptr || ot->size() == 0)
     std::throw_with_nested(std::runtime_error("Octree: Error importing from '" + filename + "'!"));
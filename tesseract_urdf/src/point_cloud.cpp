@@ -28,7 +28,6 @@
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <stdexcept>
 
-#include <console_bridge/console.h>
 #include <pcl/io/pcd_io.h>
 #include <tesseract_common/utils.h>
 #include <tinyxml2.h>
@@ -55,14 +54,15 @@ tesseract_geometry::Octree::Ptr tesseract_urdf::parsePointCloud(const tinyxml2::
   auto cloud = std::make_shared<pcl::PointCloud<pcl::PointXYZ>>();
 
   tesseract_common::Resource::Ptr located_resource = locator.locateResource(filename);
-  if (!located_resource || !located_resource->isFile())
-  {
-    // TODO: Handle point clouds that are not files
-    CONSOLE_BRIDGE_logError("Point clouds can only be loaded from file");
+  if (!located_resource)
     std::throw_with_nested(std::runtime_error("PointCloud: Unable to locate resource '" + filename + "'!"));
-  }
 
-  if (pcl::io::loadPCDFile<pcl::PointXYZ>(located_resource->getFilePath(), *cloud) == -1)
+  // Point clouds can only be loaded from file, resources which are not files are written to a temporary file
+  const std::string file_path = tesseract_common::getResourceLocalFilePath(*located_resource);
+  if (file_path.empty())
+    std::throw_with_nested(std::runtime_error("PointCloud: Unable to load resource '" + filename + "' from file!"));
+
+  if (pcl::io::loadPCDFile<pcl::PointXYZ>(file_path, *cloud) == -1)
     std::throw_with_nested(std::runtime_error("PointCloud: Failed to import point cloud from '" + filename + "'!"));
 
   if (cloud->points.empty())
@@ -6,6 +6,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_urdf/convex_mesh.h>
 #include <tesseract_geometry/impl/convex_mesh.h>
+#include <tesseract_collision/core/convex_decomposition_cache.h>
 #include <tesseract_support/tesseract_support_resource_locator.h>
 #include "tesseract_urdf_common_unit.h"
 
@@ -174,6 +175,44 @@ TEST(TesseractURDFUnit, parse_convex_mesh)  // NOLINT
   }
 }
 
+TEST(TesseractURDFUnit, parse_convex_mesh_cache)  // NOLINT
+{
+  tesseract_common::TesseractSupportResourceLocator resource_locator;
+  const tesseract_collision::ConvexMeshCache::ConstPtr default_cache = tesseract_urdf::getConvexMeshCache();
+
+  const tesseract_common::fs::path cache_path =
+      tesseract_common::fs::temp_directory_path() / tesseract_common::fs::unique_path("urdf_convex_cache_%%%%-%%%%");
+  auto cache = std::make_shared<tesseract_collision::ConvexMeshCache>(cache_path.string());
+  tesseract_urdf::setConvexMeshCache(cache);
+  EXPECT_TRUE(tesseract_urdf::getConvexMeshCache() == cache);
+
+  // Converted meshes are stored in the cache and loaded from it when parsed again
+  std::string str =
+      R"(<convex_mesh filename="package://tesseract_support/meshes/box_2m.ply" scale="1 2 1" convert="true"/>)";
+  std::vector<tesseract_geometry::ConvexMesh::Ptr> geom;
+  EXPECT_TRUE(runTest<std::vector<tesseract_geometry::ConvexMesh::Ptr>>(
+      geom, &tesseract_urdf::parseConvexMesh, str, "convex_mesh", resource_locator, 2, false));
+  ASSERT_EQ(geom.size(), 1);
+  EXPECT_FALSE(tesseract_common::fs::is_empty(cache_path));
+
+  std::vector<tesseract_geometry::ConvexMesh::Ptr> cached_geom;
+  EXPECT_TRUE(runTest<std::vector<tesseract_geometry::ConvexMesh::Ptr>>(
+      cached_geom, &tesseract_urdf::parseConvexMesh, str, "convex_mesh", resource_locator, 2, false));
+  ASSERT_EQ(cached_geom.size(), 1);
+  EXPECT_EQ(cached_geom[0]->getVertexCount(), geom[0]->getVertexCount());
+  EXPECT_EQ(cached_geom[0]->getFaceCount(), geom[0]->getFaceCount());
+
+  // Clearing the cache computes the convex hulls without storing them
+  tesseract_urdf::setConvexMeshCache(nullptr);
+  EXPECT_TRUE(tesseract_urdf::getConvexMeshCache() == nullptr);
+  tesseract_common::fs::remove_all(cache_path);
+  EXPECT_TRUE(runTest<std::vector<tesseract_geometry::ConvexMesh::Ptr>>(
+      geom, &tesseract_urdf::parseConvexMesh, str, "convex_mesh", resource_locator, 2, false));
+  EXPECT_FALSE(tesseract_common::fs::exists(cache_path));
+
+  tesseract_urdf::setConvexMeshCache(default_cache);
+}
+
 TEST(TesseractURDFUnit, write_convex_mesh)  // NOLINT
 {
   {
@@ -10,6 +10,23 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract_support/tesseract_support_resource_locator.h>
 #include "tesseract_urdf_common_unit.h"
 
+/** @brief Locates resources which are not files, like the resources of a resource bundle */
+class BytesResourceLocator : public tesseract_common::ResourceLocator
+{
+public:
+  tesseract_common::Resource::Ptr locateResource(const std::string& url) const override
+  {
+    tesseract_common::Resource::Ptr resource = locator_.locateResource(url);
+    if (resource == nullptr)
+      return nullptr;
+
+    return std::make_shared<tesseract_common::BytesResource>(url, resource->getResourceContents());
+  }
+
+private:
+  tesseract_common::TesseractSupportResourceLocator locator_;
+};
+
 TEST(TesseractURDFUnit, parse_octree)  // NOLINT
 {
   tesseract_common::TesseractSupportResourceLocator resource_locator;
@@ -167,6 +184,56 @@ TEST(TesseractURDFUnit, parse_octree)  // NOLINT
   }
 }
 
+TEST(TesseractURDFUnit, parse_octree_from_memory)  // NOLINT
+{
+  BytesResourceLocator resource_locator;
+  {
+    std::string str = R"(<octomap shape_type="box" prune="true">
+                           <octree filename="package://tesseract_support/meshes/box_2m.bt"/>
+                         </octomap>)";
+    tesseract_geometry::Octree::Ptr geom;
+    EXPECT_TRUE(runTest<tesseract_geometry::Octree::Ptr>(
+        geom, &tesseract_urdf::parseOctomap, str, "octomap", resource_locator, 2, true));
+    EXPECT_TRUE(geom->getSubType() == geom->BOX);
+    EXPECT_TRUE(geom->getOctree() != nullptr);
+    EXPECT_EQ(geom->calcNumSubShapes(), 8);
+  }
+
+#ifdef TESSERACT_PARSE_POINT_CLOUDS
+  {
+    std::string str = R"(<octomap shape_type="box" prune="true">
+                           <point_cloud filename="package://tesseract_support/meshes/box_pcd.pcd" resolution="0.1"/>
+                         </octomap>)";
+    tesseract_geometry::Octree::Ptr geom;
+    EXPECT_TRUE(runTest<tesseract_geometry::Octree::Ptr>(
+        geom, &tesseract_urdf::parseOctomap, str, "octomap", resource_locator, 2, true));
+    EXPECT_TRUE(geom->getSubType() == geom->BOX);
+    EXPECT_TRUE(geom->getOctree() != nullptr);
+    EXPECT_EQ(geom->calcNumSubShapes(), 496);
+    EXPECT_NEAR(geom->getOctree()->getResolution(), 0.1, 1e-5);
+  }
+#endif
+
+  {
+    std::string str = R"(<octomap shape_type="box" prune="true">
+                           <octree filename="package://tesseract_support/meshes/does_not_exist.bt"/>
+                         </octomap>)";
+    tesseract_geometry::Octree::Ptr geom;
+    EXPECT_FALSE(runTest<tesseract_geometry::Octree::Ptr>(
+        geom, &tesseract_urdf::parseOctomap, str, "octomap", resource_locator, 2, true));
+  }
+
+  {
+    // The contents of a mesh are not a valid octree
+    std::string str = R"(<octomap shape_type="box" prune="true">
+                           <octree filename="package://tesseract_support/meshes/box_2m.ply"/>
+                         </octomap>)";
+    tesseract_geometry::Octree::Ptr geom;
+    EXPECT_FALSE(runTest<tesseract_geometry::Octree::Ptr>(
+        geom, &tesseract_urdf::parseOctomap, str, "octomap", resource_locator, 2, true));
+  }
+}
+
 TEST(TesseractURDFUnit, write_octree)  // NOLINT
 {
   {
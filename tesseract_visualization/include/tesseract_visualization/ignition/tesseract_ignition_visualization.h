@@ -28,17 +28,46 @@
 
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
 #include <gz/msgs/scene.pb.h>
 #include <gz/msgs/boolean.pb.h>
 #include <gz/transport/Node.hh>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_visualization/visualization.h>
+#include <tesseract_visualization/scene_state_delta.h>
 #include <tesseract_visualization/ignition/entity_manager.h>
 #include <tesseract_environment/environment.h>
 
 namespace tesseract_visualization
 {
+/** @brief The settings used when publishing environment states */
+struct TesseractIgnitionVisualizationConfig
+{
+  /** @brief A link pose is only published if its translation changed more than this since last published */
+  double translation_threshold{ 1e-5 };
+
+  /** @brief A link pose is only published if its rotation changed more than this (radians) since last published */
+  double rotation_threshold{ 1e-4 };
+
+  /**
+   * @brief Every Nth published state contains every link pose so late subscribers receive the complete state
+   * @details If zero only the first state after plotEnvironment contains every link pose
+   */
+  std::size_t full_state_interval{ 100 };
+
+  /**
+   * @brief The maximum rate (Hz) at which plotEnvironmentState publishes
+   * @details If greater than zero the states are published by a background thread and states received faster than
+   * this rate are coalesced, only publishing the latest pose of each link. If zero every state is published
+   * immediately.
+   */
+  double max_publish_rate{ 0 };
+};
+
 /** @brief The Tesseract Ignition Vizualization class */
 class TesseractIgnitionVisualization : public tesseract_visualization::Visualization
 {
@@ -46,7 +75,16 @@ public:
   using Ptr = std::shared_ptr<TesseractIgnitionVisualization>;
   using ConstPtr = std::shared_ptr<const TesseractIgnitionVisualization>;
 
-  TesseractIgnitionVisualization();
+  explicit TesseractIgnitionVisualization(
+      TesseractIgnitionVisualizationConfig config = TesseractIgnitionVisualizationConfig());
+  ~TesseractIgnitionVisualization() override;
+  TesseractIgnitionVisualization(const TesseractIgnitionVisualization&) = delete;
+  TesseractIgnitionVisualization& operator=(const TesseractIgnitionVisualization&) = delete;
+  TesseractIgnitionVisualization(TesseractIgnitionVisualization&&) = delete;
+  TesseractIgnitionVisualization& operator=(TesseractIgnitionVisualization&&) = delete;
+
+  /** @brief Get the settings used when publishing environment states */
+  const TesseractIgnitionVisualizationConfig& getConfig() const;
 
   bool isConnected() const override;
 
@@ -69,17 +107,61 @@ public:
   void waitForInput(std::string message = "Hit enter key to continue!") override;
 
 private:
+  TesseractIgnitionVisualizationConfig config_;
   gz::transport::Node node_;                    /**< Ignition communication node. */
   gz::transport::Node::Publisher scene_pub_;    /**< Scene publisher */
   gz::transport::Node::Publisher pose_pub_;     /**< Pose publisher */
   gz::transport::Node::Publisher deletion_pub_; /**< Deletion publisher */
   EntityManager entity_manager_;
 
+  /** @brief The link poses last published, used to only publish the links which moved */
+  SceneStateDeltaEncoder delta_encoder_;
+
+  /**
+   * @brief Guards the entity manager, the delta encoder and the publishers
+   * @details If both are locked this is locked before the pending mutex
+   */
+  std::mutex publish_mutex_;
+
+  /** @brief The latest pose of each link received since the background thread last published */
+  SceneStateCoalescer pending_states_;
+
+  /** @brief Set when the background thread should publish the pending transforms and exit */
+  bool shutdown_{ false };
+
+  /** @brief Guards the pending transforms and shutdown flag */
+  std::mutex pending_mutex_;
+  std::condition_variable pending_cv_;
+  std::thread publish_thread_;
+
   /**
    * @brief Helper function for sending state to visualization tool
-   * @param scene_state Environment state
+   * @details Only the link poses which changed more than the thresholds since they were last published are sent. The
+   * publish mutex must be locked by the caller.
+   * @param link_transforms The link transforms of the environment state
+   */
+  void sendSceneState(const tesseract_common::TransformMap& link_transforms);
+
+  /**
+   * @brief Discard the states waiting to be published by the background thread
+   * @details This is called before publishing directly so an older pending state is not published afterwards. The
+   * publish mutex must be locked by the caller.
+   */
+  void discardPendingStates();
+
+  /** @brief The background thread publishing the pending transforms at the maximum publish rate */
+  void publishThread();
+
+  /**
+   * @brief Add a marker to a scene message, markers of the same type share a model
+   * @param scene_msg The scene message
+   * @param link_counts The number of links added to each model, used to create unique link names
+   * @param marker The marker
+   * @return True if the marker type is supported, otherwise false
    */
-  void sendSceneState(const tesseract_scene_graph::SceneState& scene_state);
+  bool addMarker(gz::msgs::Scene& scene_msg,
+                 std::unordered_map<std::string, long>& link_counts,
+                 const Marker& marker);
 };
 
 TESSERACT_PLUGIN_ANCHOR_DECL(IgnitionVisualizationAnchor)
@@ -0,0 +1,133 @@
+/**
+ * @file scene_state_delta.h
+ * @brief Bookkeeping used to only publish the link poses of a scene state which changed
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_VISUALIZATION_SCENE_STATE_DELTA_H
+#define TESSERACT_VISUALIZATION_SCENE_STATE_DELTA_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <cstddef>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/types.h>
+
+namespace tesseract_visualization
+{
+/**
+ * @brief Tracks the link poses last published so only the links which moved need to be published
+ * @details This class is not thread safe, the caller is responsible for synchronizing access.
+ */
+class SceneStateDeltaEncoder
+{
+public:
+  /**
+   * @brief Constructor
+   * @param translation_threshold A link pose is only published if its translation changed more than this
+   * @param rotation_threshold A link pose is only published if its rotation changed more than this (radians)
+   * @param full_state_interval Every Nth published state contains every link pose, if zero only the first state
+   */
+  SceneStateDeltaEncoder(double translation_threshold = 1e-5,
+                         double rotation_threshold = 1e-4,
+                         std::size_t full_state_interval = 100);
+
+  /**
+   * @brief Check if the next published state must contain every link pose
+   * @return True if nothing was published yet or the full state interval elapsed
+   */
+  bool isFullStateRequired() const;
+
+  /**
+   * @brief Get the link poses which need to be published
+   * @details The poses are compared against the last published poses so slow motion accumulates until it exceeds the
+   * thresholds. If a full state is required every link pose is returned.
+   * @param link_transforms The link poses of the scene state
+   * @return The link poses to publish, empty if nothing changed
+   */
+  tesseract_common::TransformMap getChangedTransforms(const tesseract_common::TransformMap& link_transforms) const;
+
+  /**
+   * @brief Record the link poses which were published
+   * @details This should be called with the link poses returned by getChangedTransforms once they were published
+   * @param link_transforms The published link poses
+   */
+  void setPublished(const tesseract_common::TransformMap& link_transforms);
+
+  /**
+   * @brief Reset after a scene containing every link pose was published by other means
+   * @param link_transforms The link poses of the published scene
+   */
+  void reset(tesseract_common::TransformMap link_transforms);
+
+  /** @brief Forget the published link poses so the next state contains every link pose */
+  void clear();
+
+  /** @brief Get the link poses last published */
+  const tesseract_common::TransformMap& getPublishedTransforms() const;
+
+private:
+  double translation_threshold_;
+  double rotation_threshold_;
+  std::size_t full_state_interval_;
+
+  /** @brief The link poses last published */
+  tesseract_common::TransformMap published_transforms_;
+
+  /** @brief The number of states published since the last state containing every link pose */
+  std::size_t states_since_full_state_{ 0 };
+};
+
+/**
+ * @brief Coalesces scene states received faster than they are published, keeping the latest pose of each link
+ * @details This class is not thread safe, the caller is responsible for synchronizing access.
+ */
+class SceneStateCoalescer
+{
+public:
+  /**
+   * @brief Add the link poses of a scene state, replacing the pending pose of the same links
+   * @param link_transforms The link poses
+   */
+  void add(const tesseract_common::TransformMap& link_transforms);
+
+  /**
+   * @brief Take the pending link poses, leaving none pending
+   * @return The pending link poses
+   */
+  tesseract_common::TransformMap take();
+
+  /** @brief Discard the pending link poses */
+  void clear();
+
+  /** @brief Check if there are no pending link poses */
+  bool empty() const;
+
+private:
+  /** @brief The latest pose of each link added since the pending link poses were last taken */
+  tesseract_common::TransformMap pending_transforms_;
+};
+
+}  // namespace tesseract_visualization
+
+#endif  // TESSERACT_VISUALIZATION_SCENE_STATE_DELTA_H
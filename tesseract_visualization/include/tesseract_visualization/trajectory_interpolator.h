@@ -36,6 +36,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_common/joint_state.h>
+#include <tesseract_common/types.h>
 
 namespace tesseract_visualization
 {
@@ -55,6 +56,15 @@ public:
 
   double getStateDuration(long index) const;
 
+  /**
+   * @brief Sample the trajectory at a fixed time step
+   * @details The samples are taken at 0, dt, 2 * dt, ... and the final state is always included as the last row. The
+   * columns are ordered by the joint names of the first state.
+   * @param dt The time step, must be greater than zero
+   * @return The sampled joint positions, a row per sample
+   */
+  tesseract_common::TrajArray resample(double dt) const;
+
   long getStateCount() const;
 
   bool empty() const;
@@ -62,6 +72,7 @@ public:
 private:
   tesseract_common::JointTrajectory trajectory_;
   std::vector<double> duration_from_previous_;
+  std::vector<double> duration_from_start_;
 
   void findStateIndices(const double& duration, long& before, long& after, double& blend) const;
 
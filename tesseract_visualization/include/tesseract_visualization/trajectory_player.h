@@ -80,6 +80,13 @@ public:
    */
   tesseract_common::JointState getByIndex(long index) const;
 
+  /**
+   * @brief Sample the trajectory at a fixed time step, ignoring the playback scale
+   * @param dt The time step, must be greater than zero
+   * @return The sampled joint positions, a row per sample with the final state as the last row
+   */
+  tesseract_common::TrajArray resample(double dt) const;
+
   /**
    * @brief Get the current duration populated by the last call to getNext()
    * @return The current duration
@@ -41,6 +41,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_visualization/ignition/conversions.h>
 #include <tesseract_geometry/geometries.h>
+#include <tesseract_common/resource_locator.h>
 
 namespace tesseract_visualization
 {
@@ -246,14 +247,16 @@ bool toMsg(gz::msgs::Scene& scene_msg,
           auto resource = shape->getResource();
           if (resource)
           {
+            // The mesh is loaded by file name, resources which are not files are written to a temporary file
+            const std::string file_path = tesseract_common::getResourceLocalFilePath(*resource);
             gz::msgs::MeshGeom shape_geometry_msg;
-            shape_geometry_msg.set_filename(resource->getFilePath());
+            shape_geometry_msg.set_filename(file_path);
             shape_geometry_msg.mutable_scale()->CopyFrom(
                 gz::msgs::Convert(gz::math::eigen3::convert(shape->getScale())));
             geometry_msg.mutable_mesh()->CopyFrom(shape_geometry_msg);
             gv_msg->mutable_geometry()->CopyFrom(geometry_msg);
 
-            if (!isMeshWithColor(resource->getFilePath()) && vs->material != nullptr &&
+            if (!isMeshWithColor(file_path) && vs->material != nullptr &&
                 vs->material->getName() != "default_tesseract_material" && vs->material->texture_filename.empty())
             {
               gv_msg->mutable_material()->CopyFrom(convert(vs->material->color));
@@ -282,14 +285,16 @@ bool toMsg(gz::msgs::Scene& scene_msg,
           auto resource = shape->getResource();
           if (resource)
           {
+            // The mesh is loaded by file name, resources which are not files are written to a temporary file
+            const std::string file_path = tesseract_common::getResourceLocalFilePath(*resource);
             gz::msgs::MeshGeom shape_geometry_msg;
-            shape_geometry_msg.set_filename(resource->getFilePath());
+            shape_geometry_msg.set_filename(file_path);
             shape_geometry_msg.mutable_scale()->CopyFrom(
                 gz::msgs::Convert(gz::math::eigen3::convert(shape->getScale())));
             geometry_msg.mutable_mesh()->CopyFrom(shape_geometry_msg);
             gv_msg->mutable_geometry()->CopyFrom(geometry_msg);
 
-            if (!isMeshWithColor(resource->getFilePath()) && vs->material != nullptr &&
+            if (!isMeshWithColor(file_path) && vs->material != nullptr &&
                 vs->material->getName() != "default_tesseract_material" && vs->material->texture_filename.empty())
             {
               gv_msg->mutable_material()->CopyFrom(convert(vs->material->color));
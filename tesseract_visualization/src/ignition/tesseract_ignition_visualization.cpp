@@ -31,6 +31,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <gz/math/eigen3/Conversions.hh>
 #include <chrono>
 #include <numeric>
+#include <unordered_map>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_visualization/ignition/tesseract_ignition_visualization.h>
@@ -58,13 +59,33 @@ static const std::string TOOL_PATH_MODEL_NAME = "tesseract_tool_path_model";
 
 namespace tesseract_visualization
 {
-TesseractIgnitionVisualization::TesseractIgnitionVisualization()
+TesseractIgnitionVisualization::TesseractIgnitionVisualization(TesseractIgnitionVisualizationConfig config)
+  : config_(config)
+  , delta_encoder_(config_.translation_threshold, config_.rotation_threshold, config_.full_state_interval)
 {
   scene_pub_ = node_.Advertise<gz::msgs::Scene>(DEFAULT_SCENE_TOPIC_NAME);
   pose_pub_ = node_.Advertise<gz::msgs::Pose_V>(DEFAULT_POSE_TOPIC_NAME);
   deletion_pub_ = node_.Advertise<gz::msgs::UInt32_V>(DEFAULT_DELETION_TOPIC_NAME);
+
+  if (config_.max_publish_rate > 0)
+    publish_thread_ = std::thread(&TesseractIgnitionVisualization::publishThread, this);
+}
+
+TesseractIgnitionVisualization::~TesseractIgnitionVisualization()
+{
+  if (publish_thread_.joinable())
+  {
+    {
+      std::scoped_lock lock(pending_mutex_);
+      shutdown_ = true;
+    }
+    pending_cv_.notify_one();
+    publish_thread_.join();
+  }
 }
 
+const TesseractIgnitionVisualizationConfig& TesseractIgnitionVisualization::getConfig() const { return config_; }
+
 bool TesseractIgnitionVisualization::isConnected() const
 {
   return scene_pub_.HasConnections() && pose_pub_.HasConnections() && deletion_pub_.HasConnections();
@@ -87,14 +108,32 @@ void TesseractIgnitionVisualization::waitForConnection(long seconds) const
 void TesseractIgnitionVisualization::plotEnvironment(const tesseract_environment::Environment& env, std::string /*ns*/)
 {
   gz::msgs::Scene msg;
-  toMsg(msg, entity_manager_, *(env.getSceneGraph()), env.getState().link_transforms);
+  tesseract_common::TransformMap link_transforms = env.getState().link_transforms;
+
+  std::scoped_lock lock(publish_mutex_);
+  discardPendingStates();
+  toMsg(msg, entity_manager_, *(env.getSceneGraph()), link_transforms);
   scene_pub_.Publish(msg);
+
+  // The scene contains every link pose so following states only need to contain the links which moved
+  delta_encoder_.reset(std::move(link_transforms));
 }
 
 void TesseractIgnitionVisualization::plotEnvironmentState(const tesseract_scene_graph::SceneState& state,
                                                           std::string /*ns*/)
 {
-  sendSceneState(state);
+  if (!publish_thread_.joinable())
+  {
+    std::scoped_lock lock(publish_mutex_);
+    sendSceneState(state.link_transforms);
+    return;
+  }
+
+  {
+    std::scoped_lock lock(pending_mutex_);
+    pending_states_.add(state.link_transforms);
+  }
+  pending_cv_.notify_one();
 }
 
 void TesseractIgnitionVisualization::plotTrajectory(const tesseract_common::JointTrajectory& traj,
@@ -105,7 +144,11 @@ void TesseractIgnitionVisualization::plotTrajectory(const tesseract_common::Join
   for (const auto& traj_state : traj)
   {
     tesseract_scene_graph::SceneState state = state_solver.getState(traj_state.joint_names, traj_state.position);
-    sendSceneState(state);
+    {
+      std::scoped_lock lock(publish_mutex_);
+      discardPendingStates();
+      sendSceneState(state.link_transforms);
+    }
     std::this_thread::sleep_for(fp_s);
   }
 }
@@ -200,61 +243,86 @@ void addAxis(EntityManager& entity_manager, gz::msgs::Link& link, long& sub_inde
   addCylinder(entity_manager, link, sub_index, position, position + (scale(2) * z_axis), axis_blue, scale * (1.0 / 20));
 }
 
+gz::msgs::Model* getOrAddModel(EntityManager& entity_manager, gz::msgs::Scene& scene_msg, const std::string& model_name)
+{
+  for (int i = 0; i < scene_msg.model_size(); ++i)
+  {
+    if (scene_msg.model(i).name() == model_name)
+      return scene_msg.mutable_model(i);
+  }
+
+  gz::msgs::Model* model = scene_msg.add_model();
+  model->set_name(model_name);
+  model->set_id(static_cast<unsigned>(entity_manager.addModel(model_name)));
+  return model;
+}
+
 void TesseractIgnitionVisualization::plotMarker(const Marker& marker, std::string /*ns*/)
+{
+  gz::msgs::Scene scene_msg;
+  scene_msg.set_name("scene");
+  std::unordered_map<std::string, long> link_counts;
+
+  std::scoped_lock lock(publish_mutex_);
+  if (addMarker(scene_msg, link_counts, marker))
+    scene_pub_.Publish(scene_msg);
+}
+
+void TesseractIgnitionVisualization::plotMarkers(const std::vector<Marker::Ptr>& markers, std::string /*ns*/)
+{
+  gz::msgs::Scene scene_msg;
+  scene_msg.set_name("scene");
+  std::unordered_map<std::string, long> link_counts;
+
+  std::scoped_lock lock(publish_mutex_);
+  for (const auto& marker : markers)
+    addMarker(scene_msg, link_counts, *marker);
+
+  if (scene_msg.model_size() > 0)
+    scene_pub_.Publish(scene_msg);
+}
+
+bool TesseractIgnitionVisualization::addMarker(gz::msgs::Scene& scene_msg,
+                                               std::unordered_map<std::string, long>& link_counts,
+                                               const Marker& marker)
 {
   switch (marker.getType())
   {
     case static_cast<int>(MarkerType::ARROW):
     {
       const auto& m = dynamic_cast<const ArrowMarker&>(marker);
-      gz::msgs::Scene scene_msg;
-      scene_msg.set_name("scene");
-      gz::msgs::Model* model = scene_msg.add_model();
-      std::string model_name = ARROW_MODEL_NAME;
-      model->set_name(model_name);
-      model->set_id(static_cast<unsigned>(entity_manager_.addModel(model_name)));
-
-      long cnt = 0;
+      const std::string& model_name = ARROW_MODEL_NAME;
+      gz::msgs::Model* model = getOrAddModel(entity_manager_, scene_msg, model_name);
+
+      long& cnt = link_counts[model_name];
       std::string link_name = model_name + std::to_string(++cnt);
       gz::msgs::Link* link_msg = model->add_link();
       link_msg->set_id(static_cast<unsigned>(entity_manager_.addVisual(link_name)));
       link_msg->set_name(link_name);
       addArrow(entity_manager_, *link_msg, cnt, m);
-      scene_pub_.Publish(scene_msg);
-      break;
+      return true;
     }
     case static_cast<int>(MarkerType::AXIS):
     {
       const auto& m = dynamic_cast<const AxisMarker&>(marker);
+      const std::string& model_name = AXES_MODEL_NAME;
+      gz::msgs::Model* model = getOrAddModel(entity_manager_, scene_msg, model_name);
 
-      gz::msgs::Scene scene_msg;
-      scene_msg.set_name("scene");
-      gz::msgs::Model* model = scene_msg.add_model();
-      std::string model_name = AXES_MODEL_NAME;
-      model->set_name(model_name);
-      model->set_id(static_cast<unsigned>(entity_manager_.addModel(model_name)));
-
-      long cnt = 0;
+      long& cnt = link_counts[model_name];
       std::string link_name = model_name + std::to_string(++cnt);
       gz::msgs::Link* link_msg = model->add_link();
       link_msg->set_id(static_cast<unsigned>(entity_manager_.addVisual(link_name)));
       link_msg->set_name(link_name);
       addAxis(entity_manager_, *link_msg, cnt, m.axis);
-      scene_pub_.Publish(scene_msg);
-      break;
+      return true;
     }
     case static_cast<int>(MarkerType::CONTACT_RESULTS):
     {
       const auto& m = dynamic_cast<const ContactResultsMarker&>(marker);
+      const std::string& model_name = COLLISION_RESULTS_MODEL_NAME;
+      gz::msgs::Model* model = getOrAddModel(entity_manager_, scene_msg, model_name);
 
-      gz::msgs::Scene scene_msg;
-      scene_msg.set_name("scene");
-      gz::msgs::Model* model = scene_msg.add_model();
-      std::string model_name = COLLISION_RESULTS_MODEL_NAME;
-      model->set_name(model_name);
-      model->set_id(static_cast<unsigned>(entity_manager_.addModel(model_name)));
-
-      long cnt = 0;
+      long& cnt = link_counts[model_name];
       for (size_t i = 0; i < m.dist_results.size(); ++i)
       {
         const tesseract_collision::ContactResult& dist = m.dist_results[i];
@@ -323,23 +391,19 @@ void TesseractIgnitionVisualization::plotMarker(const Marker& marker, std::strin
           addArrow(entity_manager_, *link_msg, cnt, am);
         }
       }
-      scene_pub_.Publish(scene_msg);
-      break;
+      return true;
     }
     default:
     {
       ignwarn << "plotMarkers: Unsupported marker type: " << std::to_string(marker.getType()) << std::endl;
+      return false;
     }
   }
 }
 
-void TesseractIgnitionVisualization::plotMarkers(const std::vector<Marker::Ptr>& /*markers*/, std::string /*ns*/)
-{
-  ignerr << "plotMarkers is currently not implemented!" << std::endl;
-}
-
 void TesseractIgnitionVisualization::clear(std::string /*ns*/)
 {
+  std::scoped_lock lock(publish_mutex_);
   gz::msgs::UInt32_V deletion_msg;
   long id = entity_manager_.getModel(COLLISION_RESULTS_MODEL_NAME);
   if (id >= 1000)
@@ -362,10 +426,15 @@ void TesseractIgnitionVisualization::waitForInput(std::string message)
   std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
 }
 
-void TesseractIgnitionVisualization::sendSceneState(const tesseract_scene_graph::SceneState& scene_state)
+void TesseractIgnitionVisualization::sendSceneState(const tesseract_common::TransformMap& link_transforms)
 {
+  // Periodically every link pose is returned so late subscribers receive the complete state
+  const tesseract_common::TransformMap changed = delta_encoder_.getChangedTransforms(link_transforms);
+  if (changed.empty())
+    return;
+
   gz::msgs::Pose_V pose_v;
-  for (const auto& pair : scene_state.link_transforms)
+  for (const auto& pair : changed)
   {
     gz::msgs::Pose* pose = pose_v.add_pose();
     pose->CopyFrom(gz::msgs::Convert(gz::math::eigen3::convert(pair.second)));
@@ -376,6 +445,51 @@ void TesseractIgnitionVisualization::sendSceneState(const tesseract_scene_graph:
   if (!pose_pub_.Publish(pose_v))
   {
     ignerr << "Failed to publish pose vector!" << std::endl;
+    return;
+  }
+
+  delta_encoder_.setPublished(changed);
+}
+
+void TesseractIgnitionVisualization::discardPendingStates()
+{
+  std::scoped_lock lock(pending_mutex_);
+  pending_states_.clear();
+}
+
+void TesseractIgnitionVisualization::publishThread()
+{
+  const auto period = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+      std::chrono::duration<double>(1.0 / config_.max_publish_rate));
+
+  std::unique_lock<std::mutex> lock(pending_mutex_);
+  while (true)
+  {
+    pending_cv_.wait(lock, [this]() { return shutdown_ || !pending_states_.empty(); });
+
+    // The pending transforms are published before exiting so the last state is not lost
+    if (pending_states_.empty())
+      return;
+
+    const auto next_publish = std::chrono::steady_clock::now() + period;
+    lock.unlock();
+    {
+      // The pending states are taken while holding the publish mutex so a state published directly, which discards
+      // the pending states first, is never followed by an older pending state
+      std::scoped_lock publish_lock(publish_mutex_);
+      tesseract_common::TransformMap link_transforms;
+      {
+        std::scoped_lock pending_lock(pending_mutex_);
+        link_transforms = pending_states_.take();
+      }
+
+      if (!link_transforms.empty())
+        sendSceneState(link_transforms);
+    }
+    lock.lock();
+
+    // States received while waiting are coalesced into the pending transforms
+    pending_cv_.wait_until(lock, next_publish, [this]() { return shutdown_; });
   }
 }
 
@@ -0,0 +1,115 @@
+/**
+ * @file scene_state_delta.cpp
+ * @brief Bookkeeping used to only publish the link poses of a scene state which changed
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_visualization/scene_state_delta.h>
+
+namespace tesseract_visualization
+{
+SceneStateDeltaEncoder::SceneStateDeltaEncoder(double translation_threshold,
+                                               double rotation_threshold,
+                                               std::size_t full_state_interval)
+  : translation_threshold_(translation_threshold)
+  , rotation_threshold_(rotation_threshold)
+  , full_state_interval_(full_state_interval)
+{
+}
+
+bool SceneStateDeltaEncoder::isFullStateRequired() const
+{
+  return published_transforms_.empty() ||
+         (full_state_interval_ > 0 && states_since_full_state_ >= full_state_interval_);
+}
+
+tesseract_common::TransformMap
+SceneStateDeltaEncoder::getChangedTransforms(const tesseract_common::TransformMap& link_transforms) const
+{
+  if (isFullStateRequired())
+    return link_transforms;
+
+  tesseract_common::TransformMap changed;
+  for (const auto& pair : link_transforms)
+  {
+    auto it = published_transforms_.find(pair.first);
+    if (it != published_transforms_.end())
+    {
+      const double translation = (pair.second.translation() - it->second.translation()).norm();
+      const double rotation =
+          Eigen::Quaterniond(pair.second.linear()).angularDistance(Eigen::Quaterniond(it->second.linear()));
+      if (translation <= translation_threshold_ && rotation <= rotation_threshold_)
+        continue;
+    }
+
+    changed[pair.first] = pair.second;
+  }
+
+  return changed;
+}
+
+void SceneStateDeltaEncoder::setPublished(const tesseract_common::TransformMap& link_transforms)
+{
+  if (link_transforms.empty())
+    return;
+
+  states_since_full_state_ = (isFullStateRequired()) ? 0 : states_since_full_state_ + 1;
+  for (const auto& pair : link_transforms)
+    published_transforms_[pair.first] = pair.second;
+}
+
+void SceneStateDeltaEncoder::reset(tesseract_common::TransformMap link_transforms)
+{
+  published_transforms_ = std::move(link_transforms);
+  states_since_full_state_ = 0;
+}
+
+void SceneStateDeltaEncoder::clear()
+{
+  published_transforms_.clear();
+  states_since_full_state_ = 0;
+}
+
+const tesseract_common::TransformMap& SceneStateDeltaEncoder::getPublishedTransforms() const
+{
+  return published_transforms_;
+}
+
+void SceneStateCoalescer::add(const tesseract_common::TransformMap& link_transforms)
+{
+  for (const auto& pair : link_transforms)
+    pending_transforms_[pair.first] = pair.second;
+}
+
+tesseract_common::TransformMap SceneStateCoalescer::take()
+{
+  tesseract_common::TransformMap link_transforms;
+  link_transforms.swap(pending_transforms_);
+  return link_transforms;
+}
+
+void SceneStateCoalescer::clear() { pending_transforms_.clear(); }
+
+bool SceneStateCoalescer::empty() const { return pending_transforms_.empty(); }
+
+}  // namespace tesseract_visualization
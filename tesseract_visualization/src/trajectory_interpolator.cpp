@@ -26,6 +26,13 @@
 
 /* Based on MoveIt code authored by: Ioan Sucan, Adam Leeper */
 
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
 #include <tesseract_visualization/trajectory_interpolator.h>
 
 namespace tesseract_visualization
@@ -43,6 +50,8 @@ TrajectoryInterpolator::TrajectoryInterpolator(tesseract_common::JointTrajectory
 
   bool initial_state = true;
 
+  duration_from_previous_.reserve(trajectory_.size());
+  duration_from_start_.reserve(trajectory_.size());
   for (auto& state : trajectory_)
   {
     current_time = state.time;
@@ -62,6 +71,7 @@ TrajectoryInterpolator::TrajectoryInterpolator(tesseract_common::JointTrajectory
     initial_state = false;
     total_time += dt;
     duration_from_previous_.push_back(dt);
+    duration_from_start_.push_back(total_time);
     state.time = total_time;
     last_time = current_time;
   }
@@ -77,25 +87,19 @@ void TrajectoryInterpolator::findStateIndices(const double& duration, long& befo
     return;
   }
 
-  // Find indicies
-  std::size_t index = 0;
-  std::size_t num_points = trajectory_.size();
-  double running_duration = 0.0;
-  for (; index < num_points; ++index)
-  {
-    running_duration += duration_from_previous_[index];
-    if (running_duration >= duration)
-      break;
-  }
-  before = static_cast<int>(std::max<std::size_t>(index - 1, 0));
-  after = static_cast<int>(std::min<std::size_t>(index, num_points - 1));
+  // Find the first state at or after the duration
+  auto it = std::lower_bound(duration_from_start_.begin(), duration_from_start_.end(), duration);
+  auto index = static_cast<long>(std::distance(duration_from_start_.begin(), it));
+  auto num_points = static_cast<long>(trajectory_.size());
+  before = index - 1;
+  after = std::min(index, num_points - 1);
 
   // Compute duration blend
-  double before_time = running_duration - duration_from_previous_[index];
-  if ((index == 0) || (after == before))
+  if ((index == 0) || (index == num_points))
     blend = 1.0;
   else
-    blend = (duration - before_time) / duration_from_previous_[index];
+    blend = (duration - duration_from_start_[static_cast<std::size_t>(before)]) /
+            duration_from_previous_[static_cast<std::size_t>(index)];
 }
 
 tesseract_common::JointState TrajectoryInterpolator::getState(double request_duration) const
@@ -140,6 +144,46 @@ double TrajectoryInterpolator::getStateDuration(long index) const
   return trajectory_[static_cast<std::size_t>(index)].time;
 }
 
+tesseract_common::TrajArray TrajectoryInterpolator::resample(double dt) const
+{
+  if (trajectory_.empty())
+    throw std::runtime_error("Trajectory is empty!");
+
+  if (!(dt > 0))
+    throw std::runtime_error("The resample time step must be greater than zero!");
+
+  const double total_duration = duration_from_start_.back();
+  auto num_samples = static_cast<long>(std::floor(total_duration / dt)) + 1;
+  if (static_cast<double>(num_samples - 1) * dt < total_duration)
+    ++num_samples;
+
+  const std::size_t num_points = trajectory_.size();
+  const auto num_joints = trajectory_.front().position.size();
+  tesseract_common::TrajArray samples(num_samples, num_joints);
+
+  // The sample times are increasing so the segment only needs to move forward
+  std::size_t segment = 0;
+  for (long i = 0; i < num_samples; ++i)
+  {
+    const double duration = std::min(static_cast<double>(i) * dt, total_duration);
+    while (segment + 1 < num_points && duration_from_start_[segment + 1] < duration)
+      ++segment;
+
+    if (segment + 1 == num_points || duration <= duration_from_start_[segment])
+    {
+      samples.row(i) = trajectory_[segment].position.transpose();
+      continue;
+    }
+
+    const double blend = (duration - duration_from_start_[segment]) / duration_from_previous_[segment + 1];
+    const Eigen::VectorXd& start = trajectory_[segment].position;
+    const Eigen::VectorXd& end = trajectory_[segment + 1].position;
+    samples.row(i) = (start + (end - start) * blend).transpose();
+  }
+
+  return samples;
+}
+
 long TrajectoryInterpolator::getStateCount() const { return static_cast<long>(trajectory_.size()); }
 
 tesseract_common::JointState TrajectoryInterpolator::interpolate(const tesseract_common::JointState& start,
@@ -151,7 +195,7 @@ tesseract_common::JointState TrajectoryInterpolator::interpolate(const tesseract
   assert(start.position.rows() != 0);
   assert(end.position.rows() != 0);
   tesseract_common::JointState out;
-  out.time = start.time + t;
+  out.time = start.time + (end.time - start.time) * t;
   out.joint_names = start.joint_names;
   out.position.resize(static_cast<long>(out.joint_names.size()));
 
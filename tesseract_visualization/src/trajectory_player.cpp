@@ -124,6 +124,14 @@ tesseract_common::JointState TrajectoryPlayer::getByIndex(long index) const
   return trajectory_->getState(trajectory_->getStateDuration(index));
 }
 
+tesseract_common::TrajArray TrajectoryPlayer::resample(double dt) const
+{
+  if (!trajectory_ || trajectory_->empty())
+    throw std::runtime_error("Trajectory is empty!");
+
+  return trajectory_->resample(dt);
+}
+
 double TrajectoryPlayer::currentDuration() const { return current_duration_; }
 
 double TrajectoryPlayer::trajectoryDuration() const { return trajectory_duration_; }
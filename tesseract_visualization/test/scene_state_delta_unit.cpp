@@ -0,0 +1,191 @@
+/**
+ * @file scene_state_delta_unit.cpp
+ * @brief Tests for only publishing the link poses of a scene state which changed
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <gtest/gtest.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_visualization/scene_state_delta.h>
+
+tesseract_common::TransformMap getLinkTransforms(double base_x, double tool_x)
+{
+  tesseract_common::TransformMap link_transforms;
+  link_transforms["base_link"] = Eigen::Isometry3d::Identity();
+  link_transforms["base_link"].translation().x() = base_x;
+  link_transforms["tool0"] = Eigen::Isometry3d::Identity();
+  link_transforms["tool0"].translation().x() = tool_x;
+  return link_transforms;
+}
+
+TEST(TesseractSceneStateDeltaUnit, DeltaEncoderTest)  // NOLINT
+{
+  using namespace tesseract_visualization;
+  using namespace tesseract_common;
+
+  SceneStateDeltaEncoder encoder(1e-3, 1e-3, 0);
+  EXPECT_TRUE(encoder.isFullStateRequired());
+
+  // The first state contains every link pose
+  TransformMap changed = encoder.getChangedTransforms(getLinkTransforms(0, 1));
+  EXPECT_EQ(changed.size(), 2);
+  encoder.setPublished(changed);
+  EXPECT_FALSE(encoder.isFullStateRequired());
+  EXPECT_EQ(encoder.getPublishedTransforms().size(), 2);
+
+  // Nothing moved more than the thresholds
+  EXPECT_TRUE(encoder.getChangedTransforms(getLinkTransforms(0, 1.0005)).empty());
+
+  // Only the link which moved is returned
+  changed = encoder.getChangedTransforms(getLinkTransforms(0, 1.1));
+  ASSERT_EQ(changed.size(), 1);
+  EXPECT_NEAR(changed.at("tool0").translation().x(), 1.1, 1e-8);
+  encoder.setPublished(changed);
+  EXPECT_NEAR(encoder.getPublishedTransforms().at("tool0").translation().x(), 1.1, 1e-8);
+
+  // Motion below the threshold accumulates since poses are compared against the last published pose
+  TransformMap link_transforms = getLinkTransforms(0, 1.1);
+  for (int i = 1; i <= 3; ++i)
+  {
+    link_transforms["tool0"].translation().x() = 1.1 + (i * 0.0004);
+    changed = encoder.getChangedTransforms(link_transforms);
+    if (i < 3)
+    {
+      EXPECT_TRUE(changed.empty());
+    }
+    else
+    {
+      EXPECT_EQ(changed.size(), 1);
+    }
+    encoder.setPublished(changed);
+  }
+  EXPECT_NEAR(encoder.getPublishedTransforms().at("tool0").translation().x(), 1.1012, 1e-8);
+
+  // Rotations are compared using the rotation threshold
+  link_transforms = getLinkTransforms(0, 1.1012);
+  link_transforms["base_link"].linear() = Eigen::AngleAxisd(0.0005, Eigen::Vector3d::UnitZ()).toRotationMatrix();
+  EXPECT_TRUE(encoder.getChangedTransforms(link_transforms).empty());
+  link_transforms["base_link"].linear() = Eigen::AngleAxisd(0.01, Eigen::Vector3d::UnitZ()).toRotationMatrix();
+  changed = encoder.getChangedTransforms(link_transforms);
+  ASSERT_EQ(changed.size(), 1);
+  EXPECT_EQ(changed.begin()->first, "base_link");
+
+  // A link which was not published before is always returned
+  link_transforms = getLinkTransforms(0, 1.1012);
+  link_transforms["new_link"] = Eigen::Isometry3d::Identity();
+  changed = encoder.getChangedTransforms(link_transforms);
+  ASSERT_EQ(changed.size(), 1);
+  EXPECT_EQ(changed.begin()->first, "new_link");
+
+  // Clearing requires a full state again
+  encoder.clear();
+  EXPECT_TRUE(encoder.isFullStateRequired());
+  EXPECT_TRUE(encoder.getPublishedTransforms().empty());
+  EXPECT_EQ(encoder.getChangedTransforms(getLinkTransforms(0, 1)).size(), 2);
+
+  // Resetting records a full state published by other means
+  encoder.reset(getLinkTransforms(0, 1));
+  EXPECT_FALSE(encoder.isFullStateRequired());
+  EXPECT_TRUE(encoder.getChangedTransforms(getLinkTransforms(0, 1)).empty());
+}
+
+TEST(TesseractSceneStateDeltaUnit, DeltaEncoderFullStateIntervalTest)  // NOLINT
+{
+  using namespace tesseract_visualization;
+  using namespace tesseract_common;
+
+  SceneStateDeltaEncoder encoder(1e-3, 1e-3, 3);
+  encoder.setPublished(encoder.getChangedTransforms(getLinkTransforms(0, 1)));
+
+  // After three states only containing the links which moved the next state contains every link pose
+  for (int i = 1; i <= 8; ++i)
+  {
+    TransformMap changed = encoder.getChangedTransforms(getLinkTransforms(0, 1 + (i * 0.1)));
+    if (i % 4 == 0)
+    {
+      EXPECT_TRUE(encoder.isFullStateRequired());
+      EXPECT_EQ(changed.size(), 2);
+    }
+    else
+    {
+      EXPECT_FALSE(encoder.isFullStateRequired());
+      EXPECT_EQ(changed.size(), 1);
+    }
+    encoder.setPublished(changed);
+  }
+
+  // States which were not published do not count towards the interval
+  for (int i = 0; i < 5; ++i)
+  {
+    TransformMap changed = encoder.getChangedTransforms(getLinkTransforms(0, 1.8));
+    EXPECT_TRUE(changed.empty());
+    encoder.setPublished(changed);
+  }
+  EXPECT_FALSE(encoder.isFullStateRequired());
+
+  // Resetting restarts the interval
+  encoder.reset(getLinkTransforms(0, 1.8));
+  for (int i = 1; i <= 3; ++i)
+    encoder.setPublished(encoder.getChangedTransforms(getLinkTransforms(0, 1.8 + (i * 0.1))));
+  EXPECT_TRUE(encoder.isFullStateRequired());
+}
+
+TEST(TesseractSceneStateDeltaUnit, CoalescerTest)  // NOLINT
+{
+  using namespace tesseract_visualization;
+  using namespace tesseract_common;
+
+  SceneStateCoalescer coalescer;
+  EXPECT_TRUE(coalescer.empty());
+  EXPECT_TRUE(coalescer.take().empty());
+
+  // Only the latest pose of each link is kept
+  coalescer.add(getLinkTransforms(0, 1));
+  TransformMap partial;
+  partial["tool0"] = Eigen::Isometry3d::Identity();
+  partial["tool0"].translation().x() = 2;
+  coalescer.add(partial);
+  EXPECT_FALSE(coalescer.empty());
+
+  TransformMap pending = coalescer.take();
+  EXPECT_TRUE(coalescer.empty());
+  ASSERT_EQ(pending.size(), 2);
+  EXPECT_NEAR(pending.at("base_link").translation().x(), 0, 1e-8);
+  EXPECT_NEAR(pending.at("tool0").translation().x(), 2, 1e-8);
+
+  // Clearing discards the pending poses
+  coalescer.add(getLinkTransforms(0, 1));
+  coalescer.clear();
+  EXPECT_TRUE(coalescer.empty());
+  EXPECT_TRUE(coalescer.take().empty());
+}
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+
+  return RUN_ALL_TESTS();
+}
@@ -146,6 +146,64 @@ TEST(TesseracTrajectoryInterpolatorUnit, TrajectoryInterpolatorTest)  // NOLINT
   }
 }
 
+TEST(TesseracTrajectoryInterpolatorUnit, TrajectoryInterpolatorNonUniformTest)  // NOLINT
+{
+  using namespace tesseract_visualization;
+  using namespace tesseract_common;
+
+  std::vector<std::string> joint_names = { "joint_1", "joint_2" };
+  JointTrajectory trajectory;
+
+  // Define trajectory with non uniform time steps and a repeated state
+  std::vector<double> times = { 0, 0.5, 2, 2, 3.5 };
+  for (std::size_t i = 0; i < times.size(); ++i)
+  {
+    Eigen::VectorXd p = Eigen::VectorXd::Zero(2);
+    p(0) = times[i];
+    p(1) = -2 * times[i];
+    trajectory.push_back(JointState(joint_names, p));
+    trajectory.back().time = times[i];
+  }
+
+  TrajectoryInterpolator interpolator(trajectory);
+
+  for (long i = 0; i < 40; ++i)
+  {
+    double duration = static_cast<double>(i) * 0.1;
+    double expected = std::min(duration, 3.5);
+    JointState s = interpolator.getState(duration);
+    EXPECT_NEAR(s.time, expected, 1e-5);
+    EXPECT_NEAR(s.position(0), expected, 1e-5);
+    EXPECT_NEAR(s.position(1), -2 * expected, 1e-5);
+  }
+
+  // Resample with a time step which does not divide the duration, the final state must be the last row
+  TrajArray samples = interpolator.resample(0.3);
+  ASSERT_EQ(samples.rows(), 13);
+  ASSERT_EQ(samples.cols(), 2);
+  for (long i = 0; i < samples.rows(); ++i)
+  {
+    double expected = std::min(static_cast<double>(i) * 0.3, 3.5);
+    JointState s = interpolator.getState(expected);
+    EXPECT_NEAR(samples(i, 0), expected, 1e-5);
+    EXPECT_NEAR(samples(i, 1), -2 * expected, 1e-5);
+    EXPECT_TRUE(samples.row(i).transpose().isApprox(s.position, 1e-8));
+  }
+
+  // Resample with a time step which divides the duration
+  samples = interpolator.resample(0.5);
+  ASSERT_EQ(samples.rows(), 8);
+  EXPECT_NEAR(samples(7, 0), 3.5, 1e-5);
+
+  EXPECT_ANY_THROW(interpolator.resample(0));  // NOLINT
+  EXPECT_ANY_THROW(interpolator.resample(-1));  // NOLINT
+
+  TrajectoryPlayer player;
+  EXPECT_ANY_THROW(player.resample(0.1));  // NOLINT
+  player.setTrajectory(trajectory);
+  EXPECT_TRUE(player.resample(0.3).isApprox(interpolator.resample(0.3)));
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);